@@ -22,6 +22,7 @@
 bool eCALMeasCutterUtils::quiet                     = false;
 bool eCALMeasCutterUtils::save_log                  = false;
 bool eCALMeasCutterUtils::enable_one_file_per_topic = false;
+unsigned int eCALMeasCutterUtils::channel_thread_count = 0;
 
 eCALMeasCutter::eCALMeasCutter(std::vector<std::string>& arguments):
   _max_size_per_file(0),
@@ -41,6 +42,7 @@ void eCALMeasCutter::parseCmdLine(std::vector<std::string>& arguments)
   TCLAP::SwitchArg quiet_arg("q", "quiet", "Disables logging to console output.", cmd, false);
   TCLAP::SwitchArg save_log_arg("s", "save_log", "Enables log file creation in a folder called \"log\" next to the executable.", cmd, false);
   TCLAP::SwitchArg one_file_per_topic_arg("", "enable-one-file-per-topic", "Whether to separate each topic in single HDF5 file.", cmd, false);
+  TCLAP::ValueArg<unsigned int> channel_threads_arg("", "channel-threads", "Number of threads reading the channels of each measurement. 0 (default) chooses automatically based on the number of CPU cores. Without a thread-safe HDF5 library a single thread is used.", false, 0, "uint", cmd);
 
   try
   {
@@ -61,6 +63,7 @@ void eCALMeasCutter::parseCmdLine(std::vector<std::string>& arguments)
   eCALMeasCutterUtils::quiet                     = quiet_arg.getValue();
   eCALMeasCutterUtils::save_log                  = save_log_arg.getValue();
   eCALMeasCutterUtils::enable_one_file_per_topic = one_file_per_topic_arg.getValue();
+  eCALMeasCutterUtils::channel_thread_count      = channel_threads_arg.getValue();
 
   if (eCALMeasCutterUtils::save_log)
   {
@@ -242,6 +245,14 @@ int eCALMeasCutter::run()
 {
   auto id = 0;
 
+  // Share the CPU cores between the measurements that are processed in parallel
+  if (eCALMeasCutterUtils::channel_thread_count == 0)
+  {
+    const auto hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+    const auto parallel_jobs    = std::max<size_t>(1, std::min<size_t>(hardware_threads, _input_output_pairs.size()));
+    eCALMeasCutterUtils::channel_thread_count = std::max(1u, static_cast<unsigned int>(hardware_threads / parallel_jobs));
+  }
+
   _thread_pool.Start();
 
   for (const auto& input_output_pair : _input_output_pairs)
@@ -0,0 +1,105 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "entry_queue.h"
+
+namespace
+{
+  // Keep a few buffers per reader thread, everything else is released
+  constexpr size_t kMaxFreeBuffers    = 64;
+  constexpr size_t kMaxFreeBufferSize = 16 * 1024 * 1024;
+}
+
+EntryQueue::EntryQueue(size_t max_size_bytes, size_t producer_count) :
+  _size_bytes(0),
+  _max_size_bytes(max_size_bytes),
+  _active_producers(producer_count),
+  _is_closed(false)
+{
+}
+
+bool EntryQueue::push(Entry&& entry)
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  // Always accept an entry if the queue is empty, even if it exceeds the size limit on its own
+  _not_full_cv.wait(lock, [&]() -> bool { return _is_closed || _entries.empty() || (_size_bytes + entry.payload.size() <= _max_size_bytes); });
+
+  if (_is_closed)
+    return false;
+
+  _size_bytes += entry.payload.size();
+  _entries.emplace_back(std::move(entry));
+  _not_empty_cv.notify_one();
+  return true;
+}
+
+bool EntryQueue::pop(Entry& entry)
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  _not_empty_cv.wait(lock, [&]() -> bool { return _is_closed || !_entries.empty() || (_active_producers == 0); });
+
+  if (_is_closed || _entries.empty())
+    return false;
+
+  entry = std::move(_entries.front());
+  _entries.pop_front();
+  _size_bytes -= entry.payload.size();
+  _not_full_cv.notify_all();
+  return true;
+}
+
+void EntryQueue::producerFinished()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_active_producers > 0)
+    _active_producers--;
+  _not_empty_cv.notify_all();
+}
+
+void EntryQueue::close()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _is_closed = true;
+  }
+  _not_full_cv.notify_all();
+  _not_empty_cv.notify_all();
+}
+
+void EntryQueue::recycleBuffer(std::string&& buffer)
+{
+  std::lock_guard<std::mutex> lock(_buffer_mutex);
+  if ((_free_buffers.size() < kMaxFreeBuffers) && (buffer.capacity() <= kMaxFreeBufferSize))
+  {
+    _free_buffers.emplace_back(std::move(buffer));
+  }
+}
+
+std::string EntryQueue::acquireBuffer()
+{
+  std::lock_guard<std::mutex> lock(_buffer_mutex);
+  if (_free_buffers.empty())
+    return std::string();
+
+  std::string buffer = std::move(_free_buffers.back());
+  _free_buffers.pop_back();
+  return buffer;
+}
@@ -0,0 +1,76 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+#include <mutex>
+#include <deque>
+#include <vector>
+#include <condition_variable>
+
+#include "utils.h"
+
+// Bounded queue that hands entries from the channel reader threads over to
+// the single thread writing the output measurement. The queue is limited by
+// the sum of the payload sizes, so a few huge entries cannot exhaust memory.
+// Payload buffers are handed back by the consumer and reused by the readers.
+class EntryQueue
+{
+public:
+  struct Entry
+  {
+    size_t                          channel_index;
+    eCALMeasCutterUtils::Timestamp  timestamp;
+    eCALMeasCutterUtils::MetaData   meta_data;
+    std::string                     payload;
+
+    Entry() : channel_index(0), timestamp(0) {}
+  };
+
+  EntryQueue(size_t max_size_bytes, size_t producer_count);
+  EntryQueue(EntryQueue const&) = delete;
+  EntryQueue& operator =(EntryQueue const&) = delete;
+  EntryQueue(EntryQueue&&) = delete;
+  EntryQueue& operator=(EntryQueue&&) = delete;
+
+  // Blocks while the queue is full. Returns false if the queue has been closed.
+  bool push(Entry&& entry);
+
+  // Blocks until an entry is available. Returns false once all producers
+  // have finished and the queue is drained, or if the queue has been closed.
+  bool pop(Entry& entry);
+
+  void producerFinished();
+  void close();
+
+  void        recycleBuffer(std::string&& buffer);
+  std::string acquireBuffer();
+
+private:
+  std::mutex                _mutex;
+  std::condition_variable   _not_full_cv;
+  std::condition_variable   _not_empty_cv;
+  std::deque<Entry>         _entries;
+  size_t                    _size_bytes;
+  const size_t              _max_size_bytes;
+  size_t                    _active_producers;
+  bool                      _is_closed;
+
+  std::mutex                _buffer_mutex;
+  std::vector<std::string>  _free_buffers;
+};
@@ -19,6 +19,10 @@
 
 #include "measurement_converter.h"
 
+#include <thread>
+
+#include "entry_queue.h"
+
 MeasurementConverter::MeasurementConverter() :
   _abort_conversion(false),
   _is_channel_manipulation_valid(true),
@@ -199,21 +203,14 @@ bool MeasurementConverter::convert()
 {
   bool conversion_result = true;
 
-  std::string payload;
-  eCALMeasCutterUtils::MetaData meta_data;
-
   auto channel_names = _importer.getChannelNames();
 
   eCALMeasCutterUtils::printOutput("Processing " + _importer.getLoadedPath() + " as " + _current_job.id + "\n" 
                                    + std::string(13, ' ') + "Exporting to " + _exporter.getOutputPath());
 
+  std::vector<std::string> channels_to_export;
   for (const auto& channel_name : channel_names)
   {
-    if (_abort_conversion)
-    {
-      conversion_result = false;
-      break;
-    }
     if (_is_channel_manipulation_valid)
     {
       if (_current_job.operation_type == eCALMeasCutterUtils::ChannelOperationType::exclude &&
@@ -225,26 +222,8 @@ bool MeasurementConverter::convert()
 
     try
     {
-      _importer.openChannel(channel_name);
-      auto channel_info = _importer.getChannelInfoforCurrentChannel();
-      auto timestamps = _importer.getTimestamps();
-      auto timestamp_begin_iter = timestamps.lower_bound(_calculated_start_timestamp);
-      auto timestamp_end_iter = timestamps.upper_bound(_calculated_end_timestamp);
-
-      _exporter.createChannel(channel_name, channel_info);
-
-      eCALMeasCutterUtils::printOutput("Exporting channel " + channel_name + "...", _current_job.id);
-
-      for (auto timestamp_iter = timestamp_begin_iter; timestamp_iter != timestamp_end_iter; ++timestamp_iter)
-      {
-        if (_abort_conversion)
-        {
-          conversion_result = false;
-          break;
-        }
-        _importer.getData(*timestamp_iter, meta_data, payload);
-        _exporter.setData((*timestamp_iter), meta_data, payload);
-      }
+      _exporter.createChannel(channel_name, _importer.getChannelInfo(channel_name));
+      channels_to_export.push_back(channel_name);
     }
     catch (const ImporterException& e)
     {
@@ -268,6 +247,9 @@ bool MeasurementConverter::convert()
     }
   }
 
+  if (!exportChannels(channels_to_export))
+    conversion_result = false;
+
   auto input_path  = EcalUtils::Filesystem::ToNativeSeperators(EcalUtils::Filesystem::CleanPath(_importer.getLoadedPath()));
   auto output_path = EcalUtils::Filesystem::ToNativeSeperators(EcalUtils::Filesystem::CleanPath(_exporter.getRootOutputPath()));
 
@@ -319,6 +301,132 @@ bool MeasurementConverter::convert()
   return conversion_result;
 }
 
+bool MeasurementConverter::exportChannels(const std::vector<std::string>& channel_names)
+{
+  if (channel_names.empty())
+    return !_abort_conversion;
+
+  // Each reader thread only fetches the entries of the cut window of its
+  // channels, all entries are then written by this thread. The readers share
+  // one HDF5 reader, so multiple readers require a thread-safe HDF5 library.
+  // Even then all HDF5 calls are serialized by the library's global lock, the
+  // readers mainly overlap the reading with the writing of this thread.
+  size_t reader_count = std::max<size_t>(1, std::min<size_t>(eCALMeasCutterUtils::channel_thread_count, channel_names.size()));
+  if ((reader_count > 1) && !eCAL::eh5::HDF5Meas::IsThreadSafe())
+    reader_count = 1;
+
+  EntryQueue           entry_queue(eCALMeasCutterUtils::kDefaultEntryQueueSize, reader_count);
+  std::atomic<size_t>  next_channel_index(0);
+  std::atomic<bool>    read_result(true);
+
+  auto read_channels = [&]()
+  {
+    EntryQueue::Entry entry;
+
+    while (!_abort_conversion)
+    {
+      const size_t channel_index = next_channel_index++;
+      if (channel_index >= channel_names.size())
+        break;
+
+      const auto& channel_name = channel_names[channel_index];
+
+      try
+      {
+        auto entries_info = _importer.getEntriesInfoRange(channel_name, _calculated_start_timestamp, _calculated_end_timestamp);
+
+        eCALMeasCutterUtils::printOutput("Exporting channel " + channel_name + "...", _current_job.id);
+
+        for (const auto& entry_info : entries_info)
+        {
+          if (_abort_conversion)
+            break;
+
+          entry.channel_index = channel_index;
+          entry.timestamp     = entry_info.RcvTimestamp;
+          entry.payload       = entry_queue.acquireBuffer();
+          _importer.getData(entry_info, entry.meta_data, entry.payload);
+
+          if (!entry_queue.push(std::move(entry)))
+            break;
+        }
+      }
+      catch (const ImporterException& e)
+      {
+        eCALMeasCutterUtils::printError("Importing error in channel " + channel_name + ": " + e.what(), _current_job.id);
+        read_result = false;
+      }
+      catch (const std::bad_alloc& e)
+      {
+        eCALMeasCutterUtils::printError("Memory limit has been exceeded: " + std::string(e.what()), _current_job.id);
+        read_result = false;
+      }
+      catch (...)
+      {
+        eCALMeasCutterUtils::printError("An unknown error has occured in channel " + channel_name + ". Please report this to an AT9 team member.", _current_job.id);
+        read_result = false;
+      }
+    }
+
+    entry_queue.producerFinished();
+  };
+
+  std::vector<std::thread> reader_threads;
+  reader_threads.reserve(reader_count);
+  for (size_t i = 0; i < reader_count; i++)
+  {
+    reader_threads.emplace_back(read_channels);
+  }
+
+  bool              write_result = true;
+  std::vector<bool> channel_failed(channel_names.size(), false);
+  EntryQueue::Entry entry;
+
+  while (entry_queue.pop(entry))
+  {
+    if (_abort_conversion)
+      break;
+
+    // Skip the remaining entries of a channel that could not be exported
+    if (channel_failed[entry.channel_index])
+      continue;
+
+    try
+    {
+      _exporter.setData(channel_names[entry.channel_index], entry.timestamp, entry.meta_data, entry.payload);
+    }
+    catch (const ExporterException& e)
+    {
+      eCALMeasCutterUtils::printError("Exporting error in channel: " + channel_names[entry.channel_index] + ": " + e.what(), _current_job.id);
+      channel_failed[entry.channel_index] = true;
+      write_result = false;
+    }
+    catch (const std::bad_alloc& e)
+    {
+      eCALMeasCutterUtils::printError("Memory limit has been exceeded: " + std::string(e.what()), _current_job.id);
+      channel_failed[entry.channel_index] = true;
+      write_result = false;
+    }
+    catch (...)
+    {
+      eCALMeasCutterUtils::printError("An unknown error has occured in channel " + channel_names[entry.channel_index] + ". Please report this to an AT9 team member.", _current_job.id);
+      channel_failed[entry.channel_index] = true;
+      write_result = false;
+    }
+
+    entry_queue.recycleBuffer(std::move(entry.payload));
+  }
+
+  // Wake up readers that are blocked on a full queue (only happens on abort)
+  entry_queue.close();
+  for (auto& reader_thread : reader_threads)
+  {
+    reader_thread.join();
+  }
+
+  return read_result && write_result && !_abort_conversion;
+}
+
 std::pair<eCALMeasCutterUtils::Timestamp, eCALMeasCutterUtils::Timestamp> MeasurementConverter::getCalculatedStartEndTimestamps()
 {
   std::pair<eCALMeasCutterUtils::Timestamp, eCALMeasCutterUtils::Timestamp> start_stop_pair(_original_start_timestamp, _original_end_timestamp);
@@ -19,6 +19,8 @@
 
 #pragma once
 #include <iostream>
+#include <atomic>
+#include <vector>
 
 #include "utils.h"
 #include "measurement_importer.h"
@@ -38,8 +40,9 @@ private:
   std::pair<eCALMeasCutterUtils::Timestamp, eCALMeasCutterUtils::Timestamp> getCalculatedStartEndTimestamps();
   double                                                                    getConversionFactor(const eCALMeasCutterUtils::ScaleType scale_type);
   bool isChannelMentionedInFile(const std::string& channel_name);
+  bool exportChannels(const std::vector<std::string>& channel_names);
   eCALMeasCutterUtils::MeasurementJob                                       _current_job;
-  bool                                                                      _abort_conversion;
+  std::atomic<bool>                                                         _abort_conversion;
   bool                                                                      _is_channel_manipulation_valid;
 
   MeasurementImporter                                                       _importer;
@@ -66,6 +66,11 @@ void MeasurementExporter::createChannel(const std::string& channel_name, const e
 }
 
 void MeasurementExporter::setData(eCALMeasCutterUtils::Timestamp timestamp, const eCALMeasCutterUtils::MetaData& meta_data, const std::string& payload)
+{
+  setData(_current_channel_name, timestamp, meta_data, payload);
+}
+
+void MeasurementExporter::setData(const std::string& channel_name, eCALMeasCutterUtils::Timestamp timestamp, const eCALMeasCutterUtils::MetaData& meta_data, const std::string& payload)
 {
   eCALMeasCutterUtils::MetaData::const_iterator iter;
 
@@ -78,7 +83,7 @@ void MeasurementExporter::setData(eCALMeasCutterUtils::Timestamp timestamp, cons
   iter = meta_data.find(eCALMeasCutterUtils::MetaDatumKey::SENDER_CLOCK);
   const auto sender_clock = (iter != meta_data.end()) ? iter->second.sender_clock : static_cast<uint64_t>(0);
 
-  if (!_writer->AddEntryToFile(payload.data(), payload.size(), sender_timestamp, timestamp, _current_channel_name, sender_id, sender_clock))
+  if (!_writer->AddEntryToFile(payload.data(), payload.size(), sender_timestamp, timestamp, channel_name, sender_id, sender_clock))
   {
     throw ExporterException("Unable to export protobuf message.");
   }
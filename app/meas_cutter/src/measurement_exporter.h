@@ -39,6 +39,7 @@ public:
   void        setPath(const std::string& path, const std::string& base_name, const size_t& max_size_per_file);
   void        createChannel(const std::string& channel_name, const eCALMeasCutterUtils::ChannelInfo& channel_info);
   void        setData(eCALMeasCutterUtils::Timestamp timestamp, const eCALMeasCutterUtils::MetaData& meta_data, const std::string& payload);
+  void        setData(const std::string& channel_name, eCALMeasCutterUtils::Timestamp timestamp, const eCALMeasCutterUtils::MetaData& meta_data, const std::string& payload);
   std::string getOutputPath() const;
   std::string getRootOutputPath() const;
 
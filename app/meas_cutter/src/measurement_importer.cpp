@@ -67,18 +67,7 @@ void MeasurementImporter::openChannel(const std::string& channel_name)
   _current_opened_channel_data._timestamps.clear();
   _current_opened_channel_data._timestamp_entry_info_map.clear();
 
-  if (isProtoChannel(_reader->GetChannelType(channel_name)))
-  {
-    _current_opened_channel_data._channel_info.format = eCALMeasCutterUtils::SerializationFormat::PROTOBUF;
-    _current_opened_channel_data._channel_info.type   = _reader->GetChannelType(channel_name).substr(6); // remove "proto:" from type string
-  }
-  else
-  {
-    _current_opened_channel_data._channel_info.format = eCALMeasCutterUtils::SerializationFormat::UNKNOWN;
-    _current_opened_channel_data._channel_info.type   = _reader->GetChannelType(channel_name);
-  }
-  _current_opened_channel_data._channel_info.description = _reader->GetChannelDescription(channel_name);
-  _current_opened_channel_data._channel_info.name = channel_name;
+  _current_opened_channel_data._channel_info = getChannelInfo(channel_name);
 
   eCAL::measurement::base::EntryInfoSet entry_info_set;
   _reader->GetEntriesInfo(channel_name, entry_info_set);
@@ -90,6 +79,36 @@ void MeasurementImporter::openChannel(const std::string& channel_name)
   }
 }
 
+eCALMeasCutterUtils::ChannelInfo MeasurementImporter::getChannelInfo(const std::string& channel_name) const
+{
+  eCALMeasCutterUtils::ChannelInfo channel_info;
+
+  const auto channel_type = _reader->GetChannelType(channel_name);
+  if (isProtoChannel(channel_type))
+  {
+    channel_info.format = eCALMeasCutterUtils::SerializationFormat::PROTOBUF;
+    channel_info.type   = channel_type.substr(6); // remove "proto:" from type string
+  }
+  else
+  {
+    channel_info.format = eCALMeasCutterUtils::SerializationFormat::UNKNOWN;
+    channel_info.type   = channel_type;
+  }
+  channel_info.description = _reader->GetChannelDescription(channel_name);
+  channel_info.name        = channel_name;
+
+  return channel_info;
+}
+
+eCAL::measurement::base::EntryInfoSet MeasurementImporter::getEntriesInfoRange(const std::string& channel_name, eCALMeasCutterUtils::Timestamp begin, eCALMeasCutterUtils::Timestamp end) const
+{
+  // Uses the entry index of the measurement to only fetch the entries in the
+  // cut window, instead of loading and filtering the entire channel
+  eCAL::measurement::base::EntryInfoSet entry_info_set;
+  _reader->GetEntriesInfoRange(channel_name, begin, end, entry_info_set);
+  return entry_info_set;
+}
+
 eCALMeasCutterUtils::ChannelInfo MeasurementImporter::getChannelInfoforCurrentChannel() const
 {
   return _current_opened_channel_data._channel_info;
@@ -102,17 +121,25 @@ eCALMeasCutterUtils::TimestampSet MeasurementImporter::getTimestamps() const
 
 void MeasurementImporter::getData(eCALMeasCutterUtils::Timestamp timestamp, eCALMeasCutterUtils::MetaData& meta_data, std::string& data)
 {
-  const auto& entry_info = _current_opened_channel_data._timestamp_entry_info_map.at(timestamp);
+  getData(_current_opened_channel_data._timestamp_entry_info_map.at(timestamp), meta_data, data);
+}
 
+void MeasurementImporter::getData(const eCAL::measurement::base::EntryInfo& entry_info, eCALMeasCutterUtils::MetaData& meta_data, std::string& data) const
+{
   auto data_id = entry_info.ID;
 
   size_t size = 0;
-  _reader->GetEntryDataSize(data_id, size);
-
-   std::vector<char> buffer(size);
-   _reader->GetEntryData(data_id, buffer.data());
+  if (!_reader->GetEntryDataSize(data_id, size))
+  {
+    throw ImporterException("Unable to read size of entry " + std::to_string(data_id) + ".");
+  }
 
-  data.assign(buffer.data(), size);
+  // Read directly into the (possibly reused) output buffer
+  data.resize(size);
+  if ((size > 0) && !_reader->GetEntryData(data_id, &data[0]))
+  {
+    throw ImporterException("Unable to read entry " + std::to_string(data_id) + ".");
+  }
 
   meta_data.clear();
   meta_data[eCALMeasCutterUtils::MetaDatumKey::RECEIVER_TIMESTAMP].receiver_timestamp = entry_info.RcvTimestamp;
@@ -177,7 +204,7 @@ bool MeasurementImporter::isEcalMeasFile(const std::string& path)
   return false;
 }
 
-bool MeasurementImporter::isProtoChannel(const std::string& channel_type)
+bool MeasurementImporter::isProtoChannel(const std::string& channel_type) const
 {
   std::string space = channel_type.substr(0, channel_type.find_first_of(':'));
   return (space.compare("proto") == 0);
@@ -45,6 +45,13 @@ public:
   eCALMeasCutterUtils::ChannelInfo                                                        getChannelInfoforCurrentChannel() const;
   eCALMeasCutterUtils::TimestampSet                                                       getTimestamps() const;
   void                                                                                    getData(eCALMeasCutterUtils::Timestamp timestamp, eCALMeasCutterUtils::MetaData& meta_data, std::string& data);
+
+  // The following functions don't depend on the currently opened channel and
+  // may be called concurrently from multiple threads
+  eCALMeasCutterUtils::ChannelInfo                                                        getChannelInfo(const std::string& channel_name) const;
+  eCAL::measurement::base::EntryInfoSet                                                   getEntriesInfoRange(const std::string& channel_name, eCALMeasCutterUtils::Timestamp begin, eCALMeasCutterUtils::Timestamp end) const;
+  void                                                                                    getData(const eCAL::measurement::base::EntryInfo& entry_info, eCALMeasCutterUtils::MetaData& meta_data, std::string& data) const;
+
   std::pair<eCALMeasCutterUtils::Timestamp, eCALMeasCutterUtils::Timestamp>               getOriginalStartFinishTimestamps();
   std::list<std::string>                                                                  getChannelNamesForRegex(const std::regex& regex);
   std::string                                                                             getLoadedPath();
@@ -52,7 +59,7 @@ public:
 
 private:
   bool                                 isEcalMeasFile(const std::string& path);
-  bool                                 isProtoChannel(const std::string& channel_type);
+  bool                                 isProtoChannel(const std::string& channel_type) const;
   std::unique_ptr<eCAL::measurement::base::Reader>      _reader;
   eCALMeasCutterUtils::ChannelData                      _current_opened_channel_data;
   std::string                                           _loaded_path;
@@ -44,10 +44,12 @@ namespace eCALMeasCutterUtils
   constexpr const int  kDefaultHdf5FileSize      = 512;
   constexpr const char* kDefaultFolderOutput     = "MEASUREMENT_CONVERTER";
   constexpr const char* kDefaultLogOutputFolder  = "log";
+  constexpr const size_t kDefaultEntryQueueSize  = 256 * 1024 * 1024;
   
   extern bool quiet;
   extern bool save_log;
   extern bool enable_one_file_per_topic;
+  extern unsigned int channel_thread_count;
 
   static std::fstream log_file_output_stream;
   static std::string getLogTime()
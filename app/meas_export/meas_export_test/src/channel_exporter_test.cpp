@@ -0,0 +1,216 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/protobuf/ecal_proto_hlp.h>
+#include <ecalhdf5/eh5_meas.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "channel_exporter.h"
+#include "column_file.h"
+
+#include "export_sample.pb.h"
+
+namespace
+{
+  const std::string export_file = "meas_export_test_signals.h5";
+
+  // entry 3 of the first channel announces a position message behind the end of the buffer
+  const size_t malformed_entry = 3;
+
+  std::string SerializeSample(int id_, double value_)
+  {
+    pb::MeasExport::ExportSample sample;
+    sample.set_id(id_);
+    sample.set_value(value_);
+    sample.mutable_position()->set_x(id_ * 10.0);
+    sample.mutable_position()->set_y(id_ * -10.0);
+    sample.set_name("sample");
+    sample.add_history(id_);
+    return(sample.SerializeAsString());
+  }
+
+  void WriteMeasurement(const std::string& meas_dir_, size_t entry_count_)
+  {
+    const pb::MeasExport::ExportSample sample;
+
+    eCAL::eh5::HDF5Meas writer;
+    ASSERT_TRUE(writer.Open(meas_dir_, eCAL::eh5::eAccessType::CREATE));
+    writer.SetFileBaseName("meas_export_test");
+
+    for (const std::string channel : { "first", "second" })
+    {
+      writer.SetChannelType(channel, "proto:" + sample.GetTypeName());
+      writer.SetChannelDescription(channel, eCAL::protobuf::GetProtoMessageDescription(sample));
+
+      for (size_t i = 0; i < entry_count_; ++i)
+      {
+        const long long timestamp = static_cast<long long>(i) * 1000;
+        std::string data = SerializeSample(static_cast<int>(i + 1), i * 0.5);
+        if ((channel == "first") && (i == malformed_entry)) data = std::string("\x1a\x64", 2);
+
+        ASSERT_TRUE(writer.AddEntryToFile(data.data(), data.size(), timestamp, timestamp + 1, channel, static_cast<long long>(i), 0));
+      }
+    }
+
+    ASSERT_TRUE(writer.Close());
+  }
+
+  template <typename T>
+  std::vector<T> ReadDataset(hid_t file_, const std::string& path_, hid_t type_, size_t entry_count_)
+  {
+    std::vector<T> values(entry_count_);
+    const hid_t dataset = H5Dopen(file_, path_.c_str(), H5P_DEFAULT);
+    EXPECT_GE(dataset, 0) << path_;
+    if (dataset < 0) return(std::vector<T>());
+
+    const hid_t   space = H5Dget_space(dataset);
+    hsize_t       size(0);
+    H5Sget_simple_extent_dims(space, &size, nullptr);
+    H5Sclose(space);
+    EXPECT_EQ(entry_count_, size) << path_;
+
+    if (size == entry_count_) EXPECT_GE(H5Dread(dataset, type_, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data()), 0) << path_;
+    H5Dclose(dataset);
+    return(values);
+  }
+}
+
+TEST(MeasExport, CollectSignals)
+{
+  const std::vector<std::string> signals = ChannelExporter::CollectSignals(pb::MeasExport::ExportSample::descriptor());
+
+  // strings and repeated fields are no signals
+  const std::vector<std::string> expected_signals{ "id", "value", "position.x", "position.y" };
+  EXPECT_EQ(expected_signals, signals);
+}
+
+TEST(MeasExport, ExportChannels)
+{
+  // a few blocks per channel, the last one is not complete
+  const std::string meas_dir    = "meas_export_test_channels";
+  const size_t      entry_count = 10;
+  WriteMeasurement(meas_dir, entry_count);
+
+  eCAL::eh5::HDF5Meas measurement(meas_dir);
+  ASSERT_TRUE(measurement.IsOk());
+
+  ExportSettings settings;
+  settings.thread_count = 3;
+  settings.block_size   = 4;
+
+  {
+    ColumnFile file;
+    ASSERT_TRUE(file.Open(export_file));
+
+    // the workers of one exporter decode all channels
+    ChannelExporter exporter(measurement, file, settings);
+    for (const std::string channel : { "first", "second" })
+    {
+      ExportStatistics statistics;
+      std::string      error;
+      ASSERT_TRUE(exporter.Export(channel, {}, statistics, error)) << error;
+
+      EXPECT_EQ(4u, statistics.signals);
+      EXPECT_EQ(entry_count, statistics.messages);
+      EXPECT_EQ((channel == "first") ? 1u : 0u, statistics.malformed);
+    }
+
+    // a channel of a non protobuf type is rejected
+    ExportStatistics statistics;
+    std::string      error;
+    EXPECT_FALSE(exporter.Export("unknown", {}, statistics, error));
+    EXPECT_FALSE(error.empty());
+  }
+
+  const hid_t file = H5Fopen(export_file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  ASSERT_GE(file, 0);
+
+  for (const std::string channel : { "first", "second" })
+  {
+    const std::vector<long long> snd_timestamps = ReadDataset<long long>(file, "/" + channel + "/snd_timestamp", H5T_NATIVE_LLONG, entry_count);
+    const std::vector<long long> rcv_timestamps = ReadDataset<long long>(file, "/" + channel + "/rcv_timestamp", H5T_NATIVE_LLONG, entry_count);
+    const std::vector<double>    ids            = ReadDataset<double>(file, "/" + channel + "/signals/id",         H5T_NATIVE_DOUBLE, entry_count);
+    const std::vector<double>    values         = ReadDataset<double>(file, "/" + channel + "/signals/value",      H5T_NATIVE_DOUBLE, entry_count);
+    const std::vector<double>    xs             = ReadDataset<double>(file, "/" + channel + "/signals/position.x", H5T_NATIVE_DOUBLE, entry_count);
+    const std::vector<double>    ys             = ReadDataset<double>(file, "/" + channel + "/signals/position.y", H5T_NATIVE_DOUBLE, entry_count);
+    ASSERT_EQ(entry_count, ys.size());
+
+    for (size_t i = 0; i < entry_count; ++i)
+    {
+      EXPECT_EQ(static_cast<long long>(i) * 1000,     snd_timestamps[i]);
+      EXPECT_EQ(static_cast<long long>(i) * 1000 + 1, rcv_timestamps[i]);
+
+      if ((channel == "first") && (i == malformed_entry))
+      {
+        // all signals of a malformed message are NaN
+        EXPECT_TRUE(std::isnan(ids[i]));
+        EXPECT_TRUE(std::isnan(values[i]));
+        EXPECT_TRUE(std::isnan(xs[i]));
+        EXPECT_TRUE(std::isnan(ys[i]));
+        continue;
+      }
+
+      EXPECT_EQ(static_cast<double>(i + 1),  ids[i]);
+      EXPECT_EQ(i * 0.5,                     values[i]);
+      EXPECT_EQ((i + 1) * 10.0,              xs[i]);
+      EXPECT_EQ((i + 1) * -10.0,             ys[i]);
+    }
+  }
+
+  H5Fclose(file);
+}
+
+TEST(MeasExport, ExportSelectedSignals)
+{
+  const std::string meas_dir    = "meas_export_test_selected";
+  const size_t      entry_count = 5;
+  WriteMeasurement(meas_dir, entry_count);
+
+  eCAL::eh5::HDF5Meas measurement(meas_dir);
+  ASSERT_TRUE(measurement.IsOk());
+
+  {
+    ColumnFile file;
+    ASSERT_TRUE(file.Open(export_file));
+
+    ChannelExporter  exporter(measurement, file, ExportSettings());
+    ExportStatistics statistics;
+    std::string      error;
+    ASSERT_TRUE(exporter.Export("second", { "position.y" }, statistics, error)) << error;
+    EXPECT_EQ(1u, statistics.signals);
+
+    // unknown signal paths are rejected
+    EXPECT_FALSE(exporter.Export("first", { "position.z" }, statistics, error));
+  }
+
+  const hid_t file = H5Fopen(export_file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  ASSERT_GE(file, 0);
+
+  const std::vector<double> ys = ReadDataset<double>(file, "/second/signals/position.y", H5T_NATIVE_DOUBLE, entry_count);
+  ASSERT_EQ(entry_count, ys.size());
+  for (size_t i = 0; i < entry_count; ++i) EXPECT_EQ((i + 1) * -10.0, ys[i]);
+
+  EXPECT_LT(H5Lexists(file, "/second/signals/id", H5P_DEFAULT), 1);
+  H5Fclose(file);
+}
@@ -0,0 +1,309 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Parallel export of the signals of recorded protobuf channels
+**/
+
+#include "channel_exporter.h"
+
+#include <ecal/protobuf/ecal_proto_dyn.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+namespace
+{
+  const std::string g_proto_prefix = "proto:";
+
+  // the workers take the messages in batches, so that they do not write to the same cache lines
+  const size_t g_decode_batch = 64;
+
+  void AddSignals(const google::protobuf::Descriptor* descriptor_, const std::string& prefix_, std::vector<const google::protobuf::Descriptor*>& parents_, std::vector<std::string>& signals_)
+  {
+    // recursive message types are followed only once
+    if (std::find(parents_.begin(), parents_.end(), descriptor_) != parents_.end()) return;
+    parents_.push_back(descriptor_);
+
+    for (int i = 0; i < descriptor_->field_count(); ++i)
+    {
+      const google::protobuf::FieldDescriptor* field = descriptor_->field(i);
+      if (field->is_repeated()) continue;
+
+      const std::string path = prefix_ + field->name();
+      switch (field->cpp_type())
+      {
+      case google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE:
+        AddSignals(field->message_type(), path + ".", parents_, signals_);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+        break;
+      default:
+        signals_.push_back(path);
+        break;
+      }
+    }
+
+    parents_.pop_back();
+  }
+}
+
+ChannelExporter::ChannelExporter(const eCAL::eh5::HDF5Meas& measurement_, ColumnFile& file_, const ExportSettings& settings_) :
+  m_measurement(measurement_),
+  m_file(file_),
+  m_settings(settings_),
+  m_decode_extractor(nullptr),
+  m_decode_block(nullptr),
+  m_decode_generation(0),
+  m_busy_workers(0),
+  m_stop_workers(false)
+{
+  m_settings.thread_count = std::max(m_settings.thread_count, 1);
+  m_settings.block_size   = std::max(m_settings.block_size, size_t(1));
+
+  for (int i = 0; i < m_settings.thread_count; ++i)
+  {
+    m_workers.emplace_back(&ChannelExporter::Work, this);
+  }
+}
+
+ChannelExporter::~ChannelExporter()
+{
+  {
+    const std::lock_guard<std::mutex> lock(m_decode_sync);
+    m_stop_workers = true;
+  }
+  m_decode_start_cv.notify_all();
+
+  for (auto& worker : m_workers) worker.join();
+}
+
+bool ChannelExporter::Export(const std::string& channel_, const std::vector<std::string>& paths_, ExportStatistics& statistics_, std::string& error_)
+{
+  statistics_ = ExportStatistics();
+
+  const std::string channel_type = m_measurement.GetChannelType(channel_);
+  if (channel_type.compare(0, g_proto_prefix.size(), g_proto_prefix) != 0)
+  {
+    error_ = "\"" + channel_type + "\" is no protobuf type";
+    return(false);
+  }
+
+  // the descriptor belongs to the pool of the decoder
+  eCAL::protobuf::CProtoDynDecoder decoder;
+  std::string error;
+  std::unique_ptr<google::protobuf::Message> message(decoder.GetProtoMessageFromDescriptor(m_measurement.GetChannelDescription(channel_), channel_type.substr(g_proto_prefix.size()), error));
+  if (!message)
+  {
+    error_ = error;
+    return(false);
+  }
+
+  const std::vector<std::string> signals = paths_.empty() ? CollectSignals(message->GetDescriptor()) : paths_;
+  if (signals.empty())
+  {
+    error_ = "no numeric signals";
+    return(false);
+  }
+
+  eCAL::protobuf::CProtoFieldExtractor extractor;
+  if (!extractor.Compile(message->GetDescriptor(), signals, error))
+  {
+    error_ = error;
+    return(false);
+  }
+
+  eCAL::eh5::EntryInfoSet entry_set;
+  if (!m_measurement.GetEntriesInfo(channel_, entry_set) || entry_set.empty())
+  {
+    error_ = "no entries";
+    return(false);
+  }
+  const eCAL::eh5::EntryInfoVect entries(entry_set.begin(), entry_set.end());
+
+  if (!m_file.CreateChannel(channel_, signals, entries.size(), m_settings.block_size, m_settings.compression))
+  {
+    error_ = "could not create the datasets";
+    return(false);
+  }
+
+  statistics_.signals = signals.size();
+
+  // one block is decoded while the other one is written and refilled
+  SBlock blocks[2];
+  for (auto& block : blocks) block.columns.resize(signals.size() * m_settings.block_size);
+
+  bool    success(true);
+  SBlock* decoding(nullptr);
+  size_t  current(0);
+  for (size_t offset = 0; offset < entries.size(); offset += m_settings.block_size)
+  {
+    SBlock& block = blocks[current];
+    if (!ReadBlock(entries, offset, block))
+    {
+      error_  = "could not read the entries";
+      success = false;
+      break;
+    }
+
+    WaitForDecoding();
+    StartDecoding(extractor, block);
+
+    if (decoding != nullptr)
+    {
+      statistics_.messages  += decoding->count;
+      statistics_.malformed += decoding->malformed;
+      if (!WriteBlock(*decoding, signals.size()))
+      {
+        error_  = "could not write the signals";
+        success = false;
+        break;
+      }
+    }
+
+    decoding = &block;
+    current  = 1 - current;
+  }
+
+  WaitForDecoding();
+
+  if (success && (decoding != nullptr))
+  {
+    statistics_.messages  += decoding->count;
+    statistics_.malformed += decoding->malformed;
+    if (!WriteBlock(*decoding, signals.size()))
+    {
+      error_  = "could not write the signals";
+      success = false;
+    }
+  }
+
+  m_file.CloseChannel();
+  return(success);
+}
+
+std::vector<std::string> ChannelExporter::CollectSignals(const google::protobuf::Descriptor* descriptor_)
+{
+  std::vector<std::string> signals;
+  std::vector<const google::protobuf::Descriptor*> parents;
+  if (descriptor_ != nullptr) AddSignals(descriptor_, "", parents, signals);
+  return(signals);
+}
+
+bool ChannelExporter::ReadBlock(const eCAL::eh5::EntryInfoVect& entries_, size_t offset_, SBlock& block_)
+{
+  block_.offset = offset_;
+  block_.count  = std::min(m_settings.block_size, entries_.size() - offset_);
+  block_.messages.resize(m_settings.block_size);
+  block_.rcv_timestamps.resize(m_settings.block_size);
+  block_.snd_timestamps.resize(m_settings.block_size);
+
+  for (size_t i = 0; i < block_.count; ++i)
+  {
+    const auto& entry = entries_[offset_ + i];
+    block_.rcv_timestamps[i] = entry.RcvTimestamp;
+    block_.snd_timestamps[i] = entry.SndTimestamp;
+
+    size_t size(0);
+    if (!m_measurement.GetEntryDataSize(entry.ID, size)) return(false);
+
+    std::string& message = block_.messages[i];
+    message.resize(size);
+    if ((size > 0) && !m_measurement.GetEntryData(entry.ID, &message[0])) return(false);
+  }
+
+  return(true);
+}
+
+void ChannelExporter::StartDecoding(const eCAL::protobuf::CProtoFieldExtractor& extractor_, SBlock& block_)
+{
+  block_.next      = 0;
+  block_.malformed = 0;
+
+  {
+    const std::lock_guard<std::mutex> lock(m_decode_sync);
+    m_decode_extractor = &extractor_;
+    m_decode_block     = &block_;
+    m_busy_workers     = static_cast<int>(m_workers.size());
+    m_decode_generation++;
+  }
+  m_decode_start_cv.notify_all();
+}
+
+void ChannelExporter::WaitForDecoding()
+{
+  std::unique_lock<std::mutex> lock(m_decode_sync);
+  m_decode_done_cv.wait(lock, [this] { return(m_busy_workers == 0); });
+}
+
+bool ChannelExporter::WriteBlock(const SBlock& block_, size_t signal_count_)
+{
+  std::vector<const double*> columns(signal_count_);
+  for (size_t s = 0; s < signal_count_; ++s) columns[s] = &block_.columns[s * m_settings.block_size];
+
+  return(m_file.WriteBlock(block_.offset, block_.count, block_.rcv_timestamps.data(), block_.snd_timestamps.data(), columns));
+}
+
+void ChannelExporter::Work()
+{
+  unsigned long long generation(0);
+  for (;;)
+  {
+    const eCAL::protobuf::CProtoFieldExtractor* extractor(nullptr);
+    SBlock*                                     block(nullptr);
+    {
+      std::unique_lock<std::mutex> lock(m_decode_sync);
+      m_decode_start_cv.wait(lock, [this, generation] { return(m_stop_workers || (m_decode_generation != generation)); });
+      if (m_stop_workers) return;
+
+      generation = m_decode_generation;
+      extractor  = m_decode_extractor;
+      block      = m_decode_block;
+    }
+
+    Decode(*extractor, *block, m_settings.block_size);
+
+    {
+      const std::lock_guard<std::mutex> lock(m_decode_sync);
+      if (--m_busy_workers == 0) m_decode_done_cv.notify_all();
+    }
+  }
+}
+
+void ChannelExporter::Decode(const eCAL::protobuf::CProtoFieldExtractor& extractor_, SBlock& block_, size_t block_size_)
+{
+  std::vector<double> values;
+  for (size_t begin = block_.next.fetch_add(g_decode_batch); begin < block_.count; begin = block_.next.fetch_add(g_decode_batch))
+  {
+    const size_t end = std::min(begin + g_decode_batch, block_.count);
+    for (size_t i = begin; i < end; ++i)
+    {
+      const std::string& message = block_.messages[i];
+      if (!extractor_.Extract(message.data(), message.size(), values))
+      {
+        // partially decoded values of malformed messages are dropped
+        values.assign(values.size(), std::numeric_limits<double>::quiet_NaN());
+        block_.malformed++;
+      }
+
+      for (size_t s = 0; s < values.size(); ++s) block_.columns[s * block_size_ + i] = values[s];
+    }
+  }
+}
@@ -0,0 +1,122 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Parallel export of the signals of recorded protobuf channels
+**/
+
+#pragma once
+
+#include <ecal/protobuf/ecal_proto_field_extractor.h>
+#include <ecalhdf5/eh5_meas.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "column_file.h"
+
+struct ExportSettings
+{
+  ExportSettings() : thread_count(1), block_size(4096), compression(0) {}
+
+  int     thread_count;  // number of decoding threads
+  size_t  block_size;    // number of messages read, decoded and written at once
+  int     compression;   // deflate level of the datasets, 0 = uncompressed
+};
+
+struct ExportStatistics
+{
+  ExportStatistics() : signals(0), messages(0), malformed(0) {}
+
+  size_t  signals;
+  size_t  messages;
+  size_t  malformed;
+};
+
+/**
+ * @brief Exports the numeric signals of protobuf channels into a column file.
+ *
+ * All HDF5 calls (reading the measurement and writing the column file) are
+ * made by the calling thread. Without a thread-safe HDF5 library (see
+ * eCAL::eh5::HDF5Meas::IsThreadSafe) they must not run in parallel, and a
+ * thread-safe build serializes them with a global lock anyway. The messages
+ * are decoded block by block by the worker threads, while the calling thread
+ * writes the previous block and reads the next one.
+ *
+ * The worker threads are started once and decode the blocks of all exported
+ * channels.
+**/
+class ChannelExporter
+{
+public:
+  ChannelExporter(const eCAL::eh5::HDF5Meas& measurement_, ColumnFile& file_, const ExportSettings& settings_);
+  ~ChannelExporter();
+
+  ChannelExporter(const ChannelExporter&) = delete;
+  ChannelExporter& operator=(const ChannelExporter&) = delete;
+
+  // exports the given signal paths of the channel, or all signals if paths_ is empty
+  bool Export(const std::string& channel_, const std::vector<std::string>& paths_, ExportStatistics& statistics_, std::string& error_);
+
+  // the numeric fields reachable through single (non repeated) fields
+  static std::vector<std::string> CollectSignals(const google::protobuf::Descriptor* descriptor_);
+
+private:
+  struct SBlock
+  {
+    SBlock() : offset(0), count(0), next(0), malformed(0) {}
+
+    size_t                    offset;
+    size_t                    count;
+    std::vector<std::string>  messages;  // the buffers are reused from block to block
+    std::vector<long long>    rcv_timestamps;
+    std::vector<long long>    snd_timestamps;
+    std::vector<double>       columns;   // one array of block_size values per signal
+
+    std::atomic<size_t>       next;
+    std::atomic<size_t>       malformed;
+  };
+
+  bool ReadBlock(const eCAL::eh5::EntryInfoVect& entries_, size_t offset_, SBlock& block_);
+  void StartDecoding(const eCAL::protobuf::CProtoFieldExtractor& extractor_, SBlock& block_);
+  void WaitForDecoding();
+  bool WriteBlock(const SBlock& block_, size_t signal_count_);
+
+  void Work();
+  static void Decode(const eCAL::protobuf::CProtoFieldExtractor& extractor_, SBlock& block_, size_t block_size_);
+
+  const eCAL::eh5::HDF5Meas&  m_measurement;
+  ColumnFile&                 m_file;
+  ExportSettings              m_settings;
+
+  // the block that is currently decoded, a new generation wakes up the workers
+  std::mutex                                    m_decode_sync;
+  std::condition_variable                       m_decode_start_cv;
+  std::condition_variable                       m_decode_done_cv;
+  const eCAL::protobuf::CProtoFieldExtractor*   m_decode_extractor;
+  SBlock*                                       m_decode_block;
+  unsigned long long                            m_decode_generation;
+  int                                           m_busy_workers;
+  bool                                          m_stop_workers;
+  std::vector<std::thread>                      m_workers;
+};
@@ -0,0 +1,147 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Columnar HDF5 output of the exported signals
+**/
+
+#include "column_file.h"
+
+#include <algorithm>
+
+ColumnFile::ColumnFile() :
+  m_file(H5I_INVALID_HID),
+  m_rcv_timestamps(H5I_INVALID_HID),
+  m_snd_timestamps(H5I_INVALID_HID)
+{
+}
+
+ColumnFile::~ColumnFile()
+{
+  Close();
+}
+
+bool ColumnFile::Open(const std::string& path_)
+{
+  Close();
+  m_file = H5Fcreate(path_.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  return(m_file >= 0);
+}
+
+void ColumnFile::Close()
+{
+  CloseChannel();
+  if (m_file >= 0) H5Fclose(m_file);
+  m_file = H5I_INVALID_HID;
+}
+
+bool ColumnFile::CreateChannel(const std::string& channel_, const std::vector<std::string>& signals_, size_t entry_count_, size_t chunk_size_, int compression_)
+{
+  CloseChannel();
+  if ((m_file < 0) || (entry_count_ == 0)) return(false);
+
+  // channel names like "/vehicle/odometry" become nested groups
+  auto link_property = H5Pcreate(H5P_LINK_CREATE);
+  H5Pset_create_intermediate_group(link_property, 1);
+  auto channel_group = H5Gcreate(m_file, channel_.c_str(), link_property, H5P_DEFAULT, H5P_DEFAULT);
+  auto signal_group  = (channel_group >= 0) ? H5Gcreate(channel_group, "signals", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) : H5I_INVALID_HID;
+  H5Pclose(link_property);
+
+  //  the blocks are written chunk by chunk, compression requires a chunked layout anyway
+  auto ds_property = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_obj_track_times(ds_property, false);
+  const hsize_t chunk_size = std::max<hsize_t>(1, std::min(chunk_size_, entry_count_));
+  H5Pset_chunk(ds_property, 1, &chunk_size);
+  if ((compression_ > 0) && (H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0))
+  {
+    H5Pset_deflate(ds_property, static_cast<unsigned int>(std::min(compression_, 9)));
+  }
+
+  bool success = (signal_group >= 0);
+  if (success)
+  {
+    m_rcv_timestamps = CreateDataset(channel_group, "rcv_timestamp", H5T_NATIVE_LLONG, entry_count_, ds_property);
+    m_snd_timestamps = CreateDataset(channel_group, "snd_timestamp", H5T_NATIVE_LLONG, entry_count_, ds_property);
+    success = (m_rcv_timestamps >= 0) && (m_snd_timestamps >= 0);
+
+    for (const auto& signal : signals_)
+    {
+      if (!success) break;
+      m_signals.push_back(CreateDataset(signal_group, signal, H5T_NATIVE_DOUBLE, entry_count_, ds_property));
+      success = (m_signals.back() >= 0);
+    }
+  }
+
+  H5Pclose(ds_property);
+  if (signal_group >= 0)  H5Gclose(signal_group);
+  if (channel_group >= 0) H5Gclose(channel_group);
+
+  if (!success) CloseChannel();
+  return(success);
+}
+
+bool ColumnFile::WriteBlock(size_t offset_, size_t count_, const long long* rcv_timestamps_, const long long* snd_timestamps_, const std::vector<const double*>& columns_)
+{
+  if ((m_rcv_timestamps < 0) || (columns_.size() != m_signals.size())) return(false);
+
+  bool success = WriteColumn(m_rcv_timestamps, H5T_NATIVE_LLONG, offset_, count_, rcv_timestamps_)
+              && WriteColumn(m_snd_timestamps, H5T_NATIVE_LLONG, offset_, count_, snd_timestamps_);
+  for (size_t i = 0; success && (i < m_signals.size()); ++i)
+  {
+    success = WriteColumn(m_signals[i], H5T_NATIVE_DOUBLE, offset_, count_, columns_[i]);
+  }
+  return(success);
+}
+
+void ColumnFile::CloseChannel()
+{
+  for (auto dataset : m_signals) if (dataset >= 0) H5Dclose(dataset);
+  m_signals.clear();
+
+  if (m_rcv_timestamps >= 0) H5Dclose(m_rcv_timestamps);
+  if (m_snd_timestamps >= 0) H5Dclose(m_snd_timestamps);
+  m_rcv_timestamps = H5I_INVALID_HID;
+  m_snd_timestamps = H5I_INVALID_HID;
+}
+
+hid_t ColumnFile::CreateDataset(hid_t location_, const std::string& name_, hid_t type_, size_t entry_count_, hid_t property_)
+{
+  const hsize_t size = entry_count_;
+  auto data_space = H5Screate_simple(1, &size, nullptr);
+  auto data_set   = H5Dcreate(location_, name_.c_str(), type_, data_space, H5P_DEFAULT, property_, H5P_DEFAULT);
+  H5Sclose(data_space);
+  return(data_set);
+}
+
+bool ColumnFile::WriteColumn(hid_t dataset_, hid_t type_, size_t offset_, size_t count_, const void* data_)
+{
+  if (count_ == 0) return(true);
+
+  const hsize_t offset = offset_;
+  const hsize_t count  = count_;
+
+  auto file_space   = H5Dget_space(dataset_);
+  auto memory_space = H5Screate_simple(1, &count, nullptr);
+  herr_t status = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, &offset, nullptr, &count, nullptr);
+  if (status >= 0) status = H5Dwrite(dataset_, type_, memory_space, file_space, H5P_DEFAULT, data_);
+  H5Sclose(memory_space);
+  H5Sclose(file_space);
+
+  return(status >= 0);
+}
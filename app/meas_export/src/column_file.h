@@ -0,0 +1,69 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Columnar HDF5 output of the exported signals
+**/
+
+#pragma once
+
+#include <hdf5.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Writes the signals of every channel as one dataset per signal.
+ *
+ * Layout of the file:
+ *   /<channel>/rcv_timestamp       int64, receive time stamps of the messages
+ *   /<channel>/snd_timestamp       int64, send time stamps of the messages
+ *   /<channel>/signals/<path>      float64, one value per message, NaN if the field was not present
+ *
+ * The datasets are created with their final size and filled block by block.
+**/
+class ColumnFile
+{
+public:
+  ColumnFile();
+  ~ColumnFile();
+
+  ColumnFile(const ColumnFile&) = delete;
+  ColumnFile& operator=(const ColumnFile&) = delete;
+
+  bool Open(const std::string& path_);
+  void Close();
+
+  // creates the datasets of a channel, compression_ is the deflate level (0 = uncompressed)
+  bool CreateChannel(const std::string& channel_, const std::vector<std::string>& signals_, size_t entry_count_, size_t chunk_size_, int compression_);
+
+  // writes count_ entries starting at offset_, columns_ holds one array per signal
+  bool WriteBlock(size_t offset_, size_t count_, const long long* rcv_timestamps_, const long long* snd_timestamps_, const std::vector<const double*>& columns_);
+
+  void CloseChannel();
+
+private:
+  hid_t CreateDataset(hid_t location_, const std::string& name_, hid_t type_, size_t entry_count_, hid_t property_);
+  bool  WriteColumn(hid_t dataset_, hid_t type_, size_t offset_, size_t count_, const void* data_);
+
+  hid_t               m_file;
+  hid_t               m_rcv_timestamps;
+  hid_t               m_snd_timestamps;
+  std::vector<hid_t>  m_signals;
+};
@@ -0,0 +1,165 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief eCALMeasExport Console Application
+ *
+ * Exports the numeric signals of the protobuf channels of a measurement into
+ * an HDF5 file with one dataset per signal, e.g. for the analysis with numpy,
+ * pandas or MATLAB. The messages are decoded straight from the wire format
+ * on all cores.
+**/
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+#include "channel_exporter.h"
+#include "column_file.h"
+
+int main(int argc, char** argv)
+{
+  std::string                                      input_path;
+  std::string                                      output_file;
+  std::set<std::string>                            channels;
+  std::map<std::string, std::vector<std::string>>  signals;
+  ExportSettings                                   settings;
+
+  try
+  {
+    const int default_threads = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+
+    TCLAP::CmdLine cmd("eCALMeasExport");
+    TCLAP::ValueArg<std::string>      output_arg     ("o", "output",      "Exported HDF5 file.",                                                              false, "signals.h5",    "string");
+    TCLAP::MultiArg<std::string>      channel_arg    ("c", "channel",     "Channel to export with all its signals (default: all protobuf channels).",       false,                  "string");
+    TCLAP::MultiArg<std::string>      signal_arg     ("s", "signal",      "Signal to export as <channel>:<path>, e.g. \"scene:objects[0].position.x\".",      false,                  "string");
+    TCLAP::ValueArg<int>              jobs_arg       ("j", "jobs",        "Number of decoding threads.",                                                      false, default_threads, "int");
+    TCLAP::ValueArg<int>              block_arg      ("b", "block-size",  "Number of messages decoded at once.",                                              false, 4096,            "int");
+    TCLAP::ValueArg<int>              compression_arg("z", "compression", "Deflate level of the datasets (0 = uncompressed, 1 - 9).",                         false, 0,               "int");
+    TCLAP::UnlabeledValueArg<std::string> input_arg  ("input", "Measurement directory or HDF5 file.",                                                        true,  "",              "string");
+    cmd.add(output_arg);
+    cmd.add(channel_arg);
+    cmd.add(signal_arg);
+    cmd.add(jobs_arg);
+    cmd.add(block_arg);
+    cmd.add(compression_arg);
+    cmd.add(input_arg);
+    cmd.parse(argc, argv);
+
+    input_path  = input_arg.getValue();
+    output_file = output_arg.getValue();
+
+    for (const auto& channel : channel_arg.getValue()) channels.insert(channel);
+    for (const auto& signal : signal_arg.getValue())
+    {
+      // the paths never contain a colon, the channel names may
+      const size_t separator = signal.rfind(':');
+      if ((separator == std::string::npos) || (separator == 0) || (separator + 1 == signal.size()))
+      {
+        std::cerr << "error: invalid signal \"" << signal << "\", expected <channel>:<path>" << std::endl;
+        return EXIT_FAILURE;
+      }
+      signals[signal.substr(0, separator)].push_back(signal.substr(separator + 1));
+    }
+
+    settings.thread_count = std::max(jobs_arg.getValue(), 1);
+    settings.block_size   = static_cast<size_t>(std::max(block_arg.getValue(), 1));
+    settings.compression  = std::min(std::max(compression_arg.getValue(), 0), 9);
+  }
+  catch (TCLAP::ArgException& e)
+  {
+    std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  eCAL::eh5::HDF5Meas measurement(input_path);
+  if (!measurement.IsOk())
+  {
+    std::cerr << "Could not open measurement " << input_path << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const std::set<std::string> measurement_channels = measurement.GetChannelNames();
+
+  // selected signals of a channel are exported only, unless the whole channel is selected as well
+  std::map<std::string, std::vector<std::string>> exports;
+  if (channels.empty() && signals.empty())
+  {
+    for (const auto& channel : measurement_channels)
+    {
+      if (measurement.GetChannelType(channel).compare(0, 6, "proto:") == 0) exports[channel];
+    }
+  }
+  for (const auto& channel : channels) exports[channel];
+  for (const auto& signal : signals)
+  {
+    if (channels.count(signal.first) == 0) exports[signal.first] = signal.second;
+  }
+
+  ColumnFile file;
+  if (!file.Open(output_file))
+  {
+    std::cerr << "Could not create " << output_file << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  ChannelExporter exporter(measurement, file, settings);
+
+  size_t failed(0);
+  for (const auto& channel : exports)
+  {
+    if (measurement_channels.count(channel.first) == 0)
+    {
+      std::cerr << "Channel " << channel.first << " is not part of the measurement" << std::endl;
+      failed++;
+      continue;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    ExportStatistics statistics;
+    std::string      error;
+    if (!exporter.Export(channel.first, channel.second, statistics, error))
+    {
+      std::cerr << "Could not export channel " << channel.first << ": " << error << std::endl;
+      failed++;
+      continue;
+    }
+
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    std::cout << "Exported " << statistics.signals << " signals of " << statistics.messages << " messages of channel " << channel.first
+              << " in " << std::fixed << std::setprecision(2) << duration.count() << " s";
+    if (statistics.malformed > 0) std::cout << " (" << statistics.malformed << " malformed messages)";
+    std::cout << std::endl;
+  }
+
+  file.Close();
+
+  std::cout << "Exported " << exports.size() - failed << " of " << exports.size() << " channels into " << output_file << std::endl;
+
+  return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -64,6 +64,7 @@
 
 Ecalmon::Ecalmon(QWidget *parent)
   : QMainWindow(parent)
+  , monitor_update_pending_(false)
   , first_show_event_(true)
   , monitor_error_counter_(0)
 {
@@ -164,15 +165,25 @@ Ecalmon::Ecalmon(QWidget *parent)
   ui_.raw_monitoring_data_dockwidget_content_frame_layout->addWidget(raw_monitoring_data_widget_);
   ui_.system_information_dockwidget_content_frame_layout ->addWidget(syste_information_widget_);
 
+  // The monitoring information is acquired and diffed in a background thread
+  qRegisterMetaType<MonitoringSnapshotPtr>("MonitoringSnapshotPtr");
+  monitor_update_thread_ = new QThread(this);
+  monitor_update_worker_ = new MonitorUpdateWorker();
+  monitor_update_worker_->moveToThread(monitor_update_thread_);
+  connect(monitor_update_thread_, &QThread::finished,                   monitor_update_worker_, &QObject::deleteLater);
+  connect(monitor_update_worker_, &MonitorUpdateWorker::monitorUpdated,      this,          &Ecalmon::monitorSnapshotReceived);
+  connect(monitor_update_worker_, &MonitorUpdateWorker::monitorUpdateFailed, this,          &Ecalmon::monitorSnapshotFailed);
+  monitor_update_thread_->start();
+
   monitor_update_timer_ = new QTimer(this);
   connect(monitor_update_timer_, &QTimer::timeout, [this](){updateMonitor();});
   monitor_update_timer_->start(1000);
 
 
-  connect(this, &Ecalmon::monitorUpdatedSignal, [this](eCAL::pb::Monitoring monitoring_pb) {topic_widget_  ->monitorUpdated(monitoring_pb);});
-  connect(this, &Ecalmon::monitorUpdatedSignal, [this](eCAL::pb::Monitoring monitoring_pb) {process_widget_->monitorUpdated(monitoring_pb); });
-  connect(this, &Ecalmon::monitorUpdatedSignal, [this](eCAL::pb::Monitoring monitoring_pb) {host_widget_   ->monitorUpdated(monitoring_pb); });
-  connect(this, &Ecalmon::monitorUpdatedSignal, [this](eCAL::pb::Monitoring monitoring_pb) {service_widget_->monitorUpdated(monitoring_pb); });
+  connect(this, &Ecalmon::monitorUpdatedSignal, topic_widget_,   &TopicWidget::monitorUpdated);
+  connect(this, &Ecalmon::monitorUpdatedSignal, process_widget_, &ProcessWidget::monitorUpdated);
+  connect(this, &Ecalmon::monitorUpdatedSignal, host_widget_,    &HostWidget::monitorUpdated);
+  connect(this, &Ecalmon::monitorUpdatedSignal, service_widget_, &ServiceWidget::monitorUpdated);
 
   // Monitor Update Speed selection
   monitor_update_speed_group_ = new QActionGroup(this);
@@ -279,8 +290,6 @@ Ecalmon::Ecalmon(QWidget *parent)
   // Dock widgets in view menu
   createDockWidgetMenu();
 
-  connect(this, &Ecalmon::monitorUpdatedSignal, [this](eCAL::pb::Monitoring monitoring_pb){topic_widget_->monitorUpdated(monitoring_pb);});
-
   ui_.action_monitor_refresh_speed_1s->trigger();
 
   PluginManager::getInstance()->discover();
@@ -324,6 +333,10 @@ void Ecalmon::createVisualizationDockWidget(const QString& topic_name, const QSt
 
 Ecalmon::~Ecalmon()
 {
+  // The worker uses the eCAL API, so it has to be stopped before finalizing eCAL
+  monitor_update_thread_->quit();
+  monitor_update_thread_->wait();
+
   eCAL::Finalize();
 }
 
@@ -340,36 +353,45 @@ void Ecalmon::showEvent(QShowEvent* /*event*/)
 
 void Ecalmon::updateMonitor()
 {
+  // Skip this update, if the previous one has not been finished, yet
+  if (monitor_update_pending_)
+    return;
+
 #ifndef NDEBUG
   qDebug().nospace() << "[" << metaObject()->className() << "] Updating monitor";
 #endif // NDEBUG
-  std::string monitoring_string;
-  eCAL::pb::Monitoring monitoring_pb;
+  monitor_update_pending_ = true;
+  QMetaObject::invokeMethod(monitor_update_worker_, "updateMonitor", Qt::QueuedConnection);
+}
 
-  if (eCAL::Monitoring::GetMonitoring(monitoring_string) && !monitoring_string.empty() && monitoring_pb.ParseFromString(monitoring_string))
-  {
-    monitor_error_counter_ = 0;
-    if (error_label_->isVisible())
-    {
-      error_label_->setHidden(true);
-    }
+void Ecalmon::monitorSnapshotReceived(MonitoringSnapshotPtr snapshot)
+{
+  monitor_update_pending_ = false;
 
-    emit monitorUpdatedSignal(monitoring_pb);
+  monitor_error_counter_ = 0;
+  if (error_label_->isVisible())
+  {
+    error_label_->setHidden(true);
   }
-  else
+
+  emit monitorUpdatedSignal(snapshot);
+}
+
+void Ecalmon::monitorSnapshotFailed()
+{
+  monitor_update_pending_ = false;
+
+  monitor_error_counter_++;
+  error_label_->setText("  Error getting Monitoring Information [" + QString::number(monitor_error_counter_) + "]  ");
+  if (!error_label_->isVisible())
   {
-    monitor_error_counter_++;
-    error_label_->setText("  Error getting Monitoring Information [" + QString::number(monitor_error_counter_) + "]  ");
-    if (!error_label_->isVisible())
-    {
-      error_label_->setHidden(false);
-    }
+    error_label_->setHidden(false);
+  }
 
 #ifndef NDEBUG
-    qDebug().nospace() << "[" << metaObject()->className() << "Error getting Monitoring Information";
+  qDebug().nospace() << "[" << metaObject()->className() << "Error getting Monitoring Information";
 #endif // NDEBUG
-    eCAL::Logging::Log(eCAL_Logging_eLogLevel::log_level_error, "Error getting eCAL Monitoring information");
-  }
+  eCAL::Logging::Log(eCAL_Logging_eLogLevel::log_level_error, "Error getting eCAL Monitoring information");
 }
 
 
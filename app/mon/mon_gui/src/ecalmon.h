@@ -21,6 +21,7 @@
 
 #include <QtWidgets/QMainWindow>
 #include <QTimer>
+#include <QThread>
 #include <QActionGroup>
 
 #include "ui_main_window.h"
@@ -33,6 +34,9 @@
 #include "widgets/raw_monitoring_data_widget/raw_monitoring_data_widget.h"
 #include "widgets/system_information_widget/system_information_widget.h"
 
+#include "monitor_update_worker.h"
+#include "monitoring_snapshot.h"
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable: 4100 4127 4146 4505 4800 4189 4592) // disable proto warnings
@@ -78,8 +82,11 @@ private slots:
   void createVisualizationDockWidget(const QString& topic_name, const QString& topic_type, const QString& iid, const QString& object_name = QString());
   void updateEcalTime();
 
+  void monitorSnapshotReceived(MonitoringSnapshotPtr snapshot);
+  void monitorSnapshotFailed();
+
 signals:
-  void monitorUpdatedSignal(const eCAL::pb::Monitoring&);
+  void monitorUpdatedSignal(const MonitoringSnapshotPtr&);
 
 protected:
   void closeEvent(QCloseEvent *event) override;
@@ -107,6 +114,10 @@ private:
   QTimer* monitor_update_timer_;
   QTimer* ecal_time_update_timer_;
 
+  QThread*             monitor_update_thread_;                                  /**< Thread for getting, parsing and diffing the monitoring information */
+  MonitorUpdateWorker* monitor_update_worker_;                                  /**< Lives in the monitor_update_thread_ */
+  bool                 monitor_update_pending_;                                 /**< True while the worker is busy, so slow updates do not pile up */
+
   QActionGroup*  monitor_update_speed_group_;
   QActionGroup*  log_update_speed_group_;
   QActionGroup*  theme_action_group_;
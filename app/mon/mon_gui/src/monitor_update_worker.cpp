@@ -0,0 +1,83 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "monitor_update_worker.h"
+
+#include <ecal/ecal.h>
+
+MonitorUpdateWorker::MonitorUpdateWorker(QObject* parent)
+  : QObject(parent)
+  , sequence_(0)
+{}
+
+MonitorUpdateWorker::~MonitorUpdateWorker()
+{}
+
+void MonitorUpdateWorker::updateMonitor()
+{
+  std::string monitoring_string;
+  auto snapshot = std::make_shared<MonitoringSnapshot>();
+
+  if (!eCAL::Monitoring::GetMonitoring(monitoring_string) || monitoring_string.empty() || !snapshot->monitoring_pb.ParseFromString(monitoring_string))
+  {
+    emit monitorUpdateFailed();
+    return;
+  }
+
+  diff(snapshot->monitoring_pb.topics()
+      , [](const eCAL::pb::Topic& topic) { return topic.tid(); }
+      , topics_
+      , snapshot->topic_changed);
+
+  diff(snapshot->monitoring_pb.processes()
+      , [](const eCAL::pb::Process& process) { return std::to_string(process.pid()) + "@" + process.hname(); }
+      , processes_
+      , snapshot->process_changed);
+
+  diff(snapshot->monitoring_pb.services()
+      , [](const eCAL::pb::Service& service) { return std::to_string(service.pid()) + "@" + service.hname() + "@" + service.sname() + "@" + service.sid(); }
+      , services_
+      , snapshot->service_changed);
+
+  snapshot->sequence = ++sequence_;
+
+  emit monitorUpdated(snapshot);
+}
+
+template <typename EntityT, typename KeyFunctionT>
+void MonitorUpdateWorker::diff(const google::protobuf::RepeatedPtrField<EntityT>& entities, KeyFunctionT key_function, SerializedEntityMapT& previous_entities, std::vector<bool>& changed)
+{
+  // Only entities of the current snapshot are kept, so removed entities are forgotten
+  SerializedEntityMapT current_entities;
+  current_entities.reserve(entities.size());
+
+  changed.reserve(entities.size());
+  for (const auto& entity : entities)
+  {
+    const std::string key        = key_function(entity);
+    const std::string serialized = entity.SerializeAsString();
+
+    auto previous_entity = previous_entities.find(key);
+    changed.push_back((previous_entity == previous_entities.end()) || (previous_entity->second != serialized));
+
+    current_entities[key] = serialized;
+  }
+
+  previous_entities.swap(current_entities);
+}
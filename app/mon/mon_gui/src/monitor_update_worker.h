@@ -0,0 +1,61 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <QObject>
+
+#include "monitoring_snapshot.h"
+
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Acquires the monitoring information and computes the changes to the previous snapshot.
+ *
+ * The worker is meant to live in its own thread, so getting, parsing and
+ * diffing the monitoring information does not block the GUI thread. Trigger
+ * an update by invoking updateMonitor() with a queued connection.
+ */
+class MonitorUpdateWorker : public QObject
+{
+  Q_OBJECT
+
+public:
+  MonitorUpdateWorker(QObject* parent = nullptr);
+  ~MonitorUpdateWorker();
+
+public slots:
+  void updateMonitor();
+
+signals:
+  void monitorUpdated(MonitoringSnapshotPtr snapshot);
+  void monitorUpdateFailed();
+
+private:
+  typedef std::unordered_map<std::string, std::string> SerializedEntityMapT;    /**< entity key -> serialized entity of the previous snapshot */
+
+  unsigned long long   sequence_;
+  SerializedEntityMapT topics_;
+  SerializedEntityMapT processes_;
+  SerializedEntityMapT services_;
+
+  template <typename EntityT, typename KeyFunctionT>
+  static void diff(const google::protobuf::RepeatedPtrField<EntityT>& entities, KeyFunctionT key_function, SerializedEntityMapT& previous_entities, std::vector<bool>& changed);
+};
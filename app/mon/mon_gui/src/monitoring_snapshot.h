@@ -0,0 +1,58 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <QMetaType>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4100 4127 4146 4505 4800 4189 4592) // disable proto warnings
+#endif
+#include <ecal/core/pb/monitoring.pb.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief A monitoring snapshot together with the information, which entities changed since the previous snapshot.
+ *
+ * Snapshots are created by the MonitorUpdateWorker in a background thread.
+ * The change flags are only valid for receivers that also got the previous
+ * snapshot, i.e. if the sequence number is the previous one + 1. Receivers
+ * that skipped snapshots have to treat all entities as changed.
+ */
+struct MonitoringSnapshot
+{
+  MonitoringSnapshot() : sequence(0) {}
+
+  eCAL::pb::Monitoring monitoring_pb;                                           /**< The complete monitoring information */
+  unsigned long long   sequence;                                                /**< Consecutive number of the snapshot */
+
+  std::vector<bool>    topic_changed;                                           /**< One entry for every topic of monitoring_pb, true if the topic is new or changed */
+  std::vector<bool>    process_changed;                                         /**< One entry for every process of monitoring_pb, true if the process is new or changed */
+  std::vector<bool>    service_changed;                                         /**< One entry for every service of monitoring_pb, true if the service is new or changed */
+};
+
+typedef std::shared_ptr<const MonitoringSnapshot> MonitoringSnapshotPtr;
+
+Q_DECLARE_METATYPE(MonitoringSnapshotPtr)
@@ -222,12 +222,37 @@ void EcalmonTreeWidget::setDefaultForcedColumn(int column)
 //// Slots controlled by the main application                               ////
 ////////////////////////////////////////////////////////////////////////////////
 
-void EcalmonTreeWidget::monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb)
+void EcalmonTreeWidget::monitorUpdated(const MonitoringSnapshotPtr& snapshot)
 {
-  emit topicsUpdated(monitoring_pb);
+  emit topicsUpdated(snapshot->monitoring_pb);
+
+  // Nobody would see the update of a hidden widget (e.g. an inactive tab),
+  // so we only remember the snapshot and apply it when we are shown again.
+  if (!isVisible())
+  {
+    pending_snapshot_ = snapshot;
+    return;
+  }
+
+  pending_snapshot_.reset();
   if (group_tree_model_)
   {
-    group_tree_model_->monitorUpdated(monitoring_pb);
+    group_tree_model_->monitorUpdated(*snapshot);
+  }
+}
+
+void EcalmonTreeWidget::showEvent(QShowEvent* event)
+{
+  QWidget::showEvent(event);
+
+  if (pending_snapshot_)
+  {
+    MonitoringSnapshotPtr snapshot = pending_snapshot_;
+    pending_snapshot_.reset();
+    if (group_tree_model_)
+    {
+      group_tree_model_->monitorUpdated(*snapshot);
+    }
   }
 }
 
@@ -35,6 +35,7 @@
 #endif
 
 #include "widgets/models/group_tree_model.h"
+#include "monitoring_snapshot.h"
 #include <CustomQt/QMulticolumnSortFilterProxyModel.h>
 
 class EcalmonTreeWidget : public QWidget
@@ -65,7 +66,7 @@ signals:
   void topicsUpdated(const eCAL::pb::Monitoring& monitoring_pb);
 
 public slots:
-  virtual void monitorUpdated(const eCAL::pb::Monitoring& enable);
+  virtual void monitorUpdated(const MonitoringSnapshotPtr& snapshot);
   void setAlternatingRowColors(bool alternating_colors_enabled);
   virtual void resetLayout();
 
@@ -78,6 +79,8 @@ private slots:
 protected:
   Ui::EcalmonTreeWidget ui_;
 
+  void showEvent(QShowEvent* event) override;
+
   virtual QModelIndex mapToSource(const QModelIndex& proxy_index) const;
   virtual QModelIndex mapFromSource(const QModelIndex& source_index) const;
 
@@ -108,6 +111,8 @@ private:
   int             default_forced_column_;                                       /**< The default forced column(-s) for the tree view. Used when grouping by nothing. */
   QMap<int, bool> autohidden_columns_visibility;                                /**< Contains information wether an autohidden column was visibile before (needed for restoring the state) */
 
+  MonitoringSnapshotPtr pending_snapshot_;                                      /**< The latest snapshot that has not been applied to the model, as the widget was hidden */
+
   QByteArray initial_tree_state_;
   int        initial_group_by_index_;
   bool       initial_show_all_checkbox_state_;
@@ -46,6 +46,7 @@ GroupTreeModel::GroupTreeModel(const QVector<int>& group_by_columns, QObject *pa
   : QAbstractTreeModel(parent)
   , group_column_header_("Group")
   , group_by_columns_(group_by_columns)
+  , last_snapshot_sequence_(0)
 {}
 
 GroupTreeModel::~GroupTreeModel()
@@ -108,6 +109,13 @@ void GroupTreeModel::setGroupByColumns(const QVector<int>& group_by_columns)
   setGroupColumnHeader(group_header);
 }
 
+bool GroupTreeModel::isIncrementalUpdate(const MonitoringSnapshot& snapshot)
+{
+  const bool incremental = (last_snapshot_sequence_ != 0) && (snapshot.sequence == last_snapshot_sequence_ + 1);
+  last_snapshot_sequence_ = snapshot.sequence;
+  return incremental;
+}
+
 QVector<int> GroupTreeModel::groupByColumns() const
 {
   return group_by_columns_;
@@ -31,6 +31,7 @@
 #endif
 
 #include "group_tree_item.h"
+#include "monitoring_snapshot.h"
 
 #include <QMap>
 #include <QVector>
@@ -56,13 +57,24 @@ public:
 
   QVector<QPair<int, QString>> getTreeItemColumnNameMapping() const;
 
-  virtual void monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb) = 0;
+  virtual void monitorUpdated(const MonitoringSnapshot& snapshot) = 0;
 
 protected:
   int mapColumnToItem(int model_column, int tree_item_type) const override;
 
   virtual int groupColumn() const = 0;
 
+  /**
+   * @brief Checks whether the change flags of the snapshot can be used
+   *
+   * The change flags are relative to the previous snapshot. If the model did
+   * not get the previous snapshot, all entities have to be updated.
+   *
+   * @param snapshot  The snapshot that is about to be applied
+   * @return True, if only the changed entities have to be updated
+   */
+  bool isIncrementalUpdate(const MonitoringSnapshot& snapshot);
+
 private:
   QMap<QVariant, GroupTreeItem*> group_map_;                                    /*< group_identifier -> TreeItem mapping*/
   QList<QAbstractTreeItem*> items_list_;
@@ -70,4 +82,6 @@ private:
   QVariant group_column_header_;
 
   QVector<int> group_by_columns_;
+
+  unsigned long long last_snapshot_sequence_;                                   /*< Sequence number of the last applied monitoring snapshot*/
 };
@@ -167,7 +167,7 @@ void HostTreeItem::update(const eCAL::pb::Monitoring& monitoring_pb)
   data_received_bytes_ = 0;
 
   // Fill variables with accumulated data
-  for (auto topic : monitoring_pb.topics())
+  for (const auto& topic : monitoring_pb.topics())
   {
     if (QString(topic.hname().c_str()).compare(host_name_, Qt::CaseSensitivity::CaseInsensitive) == 0)
     {
@@ -66,8 +66,10 @@ int HostTreeModel::groupColumn() const
   return (int)(Columns::GROUP);
 }
 
-void HostTreeModel::monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb)
+void HostTreeModel::monitorUpdated(const MonitoringSnapshot& snapshot)
 {
+  const auto& monitoring_pb = snapshot.monitoring_pb;
+
   // Create a list of all hosts to check if we have to remove them
   std::map<std::string, bool> host_still_existing;
   for(const auto& host : tree_item_map_)
@@ -88,8 +90,6 @@ void HostTreeModel::monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb)
     }
     else
     {
-      // Update an existing host
-      tree_item_map_.at(host_name)->update(monitoring_pb);
       host_still_existing[host_name] = true;
     }
   }
@@ -104,6 +104,12 @@ void HostTreeModel::monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb)
     }
   }
 
+  // Update the accumulated data of every host once, as it has to iterate over all topics
+  for (const auto& host : tree_item_map_)
+  {
+    host.second->update(monitoring_pb);
+  }
+
   updateAll();
 }
 
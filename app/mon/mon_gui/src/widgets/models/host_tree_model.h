@@ -64,7 +64,7 @@ public:
 
   QVector<QPair<int, QString>> getTreeItemColumnNameMapping() const;
 
-  void monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb) override;
+  void monitorUpdated(const MonitoringSnapshot& snapshot) override;
 
 protected:
   int mapColumnToItem(int model_column, int tree_item_type) const override;
@@ -21,6 +21,8 @@
 #include "tree_item_type.h"
 #include "item_data_roles.h"
 
+#include <unordered_set>
+
 ProcessTreeModel::ProcessTreeModel(QObject *parent)
   : GroupTreeModel(QVector<int>{}, parent)
 {}
@@ -66,46 +68,57 @@ int ProcessTreeModel::groupColumn() const
   return (int)(Columns::GROUP);
 }
 
-void ProcessTreeModel::monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb)
+void ProcessTreeModel::monitorUpdated(const MonitoringSnapshot& snapshot)
 {
-  // Create a list of all processes to check if we have to remove them
-  std::map<std::string, bool> process_still_existing;
-  for(const auto& process : tree_item_map_)
-  {
-    process_still_existing[process.first] = false;
-  }
+  // Unchanged processes only have to be updated, if we have missed a snapshot
+  const bool incremental = isIncrementalUpdate(snapshot);
+
+  const auto& processes = snapshot.monitoring_pb.processes();
+
+  std::unordered_set<std::string> existing_processes;
+  existing_processes.reserve(processes.size());
+
+  QList<QAbstractTreeItem*> updated_items;
 
-  for (const auto& process_pb : monitoring_pb.processes())
+  for (int i = 0; i < processes.size(); i++)
   {
+    const auto& process_pb = processes.Get(i);
+
     // Create a Process ID that is unique across all hosts
     std::string process_identifier = (std::to_string(process_pb.pid()) + "@" + process_pb.hname());
+    existing_processes.insert(process_identifier);
 
-    if (tree_item_map_.find(process_identifier) == tree_item_map_.end())
+    auto process_tree_item = tree_item_map_.find(process_identifier);
+    if (process_tree_item == tree_item_map_.end())
     {
       // Got a new process
-      ProcessTreeItem* process_tree_item = new ProcessTreeItem(process_pb);
-      insertItemIntoGroups(process_tree_item);
-      tree_item_map_[process_identifier] = process_tree_item;
+      ProcessTreeItem* new_process_tree_item = new ProcessTreeItem(process_pb);
+      insertItemIntoGroups(new_process_tree_item);
+      tree_item_map_[process_identifier] = new_process_tree_item;
     }
-    else
+    else if (!incremental || snapshot.process_changed[i])
     {
       // Update an existing process
-      tree_item_map_.at(process_identifier)->update(process_pb);
-      process_still_existing[process_identifier] = true;
+      process_tree_item->second->update(process_pb);
+      updated_items.push_back(process_tree_item->second);
     }
   }
 
   // Remove obsolete items
-  for (const auto& process : process_still_existing)
+  for (auto process = tree_item_map_.begin(); process != tree_item_map_.end();)
   {
-    if (!process.second)
+    if (existing_processes.find(process->first) == existing_processes.end())
+    {
+      removeItemFromGroups(process->second);
+      process = tree_item_map_.erase(process);
+    }
+    else
     {
-      removeItemFromGroups(tree_item_map_.at(process.first));
-      tree_item_map_.erase(process.first);
+      ++process;
     }
   }
 
-  updateAll();
+  updateItems(updated_items);
 }
 
 QVector<QPair<int, QString>> ProcessTreeModel::getTreeItemColumnNameMapping() const
@@ -37,6 +37,8 @@
 #include <QVector>
 #include <QPair>
 
+#include <unordered_map>
+
 class ProcessTreeModel : public GroupTreeModel
 {
   Q_OBJECT
@@ -76,7 +78,7 @@ public:
 
   QVector<QPair<int, QString>> getTreeItemColumnNameMapping() const;
 
-  void monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb) override;
+  void monitorUpdated(const MonitoringSnapshot& snapshot) override;
 
 protected:
   int mapColumnToItem(int model_column, int tree_item_type) const override;
@@ -127,5 +129,5 @@ private:
     { Columns::ECAL_RUNTIME_VERSION, (int)ProcessTreeItem::Columns::ECAL_RUNTIME_VERSION },
   };
 
-  std::map<std::string, ProcessTreeItem*> tree_item_map_;
+  std::unordered_map<std::string, ProcessTreeItem*> tree_item_map_;
 };
@@ -21,6 +21,8 @@
 #include "tree_item_type.h"
 #include "item_data_roles.h"
 
+#include <unordered_set>
+
 ServiceTreeModel::ServiceTreeModel(QObject *parent)
   : GroupTreeModel(QVector<int>{}, parent)
 {}
@@ -66,48 +68,58 @@ int ServiceTreeModel::groupColumn() const
   return (int)(Columns::GROUP);
 }
 
-void ServiceTreeModel::monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb)
+void ServiceTreeModel::monitorUpdated(const MonitoringSnapshot& snapshot)
 {
-  // Create a list of all service methods to check if we have to remove them
-  std::map<std::string, bool> service_still_existing;
-  for(const auto& service_tree_item : tree_item_map_)
-  {
-    service_still_existing[service_tree_item.first] = false;
-  }
+  // Unchanged services only have to be updated, if we have missed a snapshot
+  const bool incremental = isIncrementalUpdate(snapshot);
+
+  const auto& services = snapshot.monitoring_pb.services();
+
+  std::unordered_set<std::string> existing_services;
+  QList<QAbstractTreeItem*> updated_items;
 
-  for (const auto& service : monitoring_pb.services())
+  for (int i = 0; i < services.size(); i++)
   {
+    const auto& service         = services.Get(i);
+    const bool  service_changed = !incremental || snapshot.service_changed[i];
+
     for (const auto& method : service.methods())
     {
       std::string service_identifier = ServiceTreeItem::generateIdentifier(service, method);
+      existing_services.insert(service_identifier);
 
-      if (tree_item_map_.find(service_identifier) == tree_item_map_.end())
+      auto service_tree_item = tree_item_map_.find(service_identifier);
+      if (service_tree_item == tree_item_map_.end())
       {
         // Got a new service-method
-        ServiceTreeItem* service_tree_item = new ServiceTreeItem(service, method);
-        insertItemIntoGroups(service_tree_item);
-        tree_item_map_[service_identifier] = service_tree_item;
+        ServiceTreeItem* new_service_tree_item = new ServiceTreeItem(service, method);
+        insertItemIntoGroups(new_service_tree_item);
+        tree_item_map_[service_identifier] = new_service_tree_item;
       }
-      else
+      else if (service_changed)
       {
         // Update an existing service-method
-        tree_item_map_.at(service_identifier)->update(service, method);
-        service_still_existing[service_identifier] = true;
+        service_tree_item->second->update(service, method);
+        updated_items.push_back(service_tree_item->second);
       }
     }
   }
 
   // Remove obsolete items
-  for (const auto& service_tree_item : service_still_existing)
+  for (auto service_tree_item = tree_item_map_.begin(); service_tree_item != tree_item_map_.end();)
   {
-    if (!service_tree_item.second)
+    if (existing_services.find(service_tree_item->first) == existing_services.end())
+    {
+      removeItemFromGroups(service_tree_item->second);
+      service_tree_item = tree_item_map_.erase(service_tree_item);
+    }
+    else
     {
-      removeItemFromGroups(tree_item_map_.at(service_tree_item.first));
-      tree_item_map_.erase(service_tree_item.first);
+      ++service_tree_item;
     }
   }
 
-  updateAll();
+  updateItems(updated_items);
 }
 
 QVector<QPair<int, QString>> ServiceTreeModel::getTreeItemColumnNameMapping() const
@@ -36,6 +36,8 @@
 #include <QVector>
 #include <QPair>
 
+#include <unordered_map>
+
 class ServiceTreeModel : public GroupTreeModel
 {
   Q_OBJECT
@@ -69,7 +71,7 @@ public:
 
   QVector<QPair<int, QString>> getTreeItemColumnNameMapping() const;
 
-  void monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb) override;
+  void monitorUpdated(const MonitoringSnapshot& snapshot) override;
 
 protected:
   int mapColumnToItem(int model_column, int tree_item_type) const override;
@@ -108,5 +110,5 @@ private:
     { Columns::CALL_COUNT,           (int)ServiceTreeItem::Columns::CALL_COUNT },
   };
 
-  std::map<std::string, ServiceTreeItem*> tree_item_map_;
+  std::unordered_map<std::string, ServiceTreeItem*> tree_item_map_;
 };
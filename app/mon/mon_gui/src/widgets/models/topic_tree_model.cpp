@@ -21,6 +21,8 @@
 #include "tree_item_type.h"
 #include "item_data_roles.h"
 
+#include <unordered_set>
+
 TopicTreeModel::TopicTreeModel(QObject *parent)
   : GroupTreeModel(QVector<int>{}, parent)
 {}
@@ -66,45 +68,55 @@ int TopicTreeModel::groupColumn() const
   return (int)(Columns::GROUP);
 }
 
-void TopicTreeModel::monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb)
+void TopicTreeModel::monitorUpdated(const MonitoringSnapshot& snapshot)
 {
-  // Create a list of all topics to check if we have to remove them
-  std::map<std::string, bool> topic_still_existing;
-  for(const auto& topic : topic_tree_item_map_)
-  {
-    topic_still_existing[topic.first] = false;
-  }
+  // Unchanged topics only have to be updated, if we have missed a snapshot
+  const bool incremental = isIncrementalUpdate(snapshot);
+
+  const auto& topics = snapshot.monitoring_pb.topics();
+
+  std::unordered_set<std::string> existing_topics;
+  existing_topics.reserve(topics.size());
 
-  for (const auto& topic : monitoring_pb.topics())
+  QList<QAbstractTreeItem*> updated_items;
+
+  for (int i = 0; i < topics.size(); i++)
   {
-    std::string topic_id = topic.tid();
+    const auto&        topic    = topics.Get(i);
+    const std::string& topic_id = topic.tid();
+    existing_topics.insert(topic_id);
 
-    if (topic_tree_item_map_.find(topic_id) == topic_tree_item_map_.end())
+    auto topic_tree_item = topic_tree_item_map_.find(topic_id);
+    if (topic_tree_item == topic_tree_item_map_.end())
     {
       // Got a new topic
-      TopicTreeItem* topic_tree_item = new TopicTreeItem(topic);
-      insertItemIntoGroups(topic_tree_item);
-      topic_tree_item_map_[topic_id] = topic_tree_item;
+      TopicTreeItem* new_topic_tree_item = new TopicTreeItem(topic);
+      insertItemIntoGroups(new_topic_tree_item);
+      topic_tree_item_map_[topic_id] = new_topic_tree_item;
     }
-    else
+    else if (!incremental || snapshot.topic_changed[i])
     {
       // Update an existing topic
-      topic_tree_item_map_.at(topic_id)->update(topic);
-      topic_still_existing[topic_id] = true;
+      topic_tree_item->second->update(topic);
+      updated_items.push_back(topic_tree_item->second);
     }
   }
 
   // Remove obsolete items
-  for (const auto& topic : topic_still_existing)
+  for (auto topic = topic_tree_item_map_.begin(); topic != topic_tree_item_map_.end();)
   {
-    if (!topic.second)
+    if (existing_topics.find(topic->first) == existing_topics.end())
+    {
+      removeItemFromGroups(topic->second);
+      topic = topic_tree_item_map_.erase(topic);
+    }
+    else
     {
-      removeItemFromGroups(topic_tree_item_map_.at(topic.first));
-      topic_tree_item_map_.erase(topic.first);
+      ++topic;
     }
   }
 
-  updateAll();
+  updateItems(updated_items);
 }
 
 QVector<QPair<int, QString>> TopicTreeModel::getTreeItemColumnNameMapping() const
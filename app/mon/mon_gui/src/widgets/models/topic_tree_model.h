@@ -37,6 +37,8 @@
 #include <QVector>
 #include <QPair>
 
+#include <unordered_map>
+
 class TopicTreeModel : public GroupTreeModel
 {
   Q_OBJECT
@@ -78,7 +80,7 @@ public:
 
   QVector<QPair<int, QString>> getTreeItemColumnNameMapping() const;
 
-  void monitorUpdated(const eCAL::pb::Monitoring& monitoring_pb) override;
+  void monitorUpdated(const MonitoringSnapshot& snapshot) override;
 
 protected:
   int mapColumnToItem(int model_column, int tree_item_type) const override;
@@ -133,5 +135,5 @@ private:
     { Columns::DATA_FREQUENCY,         (int)TopicTreeItem::Columns::DFREQ },
   };
 
-  std::map<std::string, TopicTreeItem*> topic_tree_item_map_;
+  std::unordered_map<std::string, TopicTreeItem*> topic_tree_item_map_;
 };
@@ -164,11 +164,13 @@ void PluginWidget::onProtoMessageCallback(const google::protobuf::Message& messa
     // Lock the mutex
     std::lock_guard<std::mutex> lock(proto_message_mutex_);
 
-    // Delete the old message
-    delete last_proto_message_;
-
-    // Create a copy of the new message as member variable. We cannot use a reference here, as this may cause a deadlock with the GUI thread
-    last_proto_message_ = message.New();
+    // Create a copy of the new message as member variable. We cannot use a reference here, as this may cause a deadlock with the GUI thread.
+    // The copy is reused as long as the message type does not change, so its allocated fields are reused as well.
+    if ((last_proto_message_ == nullptr) || (last_proto_message_->GetDescriptor() != message.GetDescriptor()))
+    {
+      delete last_proto_message_;
+      last_proto_message_ = message.New();
+    }
     last_proto_message_->CopyFrom(message);
 
     last_message_publish_timestamp_ = eCAL::Time::ecal_clock::time_point(std::chrono::duration_cast<eCAL::Time::ecal_clock::duration>(std::chrono::microseconds(send_time_usecs)));
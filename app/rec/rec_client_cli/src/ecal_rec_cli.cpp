@@ -88,6 +88,7 @@ int main(int argc, char** argv)
 
   // Settings args
   TCLAP::ValueArg<double>       pre_buffer_arg     ("b", "pre-buffer",      "Pre-buffer data for some seconds",                                                                                                                                       false, -1.0, "seconds");
+  TCLAP::ValueArg<unsigned int> pre_buffer_size_arg("",  "pre-buffer-size", "Limit the pre-buffer to this amount of memory. The oldest data is dropped first. 0 only limits the pre-buffer by time.",                                          false, 0, "megabytes");
   TCLAP::ValueArg<std::string>  blacklist_arg      ("",  "blacklist",       "Record all topics except the listed ones (Comma separated list, e.g.: \"Topic1,Topic2\")",                                                                               false, "", "list");
   TCLAP::ValueArg<std::string>  whitelist_arg      ("",  "whitelist",       "Only record these topics (Comma separated list, e.g.: \"Topic1,Topic2\")",                                                                                               false, "", "list");
   TCLAP::ValueArg<std::string>  host_filter_arg    ("f", "hosts",           "Only record a topic when it is published by any of these hosts (Comma-separated list, e.g.: \"Computer1,Computer2\")",                                                   false, "", "list");
@@ -102,6 +103,8 @@ int main(int argc, char** argv)
   TCLAP::ValueArg<std::string>  meas_name_arg      ("n", "meas-name",       "Name of the measurement, when --" + record_arg.getName() + " is set. This will create a folder in the directory provided by --" + meas_root_dir_arg.getName() + ".",     false, "", "directory");
   TCLAP::ValueArg<unsigned int> max_file_size_arg  ("",  "max-file-size",   "Maximum file size of the recording files, when --" + record_arg.getName() + " is set.",                                                                                  false, 100, "megabytes");
   TCLAP::ValueArg<std::string>  description_arg    ("",  "description",     "Description stored in the measurement folder, when --" + record_arg.getName() + " is set.",                                                                              false, "", "string");
+  TCLAP::ValueArg<unsigned int> writer_threads_arg ("",  "writer-threads",  "Number of HDF5 writer threads, when --" + record_arg.getName() + " is set. Topics are distributed across the writers, each writer creates its own files.",           false, 1, "count");
+  TCLAP::ValueArg<int>          compression_arg    ("",  "compression",     "Deflate level (1-9) used to compress the recorded messages, when --" + record_arg.getName() + " is set. 0 disables the compression.",                           false, 0, "level");
 
   // Various args
   TCLAP::SwitchArg              list_addons_arg    ("",  "list-addons",     "Lists addons and exit.",                                                                                                                                                  false);
@@ -109,6 +112,7 @@ int main(int argc, char** argv)
   std::vector<TCLAP::Arg*> arg_vector =
   {
     &pre_buffer_arg,
+    &pre_buffer_size_arg,
     &blacklist_arg,
     &whitelist_arg,
     &host_filter_arg,
@@ -119,6 +123,8 @@ int main(int argc, char** argv)
     &meas_name_arg,
     &max_file_size_arg,
     &description_arg,
+    &writer_threads_arg,
+    &compression_arg,
     &list_addons_arg,
   };
   
@@ -141,6 +147,18 @@ int main(int argc, char** argv)
     std::cerr << "Error parsing command line: " << e.what() << std::endl;
   }
 
+  if (writer_threads_arg.isSet() && ((writer_threads_arg.getValue() == 0) || (writer_threads_arg.getValue() > 64)))
+  {
+    std::cerr << "Error parsing command line: --" << writer_threads_arg.getName() << " must be between 1 and 64" << std::endl;
+    return 1;
+  }
+
+  if (compression_arg.isSet() && ((compression_arg.getValue() < 0) || (compression_arg.getValue() > 9)))
+  {
+    std::cerr << "Error parsing command line: --" << compression_arg.getName() << " must be between 0 and 9" << std::endl;
+    return 1;
+  }
+
   // TODO: Check the validity of all arguments
   ecal_rec = std::make_shared<eCAL::rec::EcalRec>();
 
@@ -169,6 +187,10 @@ int main(int argc, char** argv)
     auto buffer_length = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(pre_buffer_arg.getValue()));
     ecal_rec->SetMaxPreBufferLength(buffer_length);
   }
+  if (pre_buffer_size_arg.isSet())
+  {
+    ecal_rec->SetMaxPreBufferSize(static_cast<size_t>(pre_buffer_size_arg.getValue()) * 1024 * 1024);
+  }
 
   //////////////////////////////////
   // Blacklist / whitelist
@@ -285,6 +307,20 @@ int main(int argc, char** argv)
     {
       job_config.SetDescription(description_arg.getValue());
     }
+    //////////////////////////////////
+    // writer_threads
+    //////////////////////////////////
+    if (writer_threads_arg.isSet())
+    {
+      job_config.SetWriterThreadCount(writer_threads_arg.getValue());
+    }
+    //////////////////////////////////
+    // compression
+    //////////////////////////////////
+    if (compression_arg.isSet())
+    {
+      job_config.SetCompressionLevel(compression_arg.getValue());
+    }
 
     ecal_rec->ConnectToEcal();
     ecal_rec->StartRecording(job_config);
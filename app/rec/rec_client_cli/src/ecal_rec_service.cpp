@@ -53,6 +53,7 @@ void EcalRecService::GetConfig(::google::protobuf::RpcController*        /*contr
   std::string max_pre_buffer_length_secs_string = std::to_string(std::chrono::duration_cast<std::chrono::duration<double>>(ecal_rec_->GetMaxPreBufferLength()).count());
   std::replace(max_pre_buffer_length_secs_string.begin(), max_pre_buffer_length_secs_string.end(), decimal_point, '.');
   (*config_item_map)["max_pre_buffer_length_secs"] = max_pre_buffer_length_secs_string;
+  (*config_item_map)["max_pre_buffer_size_bytes"]  = std::to_string(ecal_rec_->GetMaxPreBufferSize());
   (*config_item_map)["pre_buffering_enabled"]      = (ecal_rec_->IsPreBufferingEnabled() ? "true" : "false");
   (*config_item_map)["host_filter"]                = EcalUtils::String::Join("\n", ecal_rec_->GetHostsFilter());
   std::string record_mode_string;
@@ -108,6 +109,27 @@ void EcalRecService::SetConfig(::google::protobuf::RpcController*        /*contr
     ecal_rec_->SetMaxPreBufferLength(max_buffer_length);
   }
 
+  //////////////////////////////////////
+  // max_pre_buffer_size_bytes        //
+  //////////////////////////////////////
+  if (config_item_map.find("max_pre_buffer_size_bytes") != config_item_map.end())
+  {
+    std::string max_pre_buffer_size_string = config_item_map["max_pre_buffer_size_bytes"];
+    unsigned long long max_pre_buffer_size = 0;
+    try
+    {
+      max_pre_buffer_size = std::stoull(max_pre_buffer_size_string);
+    }
+    catch (const std::exception& e)
+    {
+      response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+      response->set_error("Error parsing value \"" + max_pre_buffer_size_string + "\": " + e.what());
+      return;
+    }
+
+    ecal_rec_->SetMaxPreBufferSize(static_cast<size_t>(max_pre_buffer_size));
+  }
+
   //////////////////////////////////////
   // pre_buffering_enabled            //
   //////////////////////////////////////
@@ -636,6 +658,111 @@ bool EcalRecService::strToBool(const std::string& str)
     }
   }
 
+  //////////////////////////////////////
+  // writer_thread_count              //
+  //////////////////////////////////////
+  {
+    auto it = config.items().find("writer_thread_count");
+    if (it != config.items().end())
+    {
+      std::string writer_thread_count_string = it->second;
+      unsigned long writer_thread_count = 0;
+      try
+      {
+        writer_thread_count = std::stoul(writer_thread_count_string);
+      }
+      catch (const std::exception& e)
+      {
+        response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+        response->set_error("Error parsing value \"" + writer_thread_count_string + "\": " + e.what());
+        return  job_config;
+      }
+
+      if ((writer_thread_count == 0) || (writer_thread_count > 64))
+      {
+        response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+        response->set_error("Error setting writer thread count to " + writer_thread_count_string + ": Value must be between 1 and 64");
+        return job_config;
+      }
+
+      job_config.SetWriterThreadCount(static_cast<unsigned int>(writer_thread_count));
+    }
+  }
+
+  //////////////////////////////////////
+  // compression_level                //
+  //////////////////////////////////////
+  {
+    auto it = config.items().find("compression_level");
+    if (it != config.items().end())
+    {
+      std::string compression_level_string = it->second;
+      int compression_level = 0;
+      try
+      {
+        compression_level = std::stoi(compression_level_string);
+      }
+      catch (const std::exception& e)
+      {
+        response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+        response->set_error("Error parsing value \"" + compression_level_string + "\": " + e.what());
+        return  job_config;
+      }
+
+      if ((compression_level < 0) || (compression_level > 9))
+      {
+        response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+        response->set_error("Error setting compression level to " + compression_level_string + ": Value must be between 0 and 9");
+        return job_config;
+      }
+
+      job_config.SetCompressionLevel(compression_level);
+    }
+  }
+
+  //////////////////////////////////////
+  // topic_compression_levels         //
+  //////////////////////////////////////
+  {
+    auto it = config.items().find("topic_compression_levels");
+    if (it != config.items().end())
+    {
+      std::vector<std::string> topic_compression_level_list;
+      EcalUtils::String::Split(it->second, "\n", topic_compression_level_list);
+
+      std::map<std::string, int> topic_compression_levels;
+      for (const std::string& topic_compression_level_string : topic_compression_level_list)
+      {
+        if (EcalUtils::String::Trim(topic_compression_level_string).empty())
+          continue;
+
+        // The level is separated by the last colon, as topic names may contain colons themselves
+        const size_t separator_pos = topic_compression_level_string.rfind(':');
+        int compression_level = -1;
+        if (separator_pos != std::string::npos)
+        {
+          try
+          {
+            compression_level = std::stoi(topic_compression_level_string.substr(separator_pos + 1));
+          }
+          catch (const std::exception&)
+          {}
+        }
+
+        if ((compression_level < 0) || (compression_level > 9))
+        {
+          response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+          response->set_error("Error parsing topic compression level \"" + topic_compression_level_string + "\": Expected <topic>:<0-9>");
+          return job_config;
+        }
+
+        topic_compression_levels[topic_compression_level_string.substr(0, separator_pos)] = compression_level;
+      }
+
+      job_config.SetTopicCompressionLevels(topic_compression_levels);
+    }
+  }
+
   //////////////////////////////////////
   // description                      //
   //////////////////////////////////////
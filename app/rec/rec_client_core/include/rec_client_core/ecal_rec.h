@@ -59,6 +59,10 @@ namespace eCAL
 
       std::chrono::steady_clock::duration GetMaxPreBufferLength() const;
 
+      void SetMaxPreBufferSize(size_t max_pre_buffer_size_bytes);
+
+      size_t GetMaxPreBufferSize() const;
+
       bool IsPreBufferingEnabled() const;
 
       std::pair<size_t, std::chrono::steady_clock::duration> GetCurrentPreBufferLength() const;
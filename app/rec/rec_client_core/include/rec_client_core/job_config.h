@@ -21,6 +21,7 @@
 
 #include <string>
 #include <chrono>
+#include <map>
 
 namespace eCAL
 {
@@ -58,6 +59,16 @@ namespace eCAL
       void SetDescription(const std::string& description);
       std::string GetDescription() const;
 
+      void SetWriterThreadCount(unsigned int writer_thread_count);
+      unsigned int GetWriterThreadCount() const;
+
+      void SetCompressionLevel(int compression_level);
+      int GetCompressionLevel() const;
+
+      void SetTopicCompressionLevels(const std::map<std::string, int>& topic_compression_levels);
+      std::map<std::string, int> GetTopicCompressionLevels() const;
+      int GetCompressionLevel(const std::string& topic_name) const;
+
     //////////////////////////////
     // Evaluation
     //////////////////////////////
@@ -77,6 +88,9 @@ namespace eCAL
       int64_t      max_file_size_mb_;
       bool         one_file_per_topic_;
       std::string  description_;
+      unsigned int writer_thread_count_;
+      int          compression_level_;                                          /**< Deflate level (1-9) used for all topics. 0 disables the compression. */
+      std::map<std::string, int> topic_compression_levels_;                     /**< Deflate levels for individual topics, overriding the compression_level_ */
     };
   }
 }
\ No newline at end of file
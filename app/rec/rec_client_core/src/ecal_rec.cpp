@@ -66,6 +66,16 @@ namespace eCAL
       return recorder_->GetMaxPreBufferLength();
     }
 
+    void EcalRec::SetMaxPreBufferSize(size_t max_pre_buffer_size_bytes)
+    {
+      recorder_->SetMaxPreBufferSize(max_pre_buffer_size_bytes);
+    }
+
+    size_t EcalRec::GetMaxPreBufferSize() const
+    {
+      return recorder_->GetMaxPreBufferSize();
+    }
+
     bool EcalRec::IsPreBufferingEnabled() const
     {
       return recorder_->IsPreBufferingEnabled();
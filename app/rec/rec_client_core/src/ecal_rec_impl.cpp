@@ -126,6 +126,21 @@ namespace eCAL
       return pre_buffer_.get_max_buffer_length();
     }
 
+    void EcalRecImpl::SetMaxPreBufferSize(size_t max_pre_buffer_size_bytes)
+    {
+      pre_buffer_.set_max_buffer_size(max_pre_buffer_size_bytes);
+
+      if (max_pre_buffer_size_bytes > 0)
+        EcalRecLogger::Instance()->info(std::string("Max pre-buffer size: ") + std::to_string(max_pre_buffer_size_bytes / (1024 * 1024)) + " MiB");
+      else
+        EcalRecLogger::Instance()->info("Max pre-buffer size: unlimited");
+    }
+
+    size_t EcalRecImpl::GetMaxPreBufferSize() const
+    {
+      return pre_buffer_.get_max_buffer_size();
+    }
+
     bool EcalRecImpl::IsPreBufferingEnabled() const
     {
       return pre_buffer_.is_enabled();
@@ -700,7 +715,7 @@ namespace eCAL
       auto ecal_receive_time   = eCAL::Time::ecal_clock::now();
       auto system_receive_time = std::chrono::steady_clock::now();
 
-      std::shared_ptr<Frame> frame = std::make_shared<Frame>(callback_data, topic_name, ecal_receive_time, system_receive_time);
+      std::shared_ptr<Frame> frame = pre_buffer_.create_frame(callback_data, topic_name, ecal_receive_time, system_receive_time);
 
       pre_buffer_.push_back(frame);
 
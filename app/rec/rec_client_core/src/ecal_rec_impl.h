@@ -66,6 +66,9 @@ namespace eCAL
       void SetMaxPreBufferLength(std::chrono::steady_clock::duration max_pre_buffer_length);
       std::chrono::steady_clock::duration GetMaxPreBufferLength() const;
 
+      void SetMaxPreBufferSize(size_t max_pre_buffer_size_bytes);
+      size_t GetMaxPreBufferSize() const;
+
       bool IsPreBufferingEnabled() const;
       std::pair<int64_t, std::chrono::steady_clock::duration> GetCurrentPreBufferLength() const;
 
@@ -44,6 +44,19 @@ namespace eCAL
         data_.assign((char*)callback_data->buf, (char*)callback_data->buf + callback_data->size);
       }
 
+      // Re-initializes a frame that is not used anymore. The data buffer keeps
+      // its capacity, so no memory has to be allocated for similar sized frames.
+      void assign(const eCAL::SReceiveCallbackData* const callback_data, const std::string& topic_name, const eCAL::Time::ecal_clock::time_point receive_time, std::chrono::steady_clock::time_point system_receive_time)
+      {
+        ecal_publish_time_   = eCAL::Time::ecal_clock::time_point(std::chrono::duration_cast<eCAL::Time::ecal_clock::duration>(std::chrono::microseconds(callback_data->time)));
+        ecal_receive_time_   = receive_time;
+        system_receive_time_ = system_receive_time;
+        topic_name_          = topic_name;
+        clock_               = callback_data->clock;
+        id_                  = callback_data->id;
+        data_.assign((char*)callback_data->buf, (char*)callback_data->buf + callback_data->size);
+      }
+
       Frame()
         : data_()
         , ecal_publish_time_(eCAL::Time::ecal_clock::time_point(eCAL::Time::ecal_clock::duration(0)))
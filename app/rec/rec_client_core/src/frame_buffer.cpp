@@ -19,16 +19,31 @@
 
 #include "frame_buffer.h"
 
+#include <algorithm>
 #include <thread>
 
 namespace eCAL
 {
   namespace rec
   {
+    namespace
+    {
+      // Limits for the memory that is kept for reusing it for new frames
+      constexpr size_t kMaxRecycledFrames     = 256;
+      constexpr size_t kMaxRecycledFramesSize = 64 * 1024 * 1024;
+
+      // A recycled frame is only reused, if its memory is not much larger
+      // than the new frame. Otherwise small frames would pin large buffers.
+      constexpr size_t kMaxRecycledCapacityFactor = 2;
+    }
+
     // Constructor
     FrameBuffer::FrameBuffer(bool enabled, std::chrono::steady_clock::duration max_length)
       : is_enabled_(enabled)
       , max_buffer_length_(max_length)
+      , max_buffer_size_(0)
+      , frame_buffer_size_(0)
+      , recycled_frames_size_(0)
     {}
 
     // Destructor
@@ -47,12 +62,12 @@ namespace eCAL
 
       // Clear just in case something has happend while the frame-buffer was disabled
       if (!is_enabled_)
-        frame_buffer_deque_.clear();
+        clear_no_lock();
 
       is_enabled_ = enabled;
 
       if (!is_enabled_)
-        frame_buffer_deque_.clear();
+        clear_no_lock();
     }
 
     std::chrono::steady_clock::duration FrameBuffer::get_max_buffer_length() const
@@ -68,12 +83,78 @@ namespace eCAL
       remove_old_frames_no_lock();
     }
 
+    size_t FrameBuffer::get_max_buffer_size() const
+    {
+      std::shared_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      return max_buffer_size_;
+    }
+
+    void FrameBuffer::set_max_buffer_size(size_t max_size_bytes)
+    {
+      std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      max_buffer_size_ = max_size_bytes;
+      remove_old_frames_no_lock();
+    }
+
     void FrameBuffer::push_back(const std::shared_ptr<Frame>& frame)
     {
       std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
       if (is_enabled_)
       {
         frame_buffer_deque_.push_back(frame);
+        // Count the allocated memory, as a recycled frame may hold more
+        // memory than its current data needs
+        frame_buffer_size_ += frame->data_.capacity();
+
+        // Enforce the size limit right away, as a burst of large frames must
+        // not wait for the garbage collector
+        if (max_buffer_size_ > 0)
+        {
+          while (!frame_buffer_deque_.empty() && (frame_buffer_size_ > max_buffer_size_))
+            pop_front_no_lock();
+        }
+      }
+    }
+
+    std::shared_ptr<Frame> FrameBuffer::create_frame(const eCAL::SReceiveCallbackData* const callback_data, const std::string& topic_name, const eCAL::Time::ecal_clock::time_point receive_time, std::chrono::steady_clock::time_point system_receive_time)
+    {
+      std::shared_ptr<Frame> frame;
+
+      {
+        std::lock_guard<decltype(recycled_frames_mutex_)> recycled_frames_lock(recycled_frames_mutex_);
+
+        // Best fit: use the smallest recycled frame that is large enough
+        const size_t required_capacity = static_cast<size_t>(callback_data->size);
+        const size_t max_capacity      = std::max<size_t>(required_capacity, 1) * kMaxRecycledCapacityFactor;
+        auto best_fit_it = recycled_frames_.end();
+        for (auto it = recycled_frames_.begin(); it != recycled_frames_.end(); it++)
+        {
+          const size_t capacity = (*it)->data_.capacity();
+          if ((capacity >= required_capacity)
+            && (capacity <= max_capacity)
+            && ((best_fit_it == recycled_frames_.end()) || (capacity < (*best_fit_it)->data_.capacity())))
+          {
+            best_fit_it = it;
+          }
+        }
+
+        if (best_fit_it != recycled_frames_.end())
+        {
+          frame = std::move(*best_fit_it);
+          *best_fit_it = std::move(recycled_frames_.back());
+          recycled_frames_.pop_back();
+          recycled_frames_size_ -= frame->data_.capacity();
+        }
+      }
+
+      if (frame)
+      {
+        frame->assign(callback_data, topic_name, receive_time, system_receive_time);
+        return frame;
+      }
+      else
+      {
+        return std::make_shared<Frame>(callback_data, topic_name, receive_time, system_receive_time);
       }
     }
 
@@ -84,7 +165,7 @@ namespace eCAL
       if (!is_enabled_)
         return {0, std::chrono::steady_clock::duration(0)};
 
-      int64_t frame_count = frame_buffer_deque_.size();
+      int64_t frame_count = static_cast<int64_t>(frame_buffer_deque_.size());
       std::chrono::steady_clock::duration buffer_length;
       if (frame_count > 0)
       {
@@ -103,6 +184,12 @@ namespace eCAL
       remove_old_frames_no_lock();
     }
 
+    size_t FrameBuffer::size_bytes() const
+    {
+      std::shared_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      return frame_buffer_size_;
+    }
+
     void FrameBuffer::remove_old_frames_no_lock()
     {
       auto now = std::chrono::steady_clock::now();
@@ -112,26 +199,52 @@ namespace eCAL
 
       if (!is_enabled_)
       {
-        frame_buffer_deque_.clear();
+        clear_no_lock();
       }
       else
       {
         auto oldest_timestamp_to_leave = now - max_buffer_length_;
-        auto it = frame_buffer_deque_.begin();
-        for (; it != frame_buffer_deque_.end(); it++)
+        while (!frame_buffer_deque_.empty()
+          && ((frame_buffer_deque_.front()->system_receive_time_ < oldest_timestamp_to_leave)
+            || ((max_buffer_size_ > 0) && (frame_buffer_size_ > max_buffer_size_))))
         {
-          if ((*it)->system_receive_time_ >= oldest_timestamp_to_leave)
-            break;
+          pop_front_no_lock();
         }
+      }
+    }
+
+    void FrameBuffer::pop_front_no_lock()
+    {
+      std::shared_ptr<Frame> frame = std::move(frame_buffer_deque_.front());
+      frame_buffer_deque_.pop_front();
+      frame_buffer_size_ -= frame->data_.capacity();
 
-        frame_buffer_deque_.erase(frame_buffer_deque_.begin(), it);
+      // If nobody else (e.g. a writer thread) is using the frame any more, we
+      // keep its memory to reuse it for a new frame. As frames only leave the
+      // buffer while holding the buffer lock, the use count cannot increase.
+      if (frame.use_count() == 1)
+      {
+        std::lock_guard<decltype(recycled_frames_mutex_)> recycled_frames_lock(recycled_frames_mutex_);
+        const size_t capacity = frame->data_.capacity();
+        if ((recycled_frames_.size() < kMaxRecycledFrames)
+          && (recycled_frames_size_ + capacity <= kMaxRecycledFramesSize))
+        {
+          recycled_frames_size_ += capacity;
+          recycled_frames_.push_back(std::move(frame));
+        }
       }
     }
 
     void FrameBuffer::clear()
     {
       std::unique_lock<decltype(frame_buffer_mutex_)> frame_buffer_lock(frame_buffer_mutex_);
+      clear_no_lock();
+    }
+
+    void FrameBuffer::clear_no_lock()
+    {
       frame_buffer_deque_.clear();
+      frame_buffer_size_ = 0;
     }
 
     std::deque<std::shared_ptr<Frame>> FrameBuffer::get_as_deque() const
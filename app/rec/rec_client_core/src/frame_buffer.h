@@ -18,6 +18,8 @@
 */
 
 #include <deque>
+#include <vector>
+#include <mutex>
 #include <shared_mutex>
 #include <memory>
 #include <condition_variable>
@@ -51,10 +53,26 @@ namespace eCAL
       std::chrono::steady_clock::duration get_max_buffer_length() const;
       void set_max_buffer_length(std::chrono::steady_clock::duration new_length);
 
+      /**
+       * @brief Limits the memory allocated by all buffered frames. The oldest
+       *        frames are dropped when the limit is exceeded. 0 means that the
+       *        buffer is only limited by its length in time.
+       */
+      size_t get_max_buffer_size() const;
+      void set_max_buffer_size(size_t max_size_bytes);
+
       void push_back(const std::shared_ptr<Frame>& frame);
       //std::shared_ptr<Frame> pop_front();
 
+      /**
+       * @brief Creates a frame from the callback data. The memory of frames
+       *        that have been dropped from the buffer and that are not used
+       *        anywhere else is reused, if possible.
+       */
+      std::shared_ptr<Frame> create_frame(const eCAL::SReceiveCallbackData* const callback_data, const std::string& topic_name, const eCAL::Time::ecal_clock::time_point receive_time, std::chrono::steady_clock::time_point system_receive_time);
+
       std::pair<int64_t, std::chrono::steady_clock::duration> length() const;
+      size_t size_bytes() const;
 
       void remove_old_frames();
       void clear();
@@ -63,6 +81,8 @@ namespace eCAL
 
     private:
       void remove_old_frames_no_lock();
+      void pop_front_no_lock();
+      void clear_no_lock();
 
     private:
 
@@ -73,8 +93,16 @@ namespace eCAL
       bool                                is_enabled_;
       std::chrono::steady_clock::duration max_buffer_length_;
 
+      size_t                              max_buffer_size_;
+
       // Actual frame buffer
       std::deque<std::shared_ptr<Frame>>  frame_buffer_deque_;
+      size_t                              frame_buffer_size_;
+
+      // Frames removed from the buffer that can be reused
+      std::mutex                          recycled_frames_mutex_;
+      std::vector<std::shared_ptr<Frame>> recycled_frames_;
+      size_t                              recycled_frames_size_;
 
     };
   }
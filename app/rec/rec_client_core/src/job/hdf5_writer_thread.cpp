@@ -33,13 +33,15 @@ namespace eCAL
     // Constructor & Destructor
     ///////////////////////////////
 
-    Hdf5WriterThread::Hdf5WriterThread(const JobConfig& job_config, const std::map<std::string, TopicInfo>& initial_topic_info_map, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer)
+    Hdf5WriterThread::Hdf5WriterThread(const JobConfig& job_config, unsigned int writer_index, const std::map<std::string, TopicInfo>& initial_topic_info_map, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer)
       : InterruptibleThread          ()
       , job_config_                  (job_config)
+      , writer_index_                (writer_index)
       , frame_buffer_                (initial_frame_buffer)
       , written_frames_              (0)
       , new_topic_info_map_          (initial_topic_info_map)
       , new_topic_info_map_available_(true)
+      , compression_enabled_         ((job_config.GetCompressionLevel() > 0) || !job_config.GetTopicCompressionLevels().empty())
       , flushing_                    (false)
     {
       hdf5_writer_ = std::make_unique<eCAL::eh5::Writer>();
@@ -116,8 +118,6 @@ namespace eCAL
       EcalRecLogger::Instance()->debug("Hdf5WriterThread::Run(): Starting Thread");
 #endif // NDEBUG
 
-      EcalRecLogger::Instance()->info("Measurement directory: " + job_config_.GetCompleteMeasurementPath());
-
       // Initialization
       if (!OpenHdf5Writer()) return;
 
@@ -171,6 +171,7 @@ namespace eCAL
           {
             hdf5_writer_->SetChannelType(topic.first, topic.second.type_);
             hdf5_writer_->SetChannelDescription(topic.first, topic.second.description_);
+            SetTopicCompression_NoLock(topic.first);
           }
         }
         else if (frame)
@@ -180,7 +181,10 @@ namespace eCAL
           if (IsInterrupted())
             break;
 
-          // Write Frame element to HDF5
+          // Frames may arrive before the topic info, so we make sure the compression is set before the first frame is written
+          SetTopicCompression_NoLock(frame->topic_name_);
+
+          // Write Frame element to HDF5 (compression is done by HDF5 on this thread)
           if (!hdf5_writer_->AddEntryToFile(
             frame->data_.data(),
             frame->data_.size(),
@@ -210,8 +214,6 @@ namespace eCAL
 
       CloseHdf5Writer();
 
-      EcalRecLogger::Instance()->info("Finished saving measurement");
-
 #ifndef NDEBUG
       EcalRecLogger::Instance()->debug("Hdf5WriterThread: Thread is terminating");
 #endif // NDEBUG
@@ -226,6 +228,11 @@ namespace eCAL
       return job_config_;
     }
 
+    unsigned int Hdf5WriterThread::GetWriterIndex() const
+    {
+      return writer_index_;
+    }
+
     bool Hdf5WriterThread::IsFlushing()
     {
       return flushing_;
@@ -252,16 +259,42 @@ namespace eCAL
       return last_status_;
     }
 
+    bool Hdf5WriterThread::GetFrameTimeRange(std::chrono::steady_clock::time_point& first_frame_time, std::chrono::steady_clock::time_point& last_frame_time) const
+    {
+      std::lock_guard<decltype(input_mutex_)> input_lock(input_mutex_);
+
+      if ((written_frames_ == 0) && frame_buffer_.empty())
+        return false;
+
+      first_frame_time = (written_frames_ > 0)    ? first_written_frame_timestamp_            : frame_buffer_.front()->system_receive_time_;
+      last_frame_time  = !frame_buffer_.empty()   ? frame_buffer_.back()->system_receive_time_ : last_written_frame_timestamp_;
+
+      return true;
+    }
+
     ///////////////////////////////
     // Helper Methods
     ///////////////////////////////
+    std::string Hdf5WriterThread::GetFileBaseName() const
+    {
+      // When the job is sharded across multiple writers, each writer gets its
+      // own file base name, so the writers never touch the same HDF5 file.
+      std::string base_name = eCAL::Process::GetHostName();
+      if (job_config_.GetWriterThreadCount() > 1)
+      {
+        base_name += "_w" + std::to_string(writer_index_);
+      }
+      return base_name;
+    }
+
     bool Hdf5WriterThread::OpenHdf5Writer() const
     {
       std::string host_name = eCAL::Process::GetHostName();
+      std::string base_name = GetFileBaseName();
       std::string hdf5_dir  = EcalUtils::Filesystem::ToNativeSeperators(job_config_.GetCompleteMeasurementPath() + "/" + host_name);
 
 #ifndef NDEBUG
-      EcalRecLogger::Instance()->debug("Hdf5WriterThread::Open(): hdf5_dir: \"" + hdf5_dir + "\", base_name: \"" + host_name + "\"");
+      EcalRecLogger::Instance()->debug("Hdf5WriterThread::Open(): hdf5_dir: \"" + hdf5_dir + "\", base_name: \"" + base_name + "\"");
 #endif // NDEBUG
       std::unique_lock<decltype(hdf5_writer_mutex_)> hdf5_writer_lock(hdf5_writer_mutex_);
 
@@ -271,7 +304,7 @@ namespace eCAL
         EcalRecLogger::Instance()->debug("Hdf5WriterThread::Open(): Successfully opened HDF5-Writer with path \"" + hdf5_dir + "\"");
 #endif // NDEBUG
 
-        hdf5_writer_->SetFileBaseName(host_name);
+        hdf5_writer_->SetFileBaseName(base_name);
         hdf5_writer_->SetMaxSizePerFile(job_config_.GetMaxFileSize());
         hdf5_writer_->SetOneFilePerChannelEnabled(job_config_.GetOneFilePerTopicEnabled());
       }
@@ -285,6 +318,21 @@ namespace eCAL
       return true;
     }
 
+    void Hdf5WriterThread::SetTopicCompression_NoLock(const std::string& topic_name)
+    {
+      if (!compression_enabled_)
+        return;
+
+      if (!topics_with_compression_set_.emplace(topic_name).second)
+        return;
+
+      const int compression_level = job_config_.GetCompressionLevel(topic_name);
+      if (compression_level > 0)
+      {
+        hdf5_writer_->SetChannelCompression(topic_name, eCAL::measurement::base::Compression(eCAL::measurement::base::CompressionCodec::Deflate, compression_level));
+      }
+    }
+
     bool Hdf5WriterThread::CloseHdf5Writer()
     {
 #ifndef NDEBUG
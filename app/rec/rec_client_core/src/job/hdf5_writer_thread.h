@@ -25,6 +25,7 @@
 #include <mutex>
 #include <deque>
 #include <map>
+#include <set>
 
 #include "frame.h"
 #include "rec_client_core/job_config.h"
@@ -41,7 +42,7 @@ namespace eCAL
     // Constructor & Destructor
     ///////////////////////////////
     public:
-      Hdf5WriterThread(const JobConfig& job_config, const std::map<std::string, TopicInfo>& initial_topic_info_map = {}, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer = {});
+      Hdf5WriterThread(const JobConfig& job_config, unsigned int writer_index = 0, const std::map<std::string, TopicInfo>& initial_topic_info_map = {}, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer = {});
 
       ~Hdf5WriterThread();
 
@@ -66,22 +67,34 @@ namespace eCAL
     public:
       const JobConfig& GetJobConfig() const;
 
+      unsigned int GetWriterIndex() const;
+
       bool IsFlushing();
       
       RecHdf5JobStatus GetStatus() const;
 
+      /**
+       * @brief Receive times of the first and the last frame of this writer, including frames that have not been written, yet.
+       *
+       * @return false, if this writer has not received any frame
+       **/
+      bool GetFrameTimeRange(std::chrono::steady_clock::time_point& first_frame_time, std::chrono::steady_clock::time_point& last_frame_time) const;
+
     ///////////////////////////////
     // Helper Methods
     ///////////////////////////////
     private:
+      std::string GetFileBaseName() const;
       bool        OpenHdf5Writer() const;
       bool        CloseHdf5Writer();
+      void        SetTopicCompression_NoLock(const std::string& topic_name);
 
     ///////////////////////////////
     // Member Variables
     ///////////////////////////////
     private:
-      JobConfig job_config_;
+      JobConfig    job_config_;
+      unsigned int writer_index_;                                               /**< Index of this writer in the job's writer pool. Each writer owns its own set of HDF5 files. */
 
       mutable std::mutex                    input_mutex_;                       /**< Mutex protecting every input variables (notably the variables below). */
       mutable std::condition_variable       input_cv_;                          /**< condition variable for notifying the internal worker thread that new input data is available */
@@ -95,6 +108,8 @@ namespace eCAL
 
       mutable std::mutex                                    hdf5_writer_mutex_;
       std::unique_ptr<eCAL::measurement::base::Writer>      hdf5_writer_;
+      const bool                                            compression_enabled_;          /**< Whether any topic of this job shall be compressed */
+      std::set<std::string>                                 topics_with_compression_set_;  /**< Topics that the compression has already been set for. Only used by the writer thread. */
 
 
       std::atomic<bool> flushing_;
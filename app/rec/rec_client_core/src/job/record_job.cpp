@@ -34,8 +34,11 @@
 
 #include <rec_client_core/ecal_rec_logger.h>
 
+#include <ecalhdf5/eh5_meas.h>
+
 #include <algorithm>
 #include <fstream>
+#include <functional>
 #include <sstream>
 #include <string>
 
@@ -44,13 +47,29 @@ namespace eCAL
 {
   namespace rec
   {
+    namespace
+    {
+      // Multiple HDF5 writers must not run in parallel, if the HDF5 library
+      // has not been built thread-safe. In that case we fall back to a
+      // single writer.
+      JobConfig LimitWriterThreadCount(const JobConfig& job_config)
+      {
+        JobConfig limited_job_config(job_config);
+        if ((limited_job_config.GetWriterThreadCount() > 1) && !eCAL::eh5::HDF5Meas::IsThreadSafe())
+        {
+          EcalRecLogger::Instance()->warn("HDF5 library is not thread-safe. Using 1 HDF5 writer instead of " + std::to_string(limited_job_config.GetWriterThreadCount()));
+          limited_job_config.SetWriterThreadCount(1);
+        }
+        return limited_job_config;
+      }
+    }
 
     ///////////////////////////////////////////////
     // Constructor & Destructor
     ///////////////////////////////////////////////
 
     RecordJob::RecordJob(const JobConfig& evaluated_job_config)
-      : job_config_         (evaluated_job_config)
+      : job_config_         (LimitWriterThreadCount(evaluated_job_config))
       , main_recorder_state_(JobState::NotStarted)
       , safe_to_delete_dir_ (false)
       , is_deleted_         (false)
@@ -59,12 +78,15 @@ namespace eCAL
 
     RecordJob::~RecordJob()
     {
-      if (hdf5_writer_thread_)
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
       {
-        hdf5_writer_thread_->Interrupt();
-        hdf5_writer_thread_->Join();
-        hdf5_writer_thread_ = nullptr;
+        hdf5_writer_thread->Interrupt();
       }
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
+      {
+        hdf5_writer_thread->Join();
+      }
+      hdf5_writer_threads_.clear();
 #ifdef ECAL_HAS_CURL
       if (ftp_upload_thread_)
       {
@@ -77,11 +99,11 @@ namespace eCAL
 
     void RecordJob::Interrupt()
     {
-      if (hdf5_writer_thread_)
-        hdf5_writer_thread_->Interrupt();
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
+        hdf5_writer_thread->Interrupt();
 #ifdef ECAL_HAS_CURL
       if (ftp_upload_thread_)
-        hdf5_writer_thread_->Interrupt();
+        ftp_upload_thread_->Interrupt();
 #endif // ECAL_HAS_CURL
     }
 
@@ -292,8 +314,11 @@ namespace eCAL
         return false;
       }
 
-      hdf5_writer_thread_ = std::make_unique<Hdf5WriterThread>(job_config_, initial_topic_info_map, initial_frame_buffer);
-      hdf5_writer_thread_->Start();
+      CreateHdf5WriterThreads_NoLock(initial_topic_info_map, initial_frame_buffer);
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
+      {
+        hdf5_writer_thread->Start();
+      }
 
       main_recorder_state_ = JobState::Recording;
 
@@ -304,12 +329,15 @@ namespace eCAL
     {
       std::unique_lock<std::shared_timed_mutex> lock(job_mutex_);
 
-      if ((main_recorder_state_ != JobState::Recording) || !hdf5_writer_thread_)
+      if ((main_recorder_state_ != JobState::Recording) || hdf5_writer_threads_.empty())
       {
         return false;
       }
 
-      hdf5_writer_thread_->Flush();
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
+      {
+        hdf5_writer_thread->Flush();
+      }
 
       main_recorder_state_ = JobState::Flushing;
 
@@ -326,9 +354,12 @@ namespace eCAL
         return false;
       }
 
-      hdf5_writer_thread_ = std::make_unique<Hdf5WriterThread>(job_config_, topic_info_map, frame_buffer);
-      hdf5_writer_thread_->Flush();
-      hdf5_writer_thread_->Start();
+      CreateHdf5WriterThreads_NoLock(topic_info_map, frame_buffer);
+      for (auto& hdf5_writer_thread : hdf5_writer_threads_)
+      {
+        hdf5_writer_thread->Flush();
+        hdf5_writer_thread->Start();
+      }
 
       main_recorder_state_ = JobState::Flushing;
 
@@ -338,19 +369,34 @@ namespace eCAL
     bool RecordJob::AddFrame(const std::shared_ptr<Frame>& frame)
     {
       std::shared_lock<std::shared_timed_mutex> lock(job_mutex_);
-      if ((main_recorder_state_ != JobState::Recording) || !hdf5_writer_thread_)
+      if ((main_recorder_state_ != JobState::Recording) || hdf5_writer_threads_.empty())
         return false;
 
-      return hdf5_writer_thread_->AddFrame(frame);
+      return hdf5_writer_threads_[GetWriterIndex(frame->topic_name_)]->AddFrame(frame);
     }
 
     void RecordJob::SetTopicInfo(const std::map<std::string, TopicInfo>& topic_info_map)
     {
       std::shared_lock<std::shared_timed_mutex> lock(job_mutex_);
-      if ((main_recorder_state_ != JobState::Recording) || !hdf5_writer_thread_)
+      if ((main_recorder_state_ != JobState::Recording) || hdf5_writer_threads_.empty())
+        return;
+
+      if (hdf5_writer_threads_.size() == 1)
+      {
+        hdf5_writer_threads_.front()->SetTopicInfo(topic_info_map);
         return;
+      }
 
-      hdf5_writer_thread_->SetTopicInfo(topic_info_map);
+      // Each writer only receives the topics that are assigned to it
+      std::vector<std::map<std::string, TopicInfo>> topic_info_maps(hdf5_writer_threads_.size());
+      for (const auto& topic_info : topic_info_map)
+      {
+        topic_info_maps[GetWriterIndex(topic_info.first)].emplace(topic_info);
+      }
+      for (size_t i = 0; i < hdf5_writer_threads_.size(); ++i)
+      {
+        hdf5_writer_threads_[i]->SetTopicInfo(std::move(topic_info_maps[i]));
+      }
     }
 
     eCAL::rec::Error RecordJob::Upload(const UploadConfig& upload_config)
@@ -554,9 +600,39 @@ namespace eCAL
         std::shared_lock<std::shared_timed_mutex> lock(job_mutex_);
         job_status.state_ = main_recorder_state_;
 
-        if (hdf5_writer_thread_)
+        if (!hdf5_writer_threads_.empty())
         {
-          job_status.rec_hdf5_status_ = hdf5_writer_thread_->GetStatus();
+          // Merge the status of all writers. The first error of any writer wins.
+          // The total length spans from the first to the last frame of any writer.
+          bool                                  has_frames = false;
+          std::chrono::steady_clock::time_point first_frame_time;
+          std::chrono::steady_clock::time_point last_frame_time;
+
+          for (const auto& hdf5_writer_thread : hdf5_writer_threads_)
+          {
+            const RecHdf5JobStatus writer_status = hdf5_writer_thread->GetStatus();
+
+            std::chrono::steady_clock::time_point writer_first_frame_time;
+            std::chrono::steady_clock::time_point writer_last_frame_time;
+            if (hdf5_writer_thread->GetFrameTimeRange(writer_first_frame_time, writer_last_frame_time))
+            {
+              first_frame_time = has_frames ? std::min(first_frame_time, writer_first_frame_time) : writer_first_frame_time;
+              last_frame_time  = has_frames ? std::max(last_frame_time,  writer_last_frame_time)  : writer_last_frame_time;
+              has_frames       = true;
+            }
+
+            job_status.rec_hdf5_status_.total_frame_count_     += writer_status.total_frame_count_;
+            job_status.rec_hdf5_status_.unflushed_frame_count_ += writer_status.unflushed_frame_count_;
+
+            if (job_status.rec_hdf5_status_.info_.first && !writer_status.info_.first)
+            {
+              job_status.rec_hdf5_status_.info_ = writer_status.info_;
+            }
+          }
+          if (has_frames)
+          {
+            job_status.rec_hdf5_status_.total_length_ = last_frame_time - first_frame_time;
+          }
           if (job_status.rec_hdf5_status_.info_.first)
           {
             job_status.rec_hdf5_status_.info_ = info_;
@@ -612,11 +688,16 @@ namespace eCAL
     {
       if (main_recorder_state_ == JobState::Flushing)
       {
-        // Flushing -> FinishedFlushing, if recorder finished flushing.
-        if (hdf5_writer_thread_
-          && (!hdf5_writer_thread_->IsRunning() || !hdf5_writer_thread_->IsFlushing()))
+        // Flushing -> FinishedFlushing, if all writers finished flushing.
+        if (!hdf5_writer_threads_.empty()
+          && std::all_of(hdf5_writer_threads_.begin(), hdf5_writer_threads_.end()
+                        , [](const std::unique_ptr<Hdf5WriterThread>& hdf5_writer_thread)
+                          {
+                            return (!hdf5_writer_thread->IsRunning() || !hdf5_writer_thread->IsFlushing());
+                          }))
         {
           main_recorder_state_ = JobState::FinishedFlushing;
+          EcalRecLogger::Instance()->info("Finished saving measurement");
         }
       }
       else if (main_recorder_state_ == JobState::Uploading)
@@ -637,5 +718,51 @@ namespace eCAL
       std::unique_lock<std::shared_timed_mutex> lock(job_mutex_);
       UpdateJobState_NoLock();
     }
+
+    void RecordJob::CreateHdf5WriterThreads_NoLock(const std::map<std::string, TopicInfo>& topic_info_map, const std::deque<std::shared_ptr<Frame>>& frame_buffer)
+    {
+      const unsigned int writer_thread_count = job_config_.GetWriterThreadCount();
+
+      EcalRecLogger::Instance()->info("Measurement directory: " + job_config_.GetCompleteMeasurementPath());
+
+      hdf5_writer_threads_.clear();
+      hdf5_writer_threads_.reserve(writer_thread_count);
+
+      if (writer_thread_count <= 1)
+      {
+        hdf5_writer_threads_.push_back(std::make_unique<Hdf5WriterThread>(job_config_, 0, topic_info_map, frame_buffer));
+        return;
+      }
+
+      // Split the topic info and the (pre-)buffered frames by writer. As we
+      // iterate the frame buffer in order, the order of frames is preserved
+      // for each topic.
+      std::vector<std::map<std::string, TopicInfo>>   topic_info_maps(writer_thread_count);
+      std::vector<std::deque<std::shared_ptr<Frame>>> frame_buffers  (writer_thread_count);
+
+      for (const auto& topic_info : topic_info_map)
+      {
+        topic_info_maps[GetWriterIndex(topic_info.first)].emplace(topic_info);
+      }
+      for (const auto& frame : frame_buffer)
+      {
+        frame_buffers[GetWriterIndex(frame->topic_name_)].push_back(frame);
+      }
+
+      EcalRecLogger::Instance()->info("Distributing topics across " + std::to_string(writer_thread_count) + " HDF5 writers");
+
+      for (unsigned int i = 0; i < writer_thread_count; ++i)
+      {
+        hdf5_writer_threads_.push_back(std::make_unique<Hdf5WriterThread>(job_config_, i, topic_info_maps[i], frame_buffers[i]));
+      }
+    }
+
+    size_t RecordJob::GetWriterIndex(const std::string& topic_name) const
+    {
+      if (job_config_.GetWriterThreadCount() <= 1)
+        return 0;
+
+      return std::hash<std::string>{}(topic_name) % job_config_.GetWriterThreadCount();
+    }
   }
 }
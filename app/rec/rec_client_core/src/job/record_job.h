@@ -26,6 +26,7 @@
 #include <shared_mutex>
 #include <deque>
 #include <string>
+#include <vector>
 
 #include <rec_client_core/state.h>
 #include <rec_client_core/job_config.h>
@@ -100,14 +101,17 @@ namespace eCAL
       void UpdateJobState_NoLock() const;
       void UpdateJobState() const;
 
+      void   CreateHdf5WriterThreads_NoLock(const std::map<std::string, TopicInfo>& topic_info_map, const std::deque<std::shared_ptr<Frame>>& frame_buffer);
+      size_t GetWriterIndex(const std::string& topic_name) const;
+
     ///////////////////////////////////////////////
     // Member Variables
     ///////////////////////////////////////////////
     private:
       mutable std::shared_timed_mutex          job_mutex_;
 
-      const JobConfig                          job_config_;
-      std::unique_ptr<Hdf5WriterThread>        hdf5_writer_thread_;
+      const JobConfig                                 job_config_;
+      std::vector<std::unique_ptr<Hdf5WriterThread>>  hdf5_writer_threads_;     /**< Pool of writers. Each topic is assigned to exactly one writer, so the order of frames is preserved per topic. */
 
 #ifdef ECAL_HAS_CURL
       std::unique_ptr<FtpUploadThread>         ftp_upload_thread_;
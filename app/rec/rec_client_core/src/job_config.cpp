@@ -34,6 +34,8 @@ namespace eCAL
       : job_id_(0)
       , max_file_size_mb_(1000)
       , one_file_per_topic_(false)
+      , writer_thread_count_(1)
+      , compression_level_(0)
     {}
 
     JobConfig::~JobConfig()
@@ -78,6 +80,24 @@ namespace eCAL
     void            JobConfig::SetDescription           (const std::string& description)   { description_ = description; }
     std::string     JobConfig::GetDescription           () const                           { return description_; }
 
+    void            JobConfig::SetWriterThreadCount     (unsigned int writer_thread_count) { writer_thread_count_ = (writer_thread_count > 0 ? writer_thread_count : 1); }
+    unsigned int    JobConfig::GetWriterThreadCount     () const                           { return writer_thread_count_; }
+
+    void            JobConfig::SetCompressionLevel      (int compression_level)            { compression_level_ = compression_level; }
+    int             JobConfig::GetCompressionLevel      () const                           { return compression_level_; }
+
+    void                       JobConfig::SetTopicCompressionLevels(const std::map<std::string, int>& topic_compression_levels) { topic_compression_levels_ = topic_compression_levels; }
+    std::map<std::string, int> JobConfig::GetTopicCompressionLevels() const                                                      { return topic_compression_levels_; }
+
+    int JobConfig::GetCompressionLevel(const std::string& topic_name) const
+    {
+      auto topic_compression_level_it = topic_compression_levels_.find(topic_name);
+      if (topic_compression_level_it != topic_compression_levels_.end())
+        return topic_compression_level_it->second;
+      else
+        return compression_level_;
+    }
+
     //////////////////////////////
     // Evaluation
     //////////////////////////////
@@ -619,6 +619,15 @@ namespace eCAL
       (*job_config_pb)["description"]          = job_config.GetDescription();
       (*job_config_pb)["max_file_size_mib"]    = std::to_string(job_config.GetMaxFileSize());
       (*job_config_pb)["one_file_per_topic"]   = job_config.GetOneFilePerTopicEnabled() ? "true" : "false";
+      (*job_config_pb)["writer_thread_count"]  = std::to_string(job_config.GetWriterThreadCount());
+      (*job_config_pb)["compression_level"]    = std::to_string(job_config.GetCompressionLevel());
+
+      std::string topic_compression_levels;
+      for (const auto& topic_compression_level : job_config.GetTopicCompressionLevels())
+      {
+        topic_compression_levels += topic_compression_level.first + ":" + std::to_string(topic_compression_level.second) + "\n";
+      }
+      (*job_config_pb)["topic_compression_levels"] = topic_compression_levels;
     }
 
     void RemoteRecorder::SetUploadConfig(google::protobuf::Map<std::string, std::string>* upload_config_pb, const eCAL::rec::UploadConfig& upload_config)
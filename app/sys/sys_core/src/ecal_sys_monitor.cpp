@@ -24,7 +24,7 @@
 
 #include <ecal/ecal.h>
 
-#include <ecal/core/pb/monitoring.pb.h>
+#include <ecal/ecal_monitoring_struct.h>
 #include <ecal/app/pb/sys/state.pb.h>
 #include <ecal/core/pb/process.pb.h>
 
@@ -35,7 +35,17 @@
 #include <ecal_utils/ecal_utils.h>
 #include <ecal_utils/filesystem.h>
 
-
+namespace
+{
+  TaskState GetTaskState(const eCAL::Monitoring::SProcessMon& process)
+  {
+    eCAL::pb::ProcessState process_state_pb;
+    process_state_pb.set_severity((eCAL::pb::eProcessSeverity)process.state_severity);
+    process_state_pb.set_severity_level((eCAL::pb::eProcessSeverityLevel)process.state_severity_level);
+    process_state_pb.set_info(process.state_info);
+    return eCAL::sys::proto_helpers::FromProtobuf(process_state_pb);
+  }
+}
 
 EcalSysMonitor::EcalSysMonitor(EcalSys& ecalsys_instance, std::chrono::nanoseconds loop_time)
   : InterruptibleLoopThread(loop_time)
@@ -45,9 +55,7 @@ EcalSysMonitor::EcalSysMonitor(EcalSys& ecalsys_instance, std::chrono::nanosecon
   , m_hosts_running_ecal_sys_client()
   , m_hosts_running_ecalsys()
   , m_monitor_update_callback_valid(false)
-{
-  m_monitoring_pb.Clear();
-}
+{}
 
 
 EcalSysMonitor::~EcalSysMonitor()
@@ -80,32 +88,36 @@ void EcalSysMonitor::Loop()
 
 void EcalSysMonitor::UpdateMonitor()
 {
-  std::string monitoring_string;
-  if (eCAL::Monitoring::GetMonitoring(monitoring_string))
+  // only the process states are needed, so neither the topics and services nor the process threads are queried
+  eCAL::Monitoring::SMonitoringQuery query;
+  query.entities = eCAL::Monitoring::Entity::Process;
+  query.fields   = eCAL::Monitoring::Field::None;
+
+  eCAL::Monitoring::SMonitoring monitoring;
+  if (eCAL::Monitoring::GetMonitoring(monitoring, query))
   {
     std::lock_guard<std::recursive_mutex> lock(m_monitoring_mutex);
-    m_monitoring_pb.Clear();
-    m_monitoring_pb.ParseFromString(monitoring_string);
+    m_monitoring = std::move(monitoring);
 
     // Clear all lists
     m_all_hosts.clear();
     m_hosts_running_ecal_sys_client.clear();
     m_hosts_running_ecalsys.clear();
 
-    for (const auto& process : m_monitoring_pb.processes())
+    for (const auto& process : m_monitoring.process)
     {
       // Update list of all Hosts
-      m_all_hosts.emplace(process.hname());
+      m_all_hosts.emplace(process.hname);
 
       //Update list of available Targets
-      if (process.uname() == "eCALSysClient")
+      if (process.uname == "eCALSysClient")
       {
-        m_hosts_running_ecal_sys_client.emplace(process.hname());
+        m_hosts_running_ecal_sys_client.emplace(process.hname);
       }
       // Update list of hosts running eCAL Sys
-      if ((process.uname() == "eCALSys") || (process.uname() == "eCALSysGUI"))
+      if ((process.uname == "eCALSys") || (process.uname == "eCALSysGUI"))
       {
-        m_hosts_running_ecalsys.push_back(std::pair<std::string, int>(process.hname(), process.pid()));
+        m_hosts_running_ecalsys.push_back(std::pair<std::string, int>(process.hname, process.pid));
       }
     }
   }
@@ -144,17 +156,17 @@ void EcalSysMonitor::UpdateTaskStates(const std::list<std::shared_ptr<EcalSysTas
     }
     else {
       // Monitoring enabled => search in monitored processes for the current task
-      for (auto& process : m_monitoring_pb.processes())
+      for (auto& process : m_monitoring.process)
       {
         std::vector<int> task_pids = task->GetPids();
 
 
-        if ((task->GetHostStartedOn() == process.hname())
-          && (std::find(task_pids.begin(), task_pids.end(), (int)process.pid()) != task_pids.end()))
+        if ((task->GetHostStartedOn() == process.hname)
+          && (std::find(task_pids.begin(), task_pids.end(), process.pid) != task_pids.end()))
         {
           // The task is matching!
           task_mapping_found = true;
-          task_state         = eCAL::sys::proto_helpers::FromProtobuf(process.state());
+          task_state         = GetTaskState(process);
           break;
         }
       }
@@ -272,14 +284,14 @@ std::list<std::shared_ptr<EcalSysTask>> EcalSysMonitor::GetTasksFromCloud()
 
   std::lock_guard<std::recursive_mutex> monitoring_lock(m_monitoring_mutex);
 
-  for (const auto& monitor_process : m_monitoring_pb.processes())
+  for (const auto& monitor_process : m_monitoring.process)
   {
-    std::string monitor_process_name = EcalUtils::String::Trim(monitor_process.uname());
-    std::string monitor_process_path = EcalUtils::String::Trim(monitor_process.pname());
-    std::string monitor_process_args = EcalUtils::String::Trim(monitor_process.pparam());
-    std::string monitor_process_host = EcalUtils::String::Trim(monitor_process.hname());
-    int pid                          = monitor_process.pid();
-    TaskState task_state             = eCAL::sys::proto_helpers::FromProtobuf(monitor_process.state());
+    std::string monitor_process_name = EcalUtils::String::Trim(monitor_process.uname);
+    std::string monitor_process_path = EcalUtils::String::Trim(monitor_process.pname);
+    std::string monitor_process_args = EcalUtils::String::Trim(monitor_process.pparam);
+    std::string monitor_process_host = EcalUtils::String::Trim(monitor_process.hname);
+    int pid                          = monitor_process.pid;
+    TaskState task_state             = GetTaskState(monitor_process);
 
     // If the process has no name we use the executable's name instead
     if (monitor_process_name == "")
@@ -293,7 +305,7 @@ std::list<std::shared_ptr<EcalSysTask>> EcalSysMonitor::GetTasksFromCloud()
     std::string algo_path;
     std::string algo_params;
 
-    std::vector<std::string> algo_cmdline_vector = EcalUtils::CommandLine::splitCommandLine(monitor_process.pparam(), 2); // Split command line in algo + arguments
+    std::vector<std::string> algo_cmdline_vector = EcalUtils::CommandLine::splitCommandLine(monitor_process.pparam, 2); // Split command line in algo + arguments
     if(algo_cmdline_vector.size() == 0)
     {
       algo_path = monitor_process_path;
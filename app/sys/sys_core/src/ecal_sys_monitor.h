@@ -22,6 +22,7 @@
 #include <chrono>
 #include <set>
 
+#include <ecal/ecal_monitoring_struct.h>
 #include <ecal/msg/protobuf/publisher.h>
 
 #include "threading/interruptible_loop_thread.h"
@@ -33,7 +34,6 @@
 #pragma warning(push)
 #pragma warning(disable: 4100 4127 4146 4505 4800 4189 4592) // disable proto warnings
 #endif
-#include <ecal/core/pb/monitoring.pb.h>
 #include <ecal/app/pb/sys/state.pb.h>
 #ifdef _MSC_VER
 #pragma warning(pop)
@@ -125,8 +125,8 @@ private:
   EcalSys& m_ecalsys_instance;
   eCAL::protobuf::CPublisher<eCAL::pb::sys::State>  m_state_publisher;                 /**< The publisher that sends information on the current state of all tasks and groups */
 
-  std::recursive_mutex                              m_monitoring_mutex;                /**< A mutex protecting the m_monitoring_pb variable as well as the different host-lists */
-  eCAL::pb::Monitoring                              m_monitoring_pb;                   /**< The object we get from deserializing the monitoring string. As that procedure might be expensive, we save the result in this variable */
+  std::recursive_mutex                              m_monitoring_mutex;                /**< A mutex protecting the m_monitoring variable as well as the different host-lists */
+  eCAL::Monitoring::SMonitoring                     m_monitoring;                      /**< The processes of the last monitoring query. Only the processes are queried, as the topics and services are not needed */
   std::set<std::string>                             m_all_hosts;                       /**< A list of all hosts that are running any eCAL based software */
   std::set<std::string>                             m_hosts_running_ecal_sys_client;   /**< A list of all hosts where we found a running eCAL sys client during monitoring */
   std::vector<std::pair<std::string, int>>          m_hosts_running_ecalsys;           /**< A list of all hosts where we found a running eCAL Sys instance. Using multiple eCAL Sys instances might cause undefined behaviour, as each instance cannot track the current state of the tasks properly. Thus, we want to warn the user about that */
@@ -141,7 +141,7 @@ private:
    * @brief Queries the available monitor information and stores them as member variables
    *
    * This method updates:
-   *    m_monitoring_pb
+   *    m_monitoring
    *    m_all_hosts
    *    m_hosts_running_ecal_sys_client
    *    m_hosts_running_ecalsys
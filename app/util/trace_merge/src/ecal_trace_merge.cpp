@@ -0,0 +1,100 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief eCALTraceMerge Console Application
+ *
+ * Merges the Chrome trace files written by the eCAL core trace points
+ * (ECAL_CORE_TRACING build option, experimental/trace_file) of several
+ * processes into one trace.
+**/
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+#include "trace_merge.h"
+
+int main(int argc, char** argv)
+{
+  std::vector<std::string> input_files;
+  std::string              output_file;
+  bool                     align(true);
+
+  try
+  {
+    TCLAP::CmdLine cmd("eCALTraceMerge");
+    TCLAP::ValueArg<std::string>          output_arg  ("o", "output",   "Merged trace file.",                                   false, "ecal_trace_merged.json", "string");
+    TCLAP::SwitchArg                      no_align_arg("",  "no-align", "Do not align the clocks of traces from other hosts.", false);
+    TCLAP::UnlabeledMultiArg<std::string> input_arg   ("input", "Trace files written by the eCAL processes.",                  true,  "string");
+    cmd.add(output_arg);
+    cmd.add(no_align_arg);
+    cmd.add(input_arg);
+    cmd.parse(argc, argv);
+
+    input_files = input_arg.getValue();
+    output_file = output_arg.getValue();
+    align       = !no_align_arg.getValue();
+  }
+  catch (TCLAP::ArgException& e)
+  {
+    std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<TraceMerge::STrace> traces;
+  for (const auto& input_file : input_files)
+  {
+    std::ifstream input(input_file);
+    if (!input.is_open())
+    {
+      std::cerr << "Could not open " << input_file << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    TraceMerge::STrace trace;
+    trace.file_name = input_file;
+    if (!TraceMerge::LoadTrace(input, trace))
+    {
+      std::cerr << "Could not read " << input_file << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << "Loaded " << trace.events.size() << " events of process " << trace.pid << " (" << trace.host << ") from " << input_file << std::endl;
+    traces.push_back(std::move(trace));
+  }
+
+  if (align) TraceMerge::AlignHosts(traces, std::cout);
+
+  std::ofstream file(output_file);
+  if (!file.is_open())
+  {
+    std::cerr << "Could not open " << output_file << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const size_t flow_count = TraceMerge::WriteMergedTrace(traces, file);
+
+  std::cout << "Merged " << traces.size() << " traces with " << flow_count << " sample transmissions into " << output_file << std::endl;
+
+  return EXIT_SUCCESS;
+}
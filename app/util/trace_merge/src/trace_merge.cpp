@@ -0,0 +1,252 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Merge of the Chrome trace files of several eCAL processes
+**/
+
+#include "trace_merge.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <set>
+
+namespace
+{
+  const std::string g_write_event = "CDataWriter::Write";
+  const std::string g_apply_event = "CSubGate::ApplySample";
+
+  // the exporter writes one event per line, so a simple key lookup is sufficient
+  bool FindValue(const std::string& line_, const std::string& key_, std::string& value_)
+  {
+    const std::string pattern = "\"" + key_ + "\": ";
+    const size_t pos = line_.find(pattern);
+    if (pos == std::string::npos) return false;
+
+    size_t begin = pos + pattern.size();
+    size_t end(0);
+    if (line_[begin] == '"')
+    {
+      begin++;
+      end = begin;
+      while ((end < line_.size()) && (line_[end] != '"'))
+      {
+        if (line_[end] == '\\') end++;
+        end++;
+      }
+    }
+    else
+    {
+      end = line_.find_first_of(",}", begin);
+      if (end == std::string::npos) end = line_.size();
+    }
+    value_ = line_.substr(begin, end - begin);
+    return true;
+  }
+}
+
+namespace TraceMerge
+{
+  bool LoadTrace(std::istream& stream_, STrace& trace_)
+  {
+    std::string line;
+    std::string value;
+    while (std::getline(stream_, line))
+    {
+      if (line.find("\"otherData\"") != std::string::npos)
+      {
+        if (FindValue(line, "host", value)) trace_.host = value;
+        if (FindValue(line, "pid",  value)) trace_.pid  = std::stoll(value);
+        continue;
+      }
+
+      if (!FindValue(line, "ph", value)) continue;
+
+      if (value == "M")
+      {
+        // strip the separator, it is added again on output
+        while (!line.empty() && (line.back() == ',')) line.pop_back();
+        trace_.metadata.push_back(line);
+      }
+      else if (value == "X")
+      {
+        SEvent event;
+        if (FindValue(line, "name",  value)) event.name  = value;
+        if (FindValue(line, "tid",   value)) event.tid   = std::stoll(value);
+        if (FindValue(line, "ts",    value)) event.ts    = std::stod(value);
+        if (FindValue(line, "dur",   value)) event.dur   = std::stod(value);
+        if (FindValue(line, "hash",  value)) event.hash  = value;
+        if (FindValue(line, "clock", value)) event.clock = std::stoll(value);
+        trace_.events.push_back(event);
+      }
+    }
+
+    return !stream_.bad();
+  }
+
+  SampleMapT CollectSamples(const std::vector<STrace>& traces_, const std::string& event_name_)
+  {
+    SampleMapT samples;
+    for (size_t t = 0; t < traces_.size(); ++t)
+    {
+      for (const auto& event : traces_[t].events)
+      {
+        if ((event.name == event_name_) && (event.hash != "0"))
+        {
+          samples[std::make_pair(event.hash, event.clock)].emplace_back(t, &event);
+        }
+      }
+    }
+    return samples;
+  }
+
+  // aligns the host clocks one after another to the hosts already aligned
+  void AlignHosts(std::vector<STrace>& traces_, std::ostream& log_)
+  {
+    if (traces_.empty()) return;
+
+    const SampleMapT writes  = CollectSamples(traces_, g_write_event);
+    const SampleMapT applies = CollectSamples(traces_, g_apply_event);
+
+    std::set<std::string> aligned_hosts;
+    std::map<std::string, double> host_offsets;
+    aligned_hosts.insert(traces_.front().host);
+    host_offsets[traces_.front().host] = 0.0;
+
+    bool progress(true);
+    while (progress)
+    {
+      progress = false;
+      for (const auto& trace : traces_)
+      {
+        const std::string& host = trace.host;
+        if (aligned_hosts.count(host) != 0) continue;
+
+        // the aligned reception must not happen before the aligned write:
+        // host receives from aligned host : offset <= min(ts_read - aligned ts_write)
+        // host sends to aligned host      : offset >= max(ts_write - aligned ts_read)
+        double max_offset = std::numeric_limits<double>::max();
+        double min_offset = std::numeric_limits<double>::lowest();
+        for (const auto& write : writes)
+        {
+          auto apply = applies.find(write.first);
+          if (apply == applies.end()) continue;
+          for (const auto& w : write.second)
+          {
+            const STrace& wtrace = traces_[w.first];
+            for (const auto& a : apply->second)
+            {
+              const STrace& atrace = traces_[a.first];
+              if ((atrace.host == host) && (aligned_hosts.count(wtrace.host) != 0))
+              {
+                max_offset = std::min(max_offset, a.second->ts - (w.second->ts - host_offsets[wtrace.host]));
+              }
+              if ((wtrace.host == host) && (aligned_hosts.count(atrace.host) != 0))
+              {
+                min_offset = std::max(min_offset, w.second->ts - (a.second->ts - host_offsets[atrace.host]));
+              }
+            }
+          }
+        }
+
+        if (max_offset != std::numeric_limits<double>::max())
+        {
+          host_offsets[host] = max_offset;
+        }
+        else if (min_offset != std::numeric_limits<double>::lowest())
+        {
+          host_offsets[host] = min_offset;
+        }
+        else
+        {
+          continue;
+        }
+
+        aligned_hosts.insert(host);
+        progress = true;
+        log_ << "Host " << host << " shifted by " << std::fixed << std::setprecision(3) << -host_offsets[host] << " us" << std::endl;
+      }
+    }
+
+    for (auto& trace : traces_)
+    {
+      if (aligned_hosts.count(trace.host) == 0)
+      {
+        log_ << "Host " << trace.host << " has no samples in common with the other hosts, it is not aligned" << std::endl;
+        continue;
+      }
+      trace.offset = host_offsets[trace.host];
+    }
+  }
+
+  size_t WriteMergedTrace(const std::vector<STrace>& traces_, std::ostream& stream_)
+  {
+    stream_ << "{\n";
+    stream_ << "\"displayTimeUnit\": \"ns\",\n";
+    stream_ << "\"traceEvents\": [";
+    stream_ << std::fixed << std::setprecision(3);
+
+    bool first(true);
+    auto separator = [&first]() { const char* sep = first ? "\n" : ",\n"; first = false; return sep; };
+
+    for (const auto& trace : traces_)
+    {
+      for (const auto& metadata : trace.metadata) stream_ << separator() << metadata;
+      for (const auto& event : trace.events)
+      {
+        stream_ << separator() << "{\"name\": \"" << event.name << "\", \"cat\": \"ecal\", \"ph\": \"X\"";
+        stream_ << ", \"pid\": " << trace.pid << ", \"tid\": " << event.tid;
+        stream_ << ", \"ts\": " << event.ts - trace.offset << ", \"dur\": " << event.dur;
+        stream_ << ", \"args\": {\"hash\": \"" << event.hash << "\", \"clock\": " << event.clock << "}}";
+      }
+    }
+
+    // connect the write of a sample with all its receptions in other processes
+    const SampleMapT writes  = CollectSamples(traces_, g_write_event);
+    const SampleMapT applies = CollectSamples(traces_, g_apply_event);
+
+    size_t flow_id(0);
+    for (const auto& write : writes)
+    {
+      auto apply = applies.find(write.first);
+      if (apply == applies.end()) continue;
+
+      for (const auto& w : write.second)
+      {
+        const STrace& wtrace = traces_[w.first];
+        for (const auto& a : apply->second)
+        {
+          const STrace& atrace = traces_[a.first];
+          if (atrace.pid == wtrace.pid && atrace.host == wtrace.host) continue;
+
+          flow_id++;
+          stream_ << separator() << "{\"name\": \"sample\", \"cat\": \"ecal\", \"ph\": \"s\", \"id\": " << flow_id;
+          stream_ << ", \"pid\": " << wtrace.pid << ", \"tid\": " << w.second->tid << ", \"ts\": " << w.second->ts - wtrace.offset << "}";
+          stream_ << separator() << "{\"name\": \"sample\", \"cat\": \"ecal\", \"ph\": \"f\", \"bp\": \"e\", \"id\": " << flow_id;
+          stream_ << ", \"pid\": " << atrace.pid << ", \"tid\": " << a.second->tid << ", \"ts\": " << a.second->ts - atrace.offset << "}";
+        }
+      }
+    }
+
+    stream_ << "\n]\n}\n";
+
+    return flow_id;
+  }
+}
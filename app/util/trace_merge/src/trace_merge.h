@@ -0,0 +1,89 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Merge of the Chrome trace files of several eCAL processes
+ *
+ * Writer and reader events of the same sample are matched by the sample hash
+ * and clock and connected by flow arrows.
+ *
+ * Processes on the same host share the steady clock. The clocks of other
+ * hosts are shifted, so that the fastest transmission between two hosts
+ * takes no time. The real offset is therefore smaller by the minimum
+ * transport latency.
+**/
+
+#pragma once
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace TraceMerge
+{
+  struct SEvent
+  {
+    std::string  name;
+    long long    tid   = 0;
+    double       ts    = 0.0;
+    double       dur   = 0.0;
+    std::string  hash;
+    long long    clock = 0;
+  };
+
+  struct STrace
+  {
+    std::string               file_name;
+    std::string               host;
+    long long                 pid    = 0;
+    double                    offset = 0.0;   // subtracted from all timestamps on output
+    std::vector<std::string>  metadata;
+    std::vector<SEvent>       events;
+  };
+
+  // sample (hash, clock) -> (trace index, event) of all traces
+  typedef std::map<std::pair<std::string, long long>, std::vector<std::pair<size_t, const SEvent*>>> SampleMapT;
+
+  /**
+   * @brief Parses a trace written by eCAL::Trace::Export.
+  **/
+  bool LoadTrace(std::istream& stream_, STrace& trace_);
+
+  /**
+   * @brief Collects the events with the given name of all traces by sample.
+  **/
+  SampleMapT CollectSamples(const std::vector<STrace>& traces_, const std::string& event_name_);
+
+  /**
+   * @brief Sets the offsets of all traces, starting with the host of the first
+   *        trace, that keeps its clock. The offsets of hosts without any
+   *        sample in common with an aligned host stay 0.
+  **/
+  void AlignHosts(std::vector<STrace>& traces_, std::ostream& log_);
+
+  /**
+   * @brief Writes the merged trace.
+   *
+   * @return  Number of sample transmissions connected by flow events.
+  **/
+  size_t WriteMergedTrace(const std::vector<STrace>& traces_, std::ostream& stream_);
+}
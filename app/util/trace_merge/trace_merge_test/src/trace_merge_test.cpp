@@ -0,0 +1,125 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "trace_merge.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  struct STestEvent
+  {
+    std::string  name;
+    double       ts;
+    std::string  hash;
+    long long    clock;
+  };
+
+  // a trace in the format written by eCAL::Trace::Export
+  std::string CreateTrace(const std::string& host_, long long pid_, const std::vector<STestEvent>& events_)
+  {
+    std::stringstream trace;
+    trace << "{\n";
+    trace << "\"displayTimeUnit\": \"ns\",\n";
+    trace << "\"otherData\": {\"host\": \"" << host_ << "\", \"pid\": " << pid_ << ", \"unit_name\": \"unit\", \"clock\": \"steady\"},\n";
+    trace << "\"traceEvents\": [\n";
+    trace << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << pid_ << ", \"args\": {\"name\": \"unit (" << host_ << ")\"}}";
+    for (const auto& event : events_)
+    {
+      trace << ",\n{\"name\": \"" << event.name << "\", \"cat\": \"ecal\", \"ph\": \"X\", \"pid\": " << pid_ << ", \"tid\": 1";
+      trace << ", \"ts\": " << event.ts << ", \"dur\": 1.000, \"args\": {\"hash\": \"" << event.hash << "\", \"clock\": " << event.clock << "}}";
+    }
+    trace << "\n]\n}\n";
+    return trace.str();
+  }
+
+  TraceMerge::STrace LoadTrace(const std::string& trace_)
+  {
+    std::istringstream stream(trace_);
+    TraceMerge::STrace trace;
+    EXPECT_TRUE(TraceMerge::LoadTrace(stream, trace));
+    return trace;
+  }
+
+  const std::string write_event = "CDataWriter::Write";
+  const std::string apply_event = "CSubGate::ApplySample";
+}
+
+TEST(TraceMerge, LoadTrace)
+{
+  const auto trace = LoadTrace(CreateTrace("host_a", 42, { { write_event, 100.5, "123", 7 } }));
+
+  EXPECT_EQ("host_a", trace.host);
+  EXPECT_EQ(42, trace.pid);
+  EXPECT_EQ(1u, trace.metadata.size());
+  ASSERT_EQ(1u, trace.events.size());
+  EXPECT_EQ(write_event, trace.events[0].name);
+  EXPECT_DOUBLE_EQ(100.5, trace.events[0].ts);
+  EXPECT_EQ("123", trace.events[0].hash);
+  EXPECT_EQ(7, trace.events[0].clock);
+}
+
+TEST(TraceMerge, AlignThreeHosts)
+{
+  // clocks of the hosts relative to host_a, the reference
+  const double offset_b = 1000.0;
+  const double offset_c = 250.0;
+
+  // host_a sends sample 1 to host_b, host_b sends sample 2 to host_a and
+  // host_c sends sample 3 to host_b, all without transport latency
+  std::vector<TraceMerge::STrace> traces;
+  traces.push_back(LoadTrace(CreateTrace("host_a", 1, { { write_event, 100.0, "1", 1 }, { apply_event, 200.0, "2", 1 } })));
+  traces.push_back(LoadTrace(CreateTrace("host_b", 2, { { apply_event, 100.0 + offset_b, "1", 1 }, { write_event, 200.0 + offset_b, "2", 1 }, { apply_event, 300.0 + offset_b, "3", 1 } })));
+  traces.push_back(LoadTrace(CreateTrace("host_c", 3, { { write_event, 300.0 + offset_c, "3", 1 } })));
+
+  std::stringstream log;
+  TraceMerge::AlignHosts(traces, log);
+
+  // host_b receives from host_a, host_c only sends to the aligned host_b
+  EXPECT_DOUBLE_EQ(0.0,      traces[0].offset);
+  EXPECT_DOUBLE_EQ(offset_b, traces[1].offset);
+  EXPECT_DOUBLE_EQ(offset_c, traces[2].offset);
+
+  // every transmission is connected and starts and ends at the same time
+  std::stringstream merged;
+  EXPECT_EQ(3u, TraceMerge::WriteMergedTrace(traces, merged));
+
+  const std::string merged_trace = merged.str();
+  EXPECT_NE(std::string::npos, merged_trace.find("\"ph\": \"s\", \"id\": 1, \"pid\": 1, \"tid\": 1, \"ts\": 100.000}"));
+  EXPECT_NE(std::string::npos, merged_trace.find("\"ph\": \"f\", \"bp\": \"e\", \"id\": 1, \"pid\": 2, \"tid\": 1, \"ts\": 100.000}"));
+  EXPECT_NE(std::string::npos, merged_trace.find("\"ph\": \"s\", \"id\": 3, \"pid\": 3, \"tid\": 1, \"ts\": 300.000}"));
+  EXPECT_NE(std::string::npos, merged_trace.find("\"ph\": \"f\", \"bp\": \"e\", \"id\": 3, \"pid\": 2, \"tid\": 1, \"ts\": 300.000}"));
+}
+
+TEST(TraceMerge, UnrelatedHostIsNotAligned)
+{
+  std::vector<TraceMerge::STrace> traces;
+  traces.push_back(LoadTrace(CreateTrace("host_a", 1, { { write_event, 100.0, "1", 1 } })));
+  traces.push_back(LoadTrace(CreateTrace("host_b", 2, { { apply_event, 5000.0, "2", 1 } })));
+
+  std::stringstream log;
+  TraceMerge::AlignHosts(traces, log);
+
+  EXPECT_DOUBLE_EQ(0.0, traces[1].offset);
+  EXPECT_NE(std::string::npos, log.str().find("host_b has no samples in common"));
+}
@@ -123,6 +123,16 @@ namespace eCAL
       **/
       std::string GetFileVersion() const override;
 
+      /**
+       * @brief Checks whether the HDF5 library has been built thread-safe
+       *
+       *        Only then multiple HDF5Meas instances may be accessed from
+       *        different threads at the same time.
+       *
+       * @return  true if the HDF5 library is thread-safe, false otherwise
+      **/
+      static bool IsThreadSafe();
+
       /**
        * @brief Gets maximum allowed size for an individual file
        *
@@ -209,6 +219,17 @@ namespace eCAL
       **/
       void SetChannelType(const std::string& channel_name, const std::string& type) override;
 
+      /**
+       * @brief Set the compression of the given channel
+       *
+       * Entries that are added after calling this function are compressed
+       * with the given settings. Readers decompress the data transparently.
+       *
+       * @param channel_name  channel name
+       * @param compression   compression settings of the channel
+      **/
+      void SetChannelCompression(const std::string& channel_name, const Compression& compression) override;
+
       /**
        * @brief Gets minimum timestamp for specified channel
        *
@@ -243,8 +264,8 @@ namespace eCAL
        *        Header = timestamp + entry id
        *
        * @param [in]  channel_name channel name
-       * @param [in]  begin        time range begin timestamp
-       * @param [in]  end          time range end timestamp
+       * @param [in]  begin        time range begin timestamp (0 for the first entry)
+       * @param [in]  end          time range end timestamp (0 for the last entry)
        * @param [out] entries      header info for data entries in given range
        *
        * @return                   true if succeeds, false if it fails
@@ -50,5 +50,7 @@ namespace eCAL
     using eAccessType = eCAL::measurement::base::AccessType;
     using eCAL::measurement::base::RDONLY;
     using eCAL::measurement::base::CREATE;
+    using Compression = eCAL::measurement::base::Compression;
+    using CompressionCodec = eCAL::measurement::base::CompressionCodec;
   }  // namespace eh5
 }  // namespace eCAL
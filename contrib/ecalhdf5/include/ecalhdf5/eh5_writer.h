@@ -139,6 +139,17 @@ namespace eCAL
         **/
         void SetChannelType(const std::string& channel_name, const std::string& type) override { return measurement.SetChannelType(channel_name, type); }
 
+        /**
+         * @brief Set the compression of the given channel
+         *
+         * Entries that are added after calling this function are compressed
+         * with the given settings. Readers decompress the data transparently.
+         *
+         * @param channel_name  channel name
+         * @param compression   compression settings of the channel
+        **/
+        void SetChannelCompression(const std::string& channel_name, const measurement::base::Compression& compression) override { return measurement.SetChannelCompression(channel_name, compression); }
+
         /**
          * @brief Set measurement file base name (desired name for the actual hdf5 files that will be created)
          *
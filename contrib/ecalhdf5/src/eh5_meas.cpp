@@ -171,6 +171,15 @@ std::string eCAL::eh5::HDF5Meas::GetFileVersion() const
   return ret_val;
 }
 
+bool eCAL::eh5::HDF5Meas::IsThreadSafe()
+{
+#ifdef H5_HAVE_THREADSAFE
+  return true;
+#else
+  return false;
+#endif // H5_HAVE_THREADSAFE
+}
+
 size_t eCAL::eh5::HDF5Meas::GetMaxSizePerFile() const
 {
   size_t ret_val = 0;
@@ -271,6 +280,14 @@ void eCAL::eh5::HDF5Meas::SetChannelType(const std::string& channel_name, const
   }
 }
 
+void eCAL::eh5::HDF5Meas::SetChannelCompression(const std::string& channel_name, const Compression& compression)
+{
+  if (hdf_meas_impl_)
+  {
+    hdf_meas_impl_->SetChannelCompression(GetEscapedTopicname(channel_name), compression);
+  }
+}
+
 long long eCAL::eh5::HDF5Meas::GetMinTimestamp(const std::string& channel_name) const
 {
   long long ret_val = 0;
@@ -307,7 +324,7 @@ bool eCAL::eh5::HDF5Meas::GetEntriesInfo(const std::string& channel_name, EntryI
 bool eCAL::eh5::HDF5Meas::GetEntriesInfoRange(const std::string& channel_name, long long begin, long long end, EntryInfoSet& entries) const
 {
   bool ret_val = false;
-  if (hdf_meas_impl_ && begin < end)
+  if (hdf_meas_impl_ && ((end == 0) || (begin < end)))
   {
     ret_val = hdf_meas_impl_->GetEntriesInfoRange(GetEscapedTopicname(channel_name), begin, end, entries);
   }
@@ -30,9 +30,13 @@
 #include <dirent.h>
 #endif //WIN32
 
+#include <algorithm>
+#include <atomic>
 #include <string>
 #include <list>
 #include <iostream>
+#include <thread>
+#include <unordered_set>
 
 #include <ecal_utils/filesystem.h>
 #include <ecal_utils/str_convert.h>
@@ -41,6 +45,8 @@
 
 // TODO: Test the one-file-per-channel setting with gtest
 constexpr unsigned int kDefaultMaxFileSizeMB = 1000;
+constexpr int          kEntryIdChannelShift  = 32;                              // Entry IDs consist of the channel index (upper bits) and the index of the entry in the channel (lower bits)
+constexpr long long    kEntryIdIndexMask     = (1LL << kEntryIdChannelShift) - 1;
 eCAL::eh5::HDF5MeasDir::HDF5MeasDir()
   : access_              (RDONLY) // Temporarily set it to RDONLY, so the leading "Close()" from the Open() function will not operate on the uninitialized variable.
   , one_file_per_channel_(false)
@@ -103,6 +109,9 @@ bool eCAL::eh5::HDF5MeasDir::Close()
       file_writer.second->Close();
     }
 
+    // Store a summary of all files, so readers don't have to open every file
+    WriteIndexFile();
+
     // Clear the list of all file writers, which will delete them
     file_writers_.clear();
 
@@ -110,20 +119,17 @@ bool eCAL::eh5::HDF5MeasDir::Close()
   }
   else
   {
-    for (auto file : file_readers_)
+    for (auto& file : files_)
     {
-      if (file != nullptr)
+      if (file->reader)
       {
-        file->Close();
-        delete file;
-        file = nullptr;
+        file->reader->Close();
       }
     }
 
-    file_readers_.clear();
+    channels_by_index_.clear();
     channels_info_.clear();
-    entries_by_id_.clear();
-    entries_by_chn_.clear();
+    files_.clear();
 
     return true;
   }
@@ -135,7 +141,7 @@ bool eCAL::eh5::HDF5MeasDir::IsOk() const
   {
   case eCAL::eh5::RDONLY:
   //case eCAL::eh5::RDWR:
-    return !file_readers_.empty() && !entries_by_id_.empty();
+    return !files_.empty() && !channels_info_.empty();
   case eCAL::eh5::CREATE:
     return true;
   default:
@@ -146,9 +152,14 @@ bool eCAL::eh5::HDF5MeasDir::IsOk() const
 std::string eCAL::eh5::HDF5MeasDir::GetFileVersion() const
 {
   std::string version;
-  if (!file_readers_.empty())
+  for (const auto& file : files_)
   {
-    version = file_readers_.front()->GetFileVersion();
+    const auto* reader = GetReader(*file);
+    if (reader != nullptr)
+    {
+      version = reader->GetFileVersion();
+      break;
+    }
   }
   return version;
 }
@@ -202,7 +213,7 @@ std::string eCAL::eh5::HDF5MeasDir::GetChannelDescription(const std::string& cha
 
   if (found != channels_info_.end())
   {
-    ret_val = found->second.description;
+    ret_val = found->second->description;
   }
   return ret_val;
 }
@@ -222,7 +233,7 @@ std::string eCAL::eh5::HDF5MeasDir::GetChannelType(const std::string& channel_na
 
   if (found != channels_info_.end())
   {
-    ret_val = found->second.type;
+    ret_val = found->second->type;
   }
   return ret_val;
 }
@@ -234,17 +245,33 @@ void eCAL::eh5::HDF5MeasDir::SetChannelType(const std::string& channel_name, con
   file_writer_it->second->SetChannelType(channel_name, type);
 }
 
+void eCAL::eh5::HDF5MeasDir::SetChannelCompression(const std::string& channel_name, const Compression& compression)
+{
+  // Get an existing writer or create a new one
+  auto file_writer_it = GetWriter(channel_name);
+  file_writer_it->second->SetChannelCompression(channel_name, compression);
+}
+
 long long eCAL::eh5::HDF5MeasDir::GetMinTimestamp(const std::string& channel_name) const
 {
   long long ret_val = 0;
 
-  const auto& found = entries_by_chn_.find(channel_name);
+  const auto& found = channels_info_.find(channel_name);
 
-  if (found != entries_by_chn_.end())
+  if (found != channels_info_.end())
   {
-    if (!found->second.empty())
+    const auto& channel_info = *found->second;
+    if (channel_info.is_summary_valid)
+    {
+      ret_val = channel_info.summary_min_timestamp;
+    }
+    else
     {
-      ret_val = found->second.begin()->RcvTimestamp;
+      LoadEntries(channel_info);
+      if (!channel_info.entries.empty())
+      {
+        ret_val = channel_info.entries.begin()->RcvTimestamp;
+      }
     }
   }
 
@@ -255,13 +282,22 @@ long long eCAL::eh5::HDF5MeasDir::GetMaxTimestamp(const std::string& channel_nam
 {
   long long ret_val = 0;
 
-  const auto& found = entries_by_chn_.find(channel_name);
+  const auto& found = channels_info_.find(channel_name);
 
-  if (found != entries_by_chn_.end())
+  if (found != channels_info_.end())
   {
-    if (!found->second.empty())
+    const auto& channel_info = *found->second;
+    if (channel_info.is_summary_valid)
     {
-      ret_val = found->second.rbegin()->RcvTimestamp;
+      ret_val = channel_info.summary_max_timestamp;
+    }
+    else
+    {
+      LoadEntries(channel_info);
+      if (!channel_info.entries.empty())
+      {
+        ret_val = channel_info.entries.rbegin()->RcvTimestamp;
+      }
     }
   }
 
@@ -272,11 +308,11 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfo(const std::string& channel_name, Ent
 {
   entries.clear();
 
-  const auto& found = entries_by_chn_.find(channel_name);
+  const auto* channel_info = GetChannelWithEntries(channel_name);
 
-  if (found != entries_by_chn_.end())
+  if (channel_info != nullptr)
   {
-    entries = found->second;
+    entries = channel_info->entries;
   }
 
   return !entries.empty();
@@ -288,15 +324,19 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfoRange(const std::string& channel_name
 
   entries.clear();
 
-  const auto& found = entries_by_chn_.find(channel_name);
+  const auto* channel_info = GetChannelWithEntries(channel_name);
 
-  if (found != entries_by_chn_.end())
+  if (channel_info != nullptr)
   {
-    if (begin == 0) begin = entries.begin()->RcvTimestamp;
-    if (end == 0) end = entries.rbegin()->RcvTimestamp;
+    const auto& channel_entries = channel_info->entries;
+
+    if (channel_entries.empty()) return true;
 
-    const auto& lower = found->second.lower_bound(SEntryInfo(begin, 0, 0));
-    const auto& upper = found->second.upper_bound(SEntryInfo(end, 0, 0));
+    if (begin == 0) begin = channel_entries.begin()->RcvTimestamp;
+    if (end == 0) end = channel_entries.rbegin()->RcvTimestamp;
+
+    const auto& lower = channel_entries.lower_bound(SEntryInfo(begin, 0, 0));
+    const auto& upper = channel_entries.upper_bound(SEntryInfo(end, 0, 0));
 
     entries.insert(lower, upper);
     ret_val = true;
@@ -308,10 +348,10 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfoRange(const std::string& channel_name
 bool eCAL::eh5::HDF5MeasDir::GetEntryDataSize(long long entry_id, size_t& size) const
 {
   auto ret_val = false;
-  const auto& found = entries_by_id_.find(entry_id);
-  if (found != entries_by_id_.end())
+  const auto* entry_info = GetEntryInfo(entry_id);
+  if (entry_info != nullptr)
   {
-    ret_val = found->second.reader->GetEntryDataSize(found->second.file_id, size);
+    ret_val = entry_info->reader->GetEntryDataSize(entry_info->file_id, size);
   }
   return ret_val;
 }
@@ -319,10 +359,10 @@ bool eCAL::eh5::HDF5MeasDir::GetEntryDataSize(long long entry_id, size_t& size)
 bool eCAL::eh5::HDF5MeasDir::GetEntryData(long long entry_id, void* data) const
 {
   auto ret_val = false;
-  const auto& found = entries_by_id_.find(entry_id);
-  if (found != entries_by_id_.end())
+  const auto* entry_info = GetEntryInfo(entry_id);
+  if (entry_info != nullptr)
   {
-    ret_val = found->second.reader->GetEntryData(found->second.file_id, data);
+    ret_val = entry_info->reader->GetEntryData(entry_info->file_id, data);
   }
   return ret_val;
 }
@@ -373,7 +413,7 @@ void eCAL::eh5::HDF5MeasDir::DisconnectPreSplitCallback()
   }
 }
 
-std::list<std::string> eCAL::eh5::HDF5MeasDir::GetHdfFiles(const std::string& path) const
+std::list<std::string> eCAL::eh5::HDF5MeasDir::GetHdfFiles(const std::string& path, std::list<std::string>* index_files) const
 {
   std::list<std::string> paths;
 #ifdef WIN32
@@ -394,12 +434,16 @@ std::list<std::string> eCAL::eh5::HDF5MeasDir::GetHdfFiles(const std::string& pa
         {
           paths.push_back(path + "/" + std::string(file_name_utf8.begin(), file_name_utf8.end()));
         }
+        else if ((index_files != nullptr) && HasIndexExtension(file_name_utf8))
+        {
+          index_files->push_back(path + "/" + std::string(file_name_utf8.begin(), file_name_utf8.end()));
+        }
       }
       else
       {
         if (file_name_utf8 != "." && file_name_utf8 != "..")
         {
-          paths.splice(paths.end(), GetHdfFiles(path + "/" + std::string(file_name_utf8.begin(), file_name_utf8.end())));
+          paths.splice(paths.end(), GetHdfFiles(path + "/" + std::string(file_name_utf8.begin(), file_name_utf8.end()), index_files));
         }
       }
     } while (::FindNextFileW(hFind, &fd));
@@ -421,12 +465,14 @@ std::list<std::string> eCAL::eh5::HDF5MeasDir::GetHdfFiles(const std::string& pa
       {
         if (de->d_type == DT_DIR)
         {
-          paths.splice(paths.end(), GetHdfFiles(path + "/" + d_name));
+          paths.splice(paths.end(), GetHdfFiles(path + "/" + d_name, index_files));
         }
         else
         {
           if (HasHdf5Extension(d_name))
             paths.push_back(path + "/" + d_name);
+          else if ((index_files != nullptr) && HasIndexExtension(d_name))
+            index_files->push_back(path + "/" + d_name);
         }
       }
       de = readdir(dir);
@@ -441,58 +487,244 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, eAccessType access
 {
   if (access != eAccessType::RDONLY /*&& access != eAccessType::RDWR*/) return false;
 
-  auto files = GetHdfFiles(path);
+  std::list<std::string> index_file_paths;
+  auto file_paths = GetHdfFiles(path, &index_file_paths);
 
-  long long id = 0;
+  // Collect the summaries of all files that are listed in an index file. A
+  // file is only trusted, if it still has the size stored in the index.
+  std::unordered_map<std::string, IndexedFile> indexed_files;
+  {
+    std::unordered_set<std::string> existing_file_paths(file_paths.begin(), file_paths.end());
+
+    for (const auto& index_file_path : index_file_paths)
+    {
+      std::list<IndexedFile> index;
+      if (!ReadIndexFile(index_file_path, index))
+        continue;
 
-  for (const auto& file_path : files)
+      const std::string index_dir = index_file_path.substr(0, index_file_path.find_last_of('/'));
+      for (auto& indexed_file : index)
+      {
+        const std::string file_path = index_dir + "/" + indexed_file.file_name;
+        if ((existing_file_paths.count(file_path) == 0) || (indexed_files.count(file_path) != 0))
+          continue;
+
+        EcalUtils::Filesystem::FileStatus file_status(file_path, EcalUtils::Filesystem::OsStyle::Current);
+        if (file_status.IsOk() && (static_cast<uint64_t>(file_status.FileSize()) == indexed_file.file_size))
+        {
+          indexed_files.emplace(file_path, std::move(indexed_file));
+        }
+      }
+    }
+  }
+
+  // All other files have to be opened to find out which channels they contain.
+  // Opening the files is parallelized, if the HDF5 library is thread safe.
+  std::vector<std::unique_ptr<File>>          opened_files;
+  std::vector<std::vector<IndexedChannel>>    opened_files_channels;
   {
-    auto reader = new eCAL::eh5::HDF5Meas(file_path);
+    for (const auto& file_path : file_paths)
+    {
+      if (indexed_files.count(file_path) == 0)
+        opened_files.emplace_back(std::make_unique<File>(file_path));
+    }
+    opened_files_channels.resize(opened_files.size());
 
-    if (reader->IsOk())
+    std::atomic<size_t> next_file_index(0);
+    auto open_files = [&]()
     {
-      auto channels = reader->GetChannelNames();
-      for (const auto& channel : channels)
+      for (size_t file_index = next_file_index++; file_index < opened_files.size(); file_index = next_file_index++)
       {
-        auto escaped_name = GetEscapedTopicname(channel);
-        auto description = reader->GetChannelDescription(channel);
+        auto& file = *opened_files[file_index];
+        const auto* reader = GetReader(file);
+        if (reader == nullptr)
+          continue;
 
-        if (channels_info_.find(escaped_name) == channels_info_.end())
+        for (const auto& channel : reader->GetChannelNames())
         {
-          channels_info_[escaped_name] = ChannelInfo(reader->GetChannelType(channel), description);
+          IndexedChannel channel_summary;
+          channel_summary.name        = channel;
+          channel_summary.type        = reader->GetChannelType(channel);
+          channel_summary.description = reader->GetChannelDescription(channel);
+          opened_files_channels[file_index].push_back(std::move(channel_summary));
         }
-        else
+      }
+    };
+
+#ifdef H5_HAVE_THREADSAFE
+    const size_t thread_count = std::min<size_t>(opened_files.size(), std::max(1u, std::thread::hardware_concurrency()));
+#else
+    const size_t thread_count = std::min<size_t>(opened_files.size(), 1);
+#endif // H5_HAVE_THREADSAFE
+
+    std::vector<std::thread> open_threads;
+    for (size_t i = 1; i < thread_count; i++)
+      open_threads.emplace_back(open_files);
+    open_files();
+    for (auto& open_thread : open_threads)
+      open_thread.join();
+  }
+
+  // Merge the channels of all files in the order they have been found
+  size_t opened_file_index = 0;
+  for (const auto& file_path : file_paths)
+  {
+    const std::vector<IndexedChannel>* channels = nullptr;
+    std::unique_ptr<File>              file;
+    bool                               is_indexed = false;
+
+    auto indexed_file = indexed_files.find(file_path);
+    if (indexed_file != indexed_files.end())
+    {
+      file       = std::make_unique<File>(file_path);
+      channels   = &indexed_file->second.channels;
+      is_indexed = true;
+    }
+    else
+    {
+      file     = std::move(opened_files[opened_file_index]);
+      channels = &opened_files_channels[opened_file_index];
+      opened_file_index++;
+
+      if (!file->reader || !file->reader->IsOk())
+        continue;
+    }
+
+    for (const auto& channel : *channels)
+    {
+      // The index stores the names as they are stored in the file, while the
+      // reader returns them unescaped
+      const std::string channel_name = is_indexed ? GetUnescapedString(channel.name) : channel.name;
+      const std::string escaped_name = GetEscapedTopicname(channel_name);
+
+      auto channel_info_it = channels_info_.find(escaped_name);
+      if (channel_info_it == channels_info_.end())
+      {
+        channel_info_it = channels_info_.emplace(escaped_name, std::make_unique<ChannelInfo>(channel.type, channel.description, static_cast<long long>(channels_by_index_.size()))).first;
+        channels_by_index_.push_back(channel_info_it->second.get());
+      }
+      else
+      {
+        if (!channel.description.empty())
         {
-          if (!description.empty())
-          {
-            channels_info_[escaped_name].description = description;
-          }
+          channel_info_it->second->description = channel.description;
         }
+      }
 
-        channels_info_[escaped_name].files.push_back(reader);
+      auto& channel_info = *channel_info_it->second;
+      channel_info.files.push_back(ChannelFile{ file.get(), channel_name });
 
-        EntryInfoSet entries;
-        if (reader->GetEntriesInfo(channel, entries))
+      if (is_indexed && channel_info.is_summary_valid)
+      {
+        if (channel.entry_count > 0)
         {
-          for (auto entry : entries)
+          if (channel_info.summary_entry_count == 0)
           {
-            entries_by_id_[id] = EntryInfo(entry.ID, reader);
-            entry.ID = id;
-            entries_by_chn_[escaped_name].insert(entry);
-            id++;
+            channel_info.summary_min_timestamp = channel.min_timestamp;
+            channel_info.summary_max_timestamp = channel.max_timestamp;
           }
+          else
+          {
+            channel_info.summary_min_timestamp = std::min(channel_info.summary_min_timestamp, channel.min_timestamp);
+            channel_info.summary_max_timestamp = std::max(channel_info.summary_max_timestamp, channel.max_timestamp);
+          }
+          channel_info.summary_entry_count += channel.entry_count;
         }
       }
-      file_readers_.push_back(reader);
-    }
-    else
-    {
-      reader->Close();
-      delete reader;
-      reader = nullptr;
+      else
+      {
+        channel_info.is_summary_valid = false;
+      }
     }
+
+    files_.push_back(std::move(file));
   }
-  return !file_readers_.empty();
+
+  return !files_.empty();
+}
+
+const eCAL::eh5::HDF5Meas* eCAL::eh5::HDF5MeasDir::GetReader(const File& file) const
+{
+  std::call_once(file.open_flag, [&file]()
+                                 {
+                                   auto reader = std::make_unique<eCAL::eh5::HDF5Meas>(file.path);
+                                   if (reader->IsOk())
+                                     file.reader = std::move(reader);
+                                   else
+                                     reader->Close();
+                                 });
+  return file.reader.get();
+}
+
+void eCAL::eh5::HDF5MeasDir::LoadEntries(const ChannelInfo& channel_info) const
+{
+  std::call_once(channel_info.entries_flag, [this, &channel_info]()
+                                            {
+                                              for (const auto& channel_file : channel_info.files)
+                                              {
+                                                const auto* reader = GetReader(*channel_file.file);
+                                                if (reader == nullptr)
+                                                  continue;
+
+                                                EntryInfoSet entries;
+                                                if (reader->GetEntriesInfo(channel_file.channel_name, entries))
+                                                {
+                                                  for (auto entry : entries)
+                                                  {
+                                                    const long long entry_index = static_cast<long long>(channel_info.entries_by_index.size());
+                                                    channel_info.entries_by_index.emplace_back(entry.ID, reader);
+                                                    entry.ID = (channel_info.channel_index << kEntryIdChannelShift) | entry_index;
+                                                    channel_info.entries.insert(entry);
+                                                  }
+                                                }
+                                              }
+                                            });
+}
+
+const eCAL::eh5::HDF5MeasDir::ChannelInfo* eCAL::eh5::HDF5MeasDir::GetChannelWithEntries(const std::string& escaped_channel_name) const
+{
+  const auto& found = channels_info_.find(escaped_channel_name);
+
+  if (found == channels_info_.end())
+    return nullptr;
+
+  LoadEntries(*found->second);
+  return found->second.get();
+}
+
+const eCAL::eh5::HDF5MeasDir::EntryInfo* eCAL::eh5::HDF5MeasDir::GetEntryInfo(long long entry_id) const
+{
+  if (entry_id < 0) return nullptr;
+
+  const auto channel_index = static_cast<size_t>(entry_id >> kEntryIdChannelShift);
+  const auto entry_index   = static_cast<size_t>(entry_id & kEntryIdIndexMask);
+
+  if (channel_index >= channels_by_index_.size()) return nullptr;
+
+  // Entry IDs are handed out when the entries are loaded, so this is usually a no-op
+  const auto& channel_info = *channels_by_index_[channel_index];
+  LoadEntries(channel_info);
+
+  if (entry_index >= channel_info.entries_by_index.size()) return nullptr;
+
+  return &channel_info.entries_by_index[entry_index];
+}
+
+void eCAL::eh5::HDF5MeasDir::WriteIndexFile() const
+{
+  if (output_dir_.empty() || base_name_.empty()) return;
+
+  std::list<IndexedFile> written_files;
+  for (const auto& file_writer : file_writers_)
+  {
+    const auto& writer_files = file_writer.second->GetWrittenFiles();
+    written_files.insert(written_files.end(), writer_files.begin(), writer_files.end());
+  }
+
+  if (written_files.empty()) return;
+
+  // The index only speeds up opening the measurement, so failing to write it is not an error
+  ::eCAL::eh5::WriteIndexFile(output_dir_ + "/" + base_name_ + kIndexFileExtension, written_files);
 }
 
 ::eCAL::eh5::HDF5MeasDir::FileWriterMap::iterator eCAL::eh5::HDF5MeasDir::GetWriter(const std::string& channel_name)
@@ -514,7 +746,7 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, eAccessType access
       file_writer_it->second->ConnectPreSplitCallback(cb_pre_split_);
 
     // Open the writer
-    file_writer_it->second->Open(output_dir_);
+    file_writer_it->second->Open(output_dir_, eAccessType::CREATE);
   }
 
   // The iterator is either what we found or what we created. In either way it
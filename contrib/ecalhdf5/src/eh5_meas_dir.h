@@ -28,8 +28,12 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "eh5_meas_impl.h"
+#include "eh5_meas_file_writer_v5.h"
+#include "eh5_meas_index.h"
 
 #include "hdf5.h"
 
@@ -176,6 +180,14 @@ namespace eCAL
       **/
       void SetChannelType(const std::string& channel_name, const std::string& type) override;
 
+      /**
+      * @brief Set the compression of the given channel
+      *
+      * @param channel_name  channel name
+      * @param compression   compression settings of the channel
+      **/
+      void SetChannelCompression(const std::string& channel_name, const Compression& compression) override;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -278,17 +290,19 @@ namespace eCAL
     // ==== Reading Files
     // =====================================================================
     protected:
-      struct ChannelInfo
+      struct File
       {
-        std::string type;
-        std::string description;
-        std::list<const eCAL::eh5::HDF5Meas*> files;
+        std::string                                   path;
+        mutable std::unique_ptr<eCAL::eh5::HDF5Meas>  reader;       //!< Files known from an index file are only opened when their entries are needed
+        mutable std::once_flag                        open_flag;
 
-        ChannelInfo() = default;
-        ChannelInfo(const std::string& type_, const std::string& description_)
-          : type(type_)
-          , description(description_)
-        {}
+        explicit File(const std::string& path_) : path(path_) {}
+      };
+
+      struct ChannelFile
+      {
+        const File*  file;
+        std::string  channel_name;                                  //!< Name of the channel inside of the file (not escaped)
       };
 
       struct EntryInfo
@@ -304,15 +318,43 @@ namespace eCAL
         {}
       };
 
-      typedef std::list<eCAL::eh5::HDF5Meas*>               HDF5Files;
-      typedef std::unordered_map<std::string, ChannelInfo>  ChannelInfoUMap;
-      typedef std::unordered_map<long long, EntryInfo>      EntriesByIdUMap;
-      typedef std::unordered_map<std::string, EntryInfoSet> EntriesByChannelUMap;
+      struct ChannelInfo
+      {
+        std::string               type;
+        std::string               description;
+        std::vector<ChannelFile>  files;
+        long long                 channel_index;
+
+        // Summary of the channel from the index files. Only valid if all files
+        // containing this channel are listed in an index file.
+        bool                      is_summary_valid;
+        unsigned long long        summary_entry_count;
+        long long                 summary_min_timestamp;
+        long long                 summary_max_timestamp;
+
+        // The entries are loaded on first access. The IDs of the entries are
+        // composed of the channel index and the index in entries_by_index.
+        mutable std::once_flag          entries_flag;
+        mutable EntryInfoSet            entries;
+        mutable std::vector<EntryInfo>  entries_by_index;
+
+        ChannelInfo(const std::string& type_, const std::string& description_, long long channel_index_)
+          : type(type_)
+          , description(description_)
+          , channel_index(channel_index_)
+          , is_summary_valid(true)
+          , summary_entry_count(0)
+          , summary_min_timestamp(0)
+          , summary_max_timestamp(0)
+        {}
+      };
+
+      typedef std::list<std::unique_ptr<File>>                                HDF5Files;
+      typedef std::unordered_map<std::string, std::unique_ptr<ChannelInfo>>   ChannelInfoUMap;
 
-      HDF5Files              file_readers_;
-      ChannelInfoUMap        channels_info_;
-      EntriesByIdUMap        entries_by_id_;
-      EntriesByChannelUMap   entries_by_chn_;
+      HDF5Files                 files_;
+      ChannelInfoUMap           channels_info_;
+      std::vector<ChannelInfo*> channels_by_index_;
 
       struct Channel
       {
@@ -326,7 +368,7 @@ namespace eCAL
       Channels                 channels_;
       eAccessType              access_;
 
-      std::list<std::string> GetHdfFiles(const std::string& path) const;
+      std::list<std::string> GetHdfFiles(const std::string& path, std::list<std::string>* index_files = nullptr) const;
 
       static inline bool HasHdf5Extension(const std::string& str)
       {
@@ -335,14 +377,48 @@ namespace eCAL
         return std::equal(end.rbegin(), end.rend(), str.rbegin());
       }
 
+      static inline bool HasIndexExtension(const std::string& str)
+      {
+        std::string end(kIndexFileExtension);
+        if (end.size() > str.size()) return false;
+        return std::equal(end.rbegin(), end.rend(), str.rbegin());
+      }
+
       bool OpenRX(const std::string& path, eAccessType access /*= eAccessType::RDONLY*/);
 
+      /**
+      * @brief Returns the reader of the given file and opens it, if necessary
+      *
+      * @return the reader or nullptr, if the file cannot be opened
+      **/
+      const eCAL::eh5::HDF5Meas* GetReader(const File& file) const;
+
+      /**
+      * @brief Loads the entries of the given channel, if not loaded, yet
+      **/
+      void LoadEntries(const ChannelInfo& channel_info) const;
+
+      /**
+      * @brief Returns the channel with loaded entries or nullptr, if it doesn't exist
+      **/
+      const ChannelInfo* GetChannelWithEntries(const std::string& escaped_channel_name) const;
+
+      /**
+      * @brief Looks up the file and file-local ID of the given entry
+      **/
+      const EntryInfo* GetEntryInfo(long long entry_id) const;
+
+      /**
+      * @brief Writes the index file for all files that have been created
+      **/
+      void WriteIndexFile() const;
+
 
       // =====================================================================
       // ==== Writing files
       // =====================================================================
     protected:
-      typedef std::unordered_map<std::string, std::unique_ptr<::eCAL::eh5::HDF5MeasImpl>> FileWriterMap;
+      typedef std::unordered_map<std::string, std::unique_ptr<::eCAL::eh5::HDF5MeasFileWriterV5>> FileWriterMap;
 
       std::string         output_dir_;                                          //!< The directory where the HDF5 files shall be placed when in CREATE mode
       std::string         base_name_;                                           //!< The filename of HDF5 files when in CREATE mode. Will be postfixed by the channel name when in one_file_per_channel_ mode. Will be further postfixed by a number when the files are splitted.
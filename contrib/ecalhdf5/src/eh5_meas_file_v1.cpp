@@ -194,6 +194,11 @@ void eCAL::eh5::HDF5MeasFileV1::SetChannelType(const std::string& /*channel_name
   ReportUnsupportedAction();
 }
 
+void eCAL::eh5::HDF5MeasFileV1::SetChannelCompression(const std::string& /*channel_name*/, const Compression& /*compression*/)
+{
+  ReportUnsupportedAction();
+}
+
 long long eCAL::eh5::HDF5MeasFileV1::GetMinTimestamp(const std::string& /*channel_name*/) const
 {
   long long ret_val = 0;
@@ -260,8 +265,8 @@ bool eCAL::eh5::HDF5MeasFileV1::GetEntriesInfoRange(const std::string& /*channel
 
   if (!entries_.empty())
   {
-    if (begin == 0) begin = entries.begin()->RcvTimestamp;
-    if (end == 0) end = entries.rbegin()->RcvTimestamp;
+    if (begin == 0) begin = entries_.begin()->RcvTimestamp;
+    if (end == 0) end = entries_.rbegin()->RcvTimestamp;
 
     const auto& lower = entries_.lower_bound(SEntryInfo(begin, 0, 0));
     const auto& upper = entries_.upper_bound(SEntryInfo(end, 0, 0));
@@ -168,6 +168,14 @@ namespace eCAL
       **/
       void SetChannelType(const std::string& channel_name, const std::string& type) override;
 
+      /**
+      * @brief Set the compression of the given channel
+      *
+      * @param channel_name  channel name
+      * @param compression   compression settings of the channel
+      **/
+      void SetChannelCompression(const std::string& channel_name, const Compression& compression) override;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -186,6 +186,10 @@ void eCAL::eh5::HDF5MeasFileV2::SetChannelType(const std::string& /*channel_name
 {
 }
 
+void eCAL::eh5::HDF5MeasFileV2::SetChannelCompression(const std::string& /*channel_name*/, const Compression& /*compression*/)
+{
+}
+
 long long eCAL::eh5::HDF5MeasFileV2::GetMinTimestamp(const std::string& channel_name) const
 {
   long long ret_val = 0;
@@ -254,8 +258,8 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntriesInfoRange(const std::string& channel_n
 
   if (GetEntriesInfo(channel_name, all_entries) && !all_entries.empty())
   {
-    if (begin == 0) begin = entries.begin()->RcvTimestamp;
-    if (end == 0) end = entries.rbegin()->RcvTimestamp;
+    if (begin == 0) begin = all_entries.begin()->RcvTimestamp;
+    if (end == 0) end = all_entries.rbegin()->RcvTimestamp;
 
     const auto& lower = all_entries.lower_bound(SEntryInfo(begin, 0, 0));
     const auto& upper = all_entries.upper_bound(SEntryInfo(end, 0, 0));
@@ -275,10 +279,18 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntryDataSize(long long entry_id, size_t& siz
 
   if (dataset_id < 0) return false;
 
-  size = static_cast<size_t>(H5Dget_storage_size(dataset_id));
+  // Use the size of the dataspace, as the storage size of compressed entries
+  // differs from the size of the data
+  auto dataspace_id = H5Dget_space(dataset_id);
+  auto npoints      = H5Sget_simple_extent_npoints(dataspace_id);
+  H5Sclose(dataspace_id);
 
   H5Dclose(dataset_id);
 
+  if (npoints < 0) return false;
+
+  size = static_cast<size_t>(npoints);
+
   return true;
 }
 
@@ -23,6 +23,8 @@
 
 #include "eh5_meas_file_v5.h"
 
+#include <vector>
+
 #include "hdf5.h"
 
 namespace eCAL
@@ -54,24 +56,26 @@ namespace eCAL
       const size_t sizeof_ll = sizeof(long long);
       hsize_t data_size = H5Dget_storage_size(dataset_id) / sizeof_ll;
 
-      if (data_size <= 0) return false;
+      if (data_size <= 0)
+      {
+        H5Dclose(dataset_id);
+        return false;
+      }
 
-      long long* data = static_cast<long long*>(calloc(static_cast<size_t>(data_size), sizeof_ll));
-      if (data == nullptr) return false;
+      std::vector<long long> data(static_cast<size_t>(data_size));
 
-      herr_t status = H5Dread(dataset_id, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+      herr_t status = H5Dread(dataset_id, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
 
       H5Dclose(dataset_id);
 
-      for (unsigned int index = 0; index < data_size; index += 5)
+      // The entries are stored ordered by receive time in most cases, so
+      // inserting them at the end is amortized constant
+      for (size_t index = 0; index + 4 < data.size(); index += 5)
       {
-        //                        rec timestamp,  channel id,       send clock,       send time stamp,  send ID
-        entries.emplace(SEntryInfo(data[index],    data[index + 1],  data[index + 2],  data[index + 3],  data[index + 4]));
+        //                                             rec timestamp,  channel id,       send clock,       send time stamp,  send ID
+        entries.emplace_hint(entries.end(), SEntryInfo(data[index],    data[index + 1],  data[index + 2],  data[index + 3],  data[index + 4]));
       }
 
-      free(data);
-      data = nullptr;
-
       return (status >= 0);
     }
   }  //  namespace eh5
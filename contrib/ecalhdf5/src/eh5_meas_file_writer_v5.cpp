@@ -30,6 +30,7 @@
 #include <dirent.h>
 #endif //WIN32
 
+#include <algorithm>
 #include <string>
 #include <list>
 #include <iostream>
@@ -38,6 +39,8 @@
 #include <ecal_utils/str_convert.h>
 
 constexpr unsigned int kDefaultMaxFileSizeMB = 1000;
+constexpr hsize_t      kMinCompressionSize   = 1024;                            // Entries smaller than this are always stored uncompressed
+constexpr hsize_t      kMaxCompressionChunk  = 1024 * 1024;                     // Compressed entries are split into chunks of this size, so each chunk fits the default HDF5 chunk cache
 
 eCAL::eh5::HDF5MeasFileWriterV5::HDF5MeasFileWriterV5()
   : cb_pre_split_      (nullptr)
@@ -63,6 +66,7 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::Open(const std::string& output_dir, eAcces
     return false;
 
   output_dir_ = output_dir;
+  written_files_.clear();
 
   return true;
 }
@@ -72,11 +76,27 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::Close()
   if (!this->IsOk())  return false;
 
   std::string channels_with_entries;
+  IndexedFile indexed_file;
+  indexed_file.file_name = EcalUtils::Filesystem::FileName(file_path_, EcalUtils::Filesystem::OsStyle::Current);
 
   for (const auto& channel : channels_)
+  {
     if (CreateEntriesTableOfContentsFor(channel.first, channel.second.Type, channel.second.Description, channel.second.Entries))
+    {
       channels_with_entries += channel.first + ",";
 
+      IndexedChannel indexed_channel;
+      indexed_channel.name          = channel.first;
+      indexed_channel.type          = channel.second.Type;
+      indexed_channel.description   = channel.second.Description;
+      indexed_channel.entry_count   = channel.second.Entries.size();
+      const auto min_max_entry      = std::minmax_element(channel.second.Entries.begin(), channel.second.Entries.end());
+      indexed_channel.min_timestamp = min_max_entry.first->RcvTimestamp;
+      indexed_channel.max_timestamp = min_max_entry.second->RcvTimestamp;
+      indexed_file.channels.push_back(std::move(indexed_channel));
+    }
+  }
+
   if ((!channels_with_entries.empty())  && (channels_with_entries.back() == ','))
     channels_with_entries.pop_back();
 
@@ -88,6 +108,13 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::Close()
   if (H5Fclose(file_id_) >= 0)
   {
     file_id_ = -1;
+
+    EcalUtils::Filesystem::FileStatus file_status(file_path_, EcalUtils::Filesystem::OsStyle::Current);
+    if (file_status.IsOk())
+    {
+      indexed_file.file_size = static_cast<uint64_t>(file_status.FileSize());
+      written_files_.push_back(std::move(indexed_file));
+    }
     return true;
   }
   else
@@ -160,6 +187,11 @@ void eCAL::eh5::HDF5MeasFileWriterV5::SetChannelType(const std::string& channel_
   channels_[channel_name].Type = type;
 }
 
+void eCAL::eh5::HDF5MeasFileWriterV5::SetChannelCompression(const std::string& channel_name, const Compression& compression)
+{
+  channels_[channel_name].CompressionSettings = compression;
+}
+
 long long eCAL::eh5::HDF5MeasFileWriterV5::GetMinTimestamp(const std::string& /*channel_name*/) const
 {
   // UNSUPPORTED FUNCTION
@@ -227,6 +259,10 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::AddEntryToFile(const void* data, const uns
   auto dsProperty = H5Pcreate(H5P_DATASET_CREATE);
   H5Pset_obj_track_times(dsProperty, false);
 
+  //  Add compression filters, if the channel shall be compressed. HDF5 applies them while writing.
+  auto& channel = channels_[channel_name];
+  SetDatasetCompression(dsProperty, hsSize, channel.CompressionSettings);
+
   //  Create dataset in dataSpace
   auto dataSet = H5Dcreate(file_id_, std::to_string(entries_counter_).c_str(), H5T_NATIVE_UCHAR, dataSpace, H5P_DEFAULT, dsProperty, H5P_DEFAULT);
 
@@ -238,7 +274,7 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::AddEntryToFile(const void* data, const uns
   H5Pclose(dsProperty);
   H5Sclose(dataSpace);
 
-  channels_[channel_name].Entries.emplace_back(SEntryInfo(rcv_timestamp, static_cast<long long>(entries_counter_), clock, snd_timestamp, id));
+  channel.Entries.emplace_back(SEntryInfo(rcv_timestamp, static_cast<long long>(entries_counter_), clock, snd_timestamp, id));
 
   entries_counter_++;
 
@@ -255,6 +291,11 @@ void eCAL::eh5::HDF5MeasFileWriterV5::DisconnectPreSplitCallback()
   cb_pre_split_ = nullptr;
 }
 
+const std::list<eCAL::eh5::IndexedFile>& eCAL::eh5::HDF5MeasFileWriterV5::GetWrittenFiles() const
+{
+  return written_files_;
+}
+
 hid_t eCAL::eh5::HDF5MeasFileWriterV5::Create()
 {
   if (output_dir_.empty()) return -1;
@@ -285,9 +326,14 @@ hid_t eCAL::eh5::HDF5MeasFileWriterV5::Create()
   file_id_ = H5Fcreate(filePath.c_str(), H5F_ACC_TRUNC, fileCreateProperty, fileAccessPropery);
 
   if (file_id_ >= 0)
+  {
     SetAttribute(file_id_, kFileVerAttrTitle, "5.0");
+    file_path_ = filePath;
+  }
   else
+  {
     file_split_counter_--;
+  }
 
   return file_id_;
 }
@@ -349,6 +395,33 @@ bool eCAL::eh5::HDF5MeasFileWriterV5::GetFileSize(hsize_t& size) const
   }
 }
 
+bool eCAL::eh5::HDF5MeasFileWriterV5::SetDatasetCompression(hid_t ds_property, const hsize_t& size, const Compression& compression)
+{
+  if ((compression.codec == CompressionCodec::None) || (size < kMinCompressionSize))
+    return false;
+
+  //  check if the filter is available, before switching to a chunked layout
+  const H5Z_filter_t filter = (compression.codec == CompressionCodec::Deflate ? H5Z_FILTER_DEFLATE : static_cast<H5Z_filter_t>(compression.filter_id));
+  if (H5Zfilter_avail(filter) <= 0)
+    return false;
+
+  //  filters can only be applied to chunked datasets
+  const hsize_t chunk_size = std::min(size, kMaxCompressionChunk);
+  if (H5Pset_chunk(ds_property, 1, &chunk_size) < 0)
+    return false;
+
+  switch (compression.codec)
+  {
+  case CompressionCodec::Deflate:
+    return (H5Pset_deflate(ds_property, static_cast<unsigned int>(std::min(std::max(compression.level, 1), 9))) >= 0);
+  case CompressionCodec::Hdf5Filter:
+    //  optional filter: chunks that cannot be compressed by the filter are stored as they are
+    return (H5Pset_filter(ds_property, filter, H5Z_FLAG_OPTIONAL, compression.filter_params.size(), compression.filter_params.data()) >= 0);
+  default:
+    return false;
+  }
+}
+
 bool eCAL::eh5::HDF5MeasFileWriterV5::CreateEntriesTableOfContentsFor(const std::string& channelName, const std::string& channelType, const std::string& channelDescription, const EntryInfoVect& entries) const
 {
   if (!IsOk()) return false;
@@ -29,6 +29,7 @@
 #include <unordered_map>
 
 #include "eh5_meas_impl.h"
+#include "eh5_meas_index.h"
 
 #include "hdf5.h"
 
@@ -174,6 +175,14 @@ namespace eCAL
       **/
       void SetChannelType(const std::string& channel_name, const std::string& type) override;
 
+      /**
+      * @brief Set the compression of the given channel
+      *
+      * @param channel_name  channel name
+      * @param compression   compression settings of the channel
+      **/
+      void SetChannelCompression(const std::string& channel_name, const Compression& compression) override;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -271,11 +280,20 @@ namespace eCAL
       **/
       void DisconnectPreSplitCallback() override;
 
+      /**
+      * @brief Returns a summary of all files that have been completely written
+      *        since the writer has been opened
+      *
+      * @return  files that have been closed
+      **/
+      const std::list<IndexedFile>& GetWrittenFiles() const;
+
     protected:
       struct Channel
       {
         std::string   Description;
         std::string   Type;
+        Compression   CompressionSettings;
         EntryInfoVect Entries;
       };
 
@@ -283,6 +301,8 @@ namespace eCAL
 
       std::string              output_dir_;
       std::string              base_name_;
+      std::string              file_path_;
+      std::list<IndexedFile>   written_files_;
       Channels                 channels_;
       CallbackFunction         cb_pre_split_;
       hid_t                    file_id_;
@@ -326,6 +346,20 @@ namespace eCAL
       **/
       bool GetFileSize(hsize_t& size) const;
 
+      /**
+      * @brief Adds the filters for the given compression to a dataset creation property
+      *
+      * Small entries are not compressed, as the overhead of a chunked dataset
+      * would exceed the savings.
+      *
+      * @param ds_property  Dataset creation property list
+      * @param size         Size of the entry in bytes
+      * @param compression  Compression settings of the channel
+      *
+      * @return  true if a compression filter has been set, false if the entry will be stored uncompressed
+      **/
+      static bool SetDatasetCompression(hid_t ds_property, const hsize_t& size, const Compression& compression);
+
       /**
       * @brief Creates the entries "table of contents" (timestamp + entry id)
       *        (Call it just before closing the file)
@@ -159,6 +159,14 @@ namespace eCAL
       **/
       virtual void SetChannelType(const std::string& channel_name, const std::string& type) = 0;
 
+      /**
+      * @brief Set the compression of the given channel
+      *
+      * @param channel_name  channel name
+      * @param compression   compression settings of the channel
+      **/
+      virtual void SetChannelCompression(const std::string& channel_name, const Compression& compression) = 0;
+
       /**
       * @brief Gets minimum timestamp for specified channel
       *
@@ -0,0 +1,173 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Consolidated entry index ("sidecar") of the HDF5 files of a measurement
+**/
+
+#include "eh5_meas_index.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include <ecal_utils/str_convert.h>
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    namespace
+    {
+      // The index is only an optimization. Whenever anything is unexpected, the
+      // reader must fall back to opening the HDF5 files.
+      constexpr char     kIndexMagic[8]   = { 'E', 'H', '5', 'I', 'N', 'D', 'E', 'X' };
+      constexpr uint32_t kIndexVersion    = 1;
+      constexpr uint64_t kMaxStringLength = 256 * 1024 * 1024;
+
+      void WriteUInt64(std::ostream& stream, uint64_t value)
+      {
+        unsigned char buffer[8];
+        for (int i = 0; i < 8; i++)
+          buffer[i] = static_cast<unsigned char>((value >> (8 * i)) & 0xFF);
+        stream.write(reinterpret_cast<const char*>(buffer), sizeof(buffer));
+      }
+
+      void WriteString(std::ostream& stream, const std::string& value)
+      {
+        WriteUInt64(stream, value.size());
+        stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+      }
+
+      bool ReadUInt64(std::istream& stream, uint64_t& value)
+      {
+        unsigned char buffer[8];
+        if (!stream.read(reinterpret_cast<char*>(buffer), sizeof(buffer)))
+          return false;
+
+        value = 0;
+        for (int i = 0; i < 8; i++)
+          value |= static_cast<uint64_t>(buffer[i]) << (8 * i);
+        return true;
+      }
+
+      bool ReadString(std::istream& stream, std::string& value)
+      {
+        uint64_t size = 0;
+        if (!ReadUInt64(stream, size) || (size > kMaxStringLength))
+          return false;
+
+        value.resize(static_cast<size_t>(size));
+        return (size == 0) || static_cast<bool>(stream.read(&value[0], static_cast<std::streamsize>(size)));
+      }
+
+#ifdef WIN32
+      std::wstring IndexFilePath(const std::string& path) { return EcalUtils::StrConvert::Utf8ToWide(path); }
+#else
+      const std::string& IndexFilePath(const std::string& path) { return path; }
+#endif // WIN32
+    }
+
+    bool WriteIndexFile(const std::string& path, const std::list<IndexedFile>& files)
+    {
+      std::ofstream stream(IndexFilePath(path), std::ios::out | std::ios::trunc | std::ios::binary);
+      if (!stream.is_open())
+        return false;
+
+      stream.write(kIndexMagic, sizeof(kIndexMagic));
+      WriteUInt64(stream, kIndexVersion);
+      WriteUInt64(stream, files.size());
+
+      for (const auto& file : files)
+      {
+        WriteString(stream, file.file_name);
+        WriteUInt64(stream, file.file_size);
+        WriteUInt64(stream, file.channels.size());
+
+        for (const auto& channel : file.channels)
+        {
+          WriteString(stream, channel.name);
+          WriteString(stream, channel.type);
+          WriteString(stream, channel.description);
+          WriteUInt64(stream, channel.entry_count);
+          WriteUInt64(stream, static_cast<uint64_t>(channel.min_timestamp));
+          WriteUInt64(stream, static_cast<uint64_t>(channel.max_timestamp));
+        }
+      }
+
+      stream.flush();
+      return static_cast<bool>(stream);
+    }
+
+    bool ReadIndexFile(const std::string& path, std::list<IndexedFile>& files)
+    {
+      files.clear();
+
+      std::ifstream stream(IndexFilePath(path), std::ios::in | std::ios::binary);
+      if (!stream.is_open())
+        return false;
+
+      char magic[sizeof(kIndexMagic)];
+      if (!stream.read(magic, sizeof(magic)) || (std::memcmp(magic, kIndexMagic, sizeof(magic)) != 0))
+        return false;
+
+      uint64_t version    = 0;
+      uint64_t file_count = 0;
+      if (!ReadUInt64(stream, version) || (version != kIndexVersion) || !ReadUInt64(stream, file_count))
+        return false;
+
+      std::list<IndexedFile> indexed_files;
+      for (uint64_t file_index = 0; file_index < file_count; file_index++)
+      {
+        IndexedFile file;
+        uint64_t    channel_count = 0;
+        if (!ReadString(stream, file.file_name)
+          || !ReadUInt64(stream, file.file_size)
+          || !ReadUInt64(stream, channel_count))
+        {
+          return false;
+        }
+
+        for (uint64_t channel_index = 0; channel_index < channel_count; channel_index++)
+        {
+          IndexedChannel channel;
+          uint64_t       min_timestamp = 0;
+          uint64_t       max_timestamp = 0;
+          if (!ReadString(stream, channel.name)
+            || !ReadString(stream, channel.type)
+            || !ReadString(stream, channel.description)
+            || !ReadUInt64(stream, channel.entry_count)
+            || !ReadUInt64(stream, min_timestamp)
+            || !ReadUInt64(stream, max_timestamp))
+          {
+            return false;
+          }
+          channel.min_timestamp = static_cast<long long>(min_timestamp);
+          channel.max_timestamp = static_cast<long long>(max_timestamp);
+          file.channels.push_back(std::move(channel));
+        }
+
+        indexed_files.push_back(std::move(file));
+      }
+
+      files = std::move(indexed_files);
+      return true;
+    }
+  }
+}
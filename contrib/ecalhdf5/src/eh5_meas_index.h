@@ -0,0 +1,80 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Consolidated entry index ("sidecar") of the HDF5 files of a measurement
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    /**
+    * @brief Summary of a single channel in a single HDF5 file
+    **/
+    struct IndexedChannel
+    {
+      std::string        name;                //!< Channel name as stored in the HDF5 file
+      std::string        type;
+      std::string        description;
+      uint64_t           entry_count   = 0;
+      long long          min_timestamp = 0;   //!< Minimum receive timestamp
+      long long          max_timestamp = 0;   //!< Maximum receive timestamp
+    };
+
+    /**
+    * @brief Summary of a single HDF5 file
+    **/
+    struct IndexedFile
+    {
+      std::string                 file_name;  //!< File name, relative to the directory of the index file
+      uint64_t                    file_size = 0;
+      std::vector<IndexedChannel> channels;
+    };
+
+    constexpr const char* kIndexFileExtension = ".eh5index";
+
+    /**
+    * @brief Writes the index file, replacing it if it already exists
+    *
+    * @param path    path of the index file
+    * @param files   files to store in the index
+    *
+    * @return        true if succeeds, false if it fails
+    **/
+    bool WriteIndexFile(const std::string& path, const std::list<IndexedFile>& files);
+
+    /**
+    * @brief Reads an index file
+    *
+    * @param [in]  path    path of the index file
+    * @param [out] files   files stored in the index
+    *
+    * @return              true if succeeds, false if the file does not exist or is invalid
+    **/
+    bool ReadIndexFile(const std::string& path, std::list<IndexedFile>& files);
+  }
+}
@@ -0,0 +1,59 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Process wide cache of dynamic protobuf message types
+**/
+
+#pragma once
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <google/protobuf/message.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include <memory>
+#include <string>
+
+namespace eCAL
+{
+  namespace protobuf
+  {
+    /**
+    * @brief Get the prototype of a message type from a serialized descriptor.
+    *
+    * The descriptor pools are shared by all callers in the process that pass the
+    * same descriptor, so a descriptor is parsed and built only once as long as
+    * one of its prototypes is in use. The function is thread-safe.
+    *
+    * Messages are created with prototype->New(). They, as well as the descriptors
+    * of the prototype, are valid only as long as the returned pointer is held.
+    *
+    * @param       descriptor_  Serialized google::protobuf::FileDescriptorSet.
+    * @param       type_name_   Full type name ("pb.People.Person") or name of a top level message type ("Person").
+    * @param [out] error_s_     Error string.
+    *
+    * @return  The prototype or nullptr if the type cannot be built (details see error_s_).
+    **/
+    std::shared_ptr<const google::protobuf::Message> GetCachedPrototype(const std::string& descriptor_, const std::string& type_name_, std::string& error_s_);
+  }
+}
@@ -0,0 +1,100 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Decodes selected fields of serialized protobuf messages
+**/
+
+#pragma once
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/io/coded_stream.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  namespace protobuf
+  {
+    /*
+    * Extracts numeric fields directly from the wire format of a message, without
+    * parsing it into a message object. The field paths are compiled once against
+    * the message descriptor, fields that are not selected are skipped.
+    *
+    * Paths use the syntax of the message filters, e.g. "house.rooms" or
+    * "objects[2].points[0].x". Repeated fields need an index. The leaf fields
+    * have to be numeric, bool or enum fields, their values are returned as double.
+    *
+    * A field that is not present in a message has its default value. If a
+    * selected element of a repeated field is not present, the values of the
+    * paths through this element are NaN.
+    */
+    class CProtoFieldExtractor
+    {
+    public:
+      CProtoFieldExtractor();
+
+      // compiles the paths, returns false and sets error_ if a path is invalid
+      bool Compile(const google::protobuf::Descriptor* descriptor_, const std::vector<std::string>& paths_, std::string& error_);
+
+      // number of compiled paths, the values are returned in the order of the paths
+      size_t GetFieldCount() const { return(m_value_count); }
+
+      // decodes the compiled fields from a serialized message, returns false for malformed messages
+      bool Extract(const void* buffer_, size_t size_, std::vector<double>& values_) const;
+
+    private:
+      struct SField
+      {
+        int   number;                                  // field number
+        int   type;                                    // google::protobuf::FieldDescriptor::Type
+        int   index;                                   // selected element of a repeated field, -1 for single fields
+        int   counter;                                 // occurrence counter slot of a repeated field, -1 for single fields
+        int   value;                                   // value slot of a leaf field, -1 for message fields
+        int   node;                                    // node of a message field, -1 for leaf fields
+        double default_value;                          // default value of a leaf field
+      };
+
+      struct SNode
+      {
+        std::vector<SField>                  fields;
+        std::vector<std::pair<int, double>>  defaults;  // value slots set to their defaults when the node is entered
+      };
+
+      SField& AddField(int node_, const google::protobuf::FieldDescriptor* field_, int index_);
+      void    CollectDefaults(int node_, SNode& target_) const;
+      bool    ExtractNode(google::protobuf::io::CodedInputStream& input_, int node_, std::vector<double>& values_, std::vector<int>& state_, int depth_) const;
+      bool    ExtractMessage(google::protobuf::io::CodedInputStream& input_, const SNode& node_, const SField& field_, google::protobuf::uint32 tag_, std::vector<double>& values_, std::vector<int>& state_, int depth_) const;
+      bool    ExtractValue(google::protobuf::io::CodedInputStream& input_, const SNode& node_, const SField& field_, google::protobuf::uint32 tag_, std::vector<double>& values_, std::vector<int>& state_) const;
+      void    StoreValue(const SNode& node_, int number_, int occurrence_, double value_, std::vector<double>& values_) const;
+
+      std::vector<SNode>   m_nodes;
+      size_t               m_value_count;
+      int                  m_counter_count;
+    };
+  }
+}
@@ -0,0 +1,164 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Process wide cache of dynamic protobuf message types
+**/
+
+#include <ecal/protobuf/ecal_proto_descriptor_cache.h>
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/dynamic_message.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace eCAL
+{
+  namespace protobuf
+  {
+    namespace
+    {
+      class BuildErrorCollector : public google::protobuf::DescriptorPool::ErrorCollector
+      {
+      public:
+        std::string Get() { return(m_ss.str()); }
+
+        void AddError(const std::string& filename_, const std::string& element_name_, const google::protobuf::Message* /*descriptor_*/, ErrorLocation location_, const std::string& message_) override
+        {
+          m_ss << filename_ << " " << element_name_ << " " << location_ << " ERROR: " << message_ << std::endl;
+        }
+
+      private:
+        std::stringstream m_ss;
+      };
+
+      // the pool is never modified after it is built, so it can be read by several threads
+      struct SDescriptorPool
+      {
+        google::protobuf::DescriptorPool                      pool;
+        google::protobuf::DynamicMessageFactory               factory;
+        std::vector<const google::protobuf::FileDescriptor*>  files;
+      };
+
+      std::mutex& CacheSync()
+      {
+        static std::mutex sync;
+        return sync;
+      }
+
+      // the pools are released as soon as their last prototype is not used anymore
+      std::unordered_map<std::string, std::weak_ptr<SDescriptorPool>>& Cache()
+      {
+        static std::unordered_map<std::string, std::weak_ptr<SDescriptorPool>> cache;
+        return cache;
+      }
+
+      std::shared_ptr<SDescriptorPool> BuildPool(const std::string& descriptor_, std::string& error_s_)
+      {
+        google::protobuf::FileDescriptorSet file_set;
+        if (!file_set.ParseFromString(descriptor_))
+        {
+          error_s_ = "Cannot parse the file descriptor set";
+          return(nullptr);
+        }
+
+        auto pool = std::make_shared<SDescriptorPool>();
+        BuildErrorCollector error_collector;
+        for (const auto& file : file_set.file())
+        {
+          if (pool->pool.FindFileByName(file.name()) != nullptr) continue;
+
+          const google::protobuf::FileDescriptor* file_desc = pool->pool.BuildFileCollectingErrors(file, &error_collector);
+          if (file_desc == nullptr)
+          {
+            error_s_ = error_collector.Get();
+            return(nullptr);
+          }
+          pool->files.push_back(file_desc);
+        }
+
+        return(pool);
+      }
+
+      const google::protobuf::Descriptor* FindMessageType(const SDescriptorPool& pool_, const std::string& type_name_)
+      {
+        const google::protobuf::Descriptor* message_desc = pool_.pool.FindMessageTypeByName(type_name_);
+
+        // names without package are looked up in the files, the message file is the last one of the set
+        for (auto file = pool_.files.rbegin(); (message_desc == nullptr) && (file != pool_.files.rend()); ++file)
+        {
+          message_desc = (*file)->FindMessageTypeByName(type_name_);
+        }
+
+        return(message_desc);
+      }
+    }
+
+    std::shared_ptr<const google::protobuf::Message> GetCachedPrototype(const std::string& descriptor_, const std::string& type_name_, std::string& error_s_)
+    {
+      std::shared_ptr<SDescriptorPool> pool;
+      {
+        const std::lock_guard<std::mutex> lock(CacheSync());
+        auto& cache = Cache();
+
+        auto entry = cache.find(descriptor_);
+        if (entry != cache.end()) pool = entry->second.lock();
+
+        if (!pool)
+        {
+          pool = BuildPool(descriptor_, error_s_);
+          if (!pool) return(nullptr);
+
+          for (auto it = cache.begin(); it != cache.end();)
+          {
+            if (it->second.expired()) it = cache.erase(it);
+            else                      ++it;
+          }
+          cache[descriptor_] = pool;
+        }
+      }
+
+      const google::protobuf::Descriptor* message_desc = FindMessageType(*pool, type_name_);
+      if (message_desc == nullptr)
+      {
+        error_s_ = "Cannot get message descriptor of message: " + type_name_;
+        return(nullptr);
+      }
+
+      const google::protobuf::Message* prototype_msg = pool->factory.GetPrototype(message_desc);
+      if (prototype_msg == nullptr)
+      {
+        error_s_ = "Cannot create prototype message from message descriptor";
+        return(nullptr);
+      }
+
+      // the prototype keeps its descriptor pool alive
+      return(std::shared_ptr<const google::protobuf::Message>(pool, prototype_msg));
+    }
+  }
+}
@@ -0,0 +1,440 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/protobuf/ecal_proto_field_extractor.h>
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <google/protobuf/wire_format_lite.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+using google::protobuf::FieldDescriptor;
+using google::protobuf::internal::WireFormatLite;
+
+namespace eCAL
+{
+  namespace protobuf
+  {
+    namespace
+    {
+      // same limit as the default recursion limit of protobuf
+      const int max_depth = 100;
+
+      // splits "name[index]" into its parts, index is -1 if there is none
+      bool ParsePathItem(const std::string& item_, std::string& name_, int& index_)
+      {
+        index_ = -1;
+        const auto bracket = item_.find('[');
+        if (bracket == std::string::npos)
+        {
+          name_ = item_;
+          return(!name_.empty());
+        }
+
+        name_ = item_.substr(0, bracket);
+        if (name_.empty() || (item_.back() != ']')) return(false);
+
+        const std::string index = item_.substr(bracket + 1, item_.size() - bracket - 2);
+        if (index.empty() || (index.find_first_not_of("0123456789") != std::string::npos) || (index.size() > 9)) return(false);
+        index_ = std::stoi(index);
+        return(true);
+      }
+
+      double DefaultValue(const FieldDescriptor* field_)
+      {
+        switch (field_->cpp_type())
+        {
+        case FieldDescriptor::CPPTYPE_INT32:  return(static_cast<double>(field_->default_value_int32()));
+        case FieldDescriptor::CPPTYPE_INT64:  return(static_cast<double>(field_->default_value_int64()));
+        case FieldDescriptor::CPPTYPE_UINT32: return(static_cast<double>(field_->default_value_uint32()));
+        case FieldDescriptor::CPPTYPE_UINT64: return(static_cast<double>(field_->default_value_uint64()));
+        case FieldDescriptor::CPPTYPE_DOUBLE: return(field_->default_value_double());
+        case FieldDescriptor::CPPTYPE_FLOAT:  return(static_cast<double>(field_->default_value_float()));
+        case FieldDescriptor::CPPTYPE_BOOL:   return(field_->default_value_bool() ? 1.0 : 0.0);
+        case FieldDescriptor::CPPTYPE_ENUM:   return(static_cast<double>(field_->default_value_enum()->number()));
+        default:                              return(0.0);
+        }
+      }
+
+      bool IsNumeric(const FieldDescriptor* field_)
+      {
+        switch (field_->cpp_type())
+        {
+        case FieldDescriptor::CPPTYPE_STRING:
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+          return(false);
+        default:
+          return(true);
+        }
+      }
+
+      // a limit behind the end of the buffer is cut to the buffer, a truncated message would go unnoticed
+      bool LengthAvailable(google::protobuf::io::CodedInputStream& input_, int length_)
+      {
+        const int available = input_.BytesUntilLimit();
+        return((available < 0) || (length_ <= available));
+      }
+
+      bool ReadValue(google::protobuf::io::CodedInputStream& input_, int type_, double& value_)
+      {
+        google::protobuf::uint32 value32(0);
+        google::protobuf::uint64 value64(0);
+
+        switch (type_)
+        {
+        case FieldDescriptor::TYPE_DOUBLE:
+        {
+          if (!input_.ReadLittleEndian64(&value64)) return(false);
+          double value;
+          std::memcpy(&value, &value64, sizeof(value));
+          value_ = value;
+          return(true);
+        }
+        case FieldDescriptor::TYPE_FLOAT:
+        {
+          if (!input_.ReadLittleEndian32(&value32)) return(false);
+          float value;
+          std::memcpy(&value, &value32, sizeof(value));
+          value_ = static_cast<double>(value);
+          return(true);
+        }
+        case FieldDescriptor::TYPE_INT64:
+          if (!input_.ReadVarint64(&value64)) return(false);
+          value_ = static_cast<double>(static_cast<google::protobuf::int64>(value64));
+          return(true);
+        case FieldDescriptor::TYPE_UINT64:
+          if (!input_.ReadVarint64(&value64)) return(false);
+          value_ = static_cast<double>(value64);
+          return(true);
+        case FieldDescriptor::TYPE_INT32:
+        case FieldDescriptor::TYPE_ENUM:
+          // negative values are sign extended to 64 bit on the wire
+          if (!input_.ReadVarint64(&value64)) return(false);
+          value_ = static_cast<double>(static_cast<google::protobuf::int32>(value64));
+          return(true);
+        case FieldDescriptor::TYPE_UINT32:
+          if (!input_.ReadVarint32(&value32)) return(false);
+          value_ = static_cast<double>(value32);
+          return(true);
+        case FieldDescriptor::TYPE_BOOL:
+          if (!input_.ReadVarint64(&value64)) return(false);
+          value_ = (value64 != 0) ? 1.0 : 0.0;
+          return(true);
+        case FieldDescriptor::TYPE_SINT32:
+          if (!input_.ReadVarint32(&value32)) return(false);
+          value_ = static_cast<double>(WireFormatLite::ZigZagDecode32(value32));
+          return(true);
+        case FieldDescriptor::TYPE_SINT64:
+          if (!input_.ReadVarint64(&value64)) return(false);
+          value_ = static_cast<double>(WireFormatLite::ZigZagDecode64(value64));
+          return(true);
+        case FieldDescriptor::TYPE_FIXED32:
+          if (!input_.ReadLittleEndian32(&value32)) return(false);
+          value_ = static_cast<double>(value32);
+          return(true);
+        case FieldDescriptor::TYPE_SFIXED32:
+          if (!input_.ReadLittleEndian32(&value32)) return(false);
+          value_ = static_cast<double>(static_cast<google::protobuf::int32>(value32));
+          return(true);
+        case FieldDescriptor::TYPE_FIXED64:
+          if (!input_.ReadLittleEndian64(&value64)) return(false);
+          value_ = static_cast<double>(value64);
+          return(true);
+        case FieldDescriptor::TYPE_SFIXED64:
+          if (!input_.ReadLittleEndian64(&value64)) return(false);
+          value_ = static_cast<double>(static_cast<google::protobuf::int64>(value64));
+          return(true);
+        default:
+          return(false);
+        }
+      }
+
+      int WireType(int type_)
+      {
+        return(static_cast<int>(WireFormatLite::WireTypeForFieldType(static_cast<WireFormatLite::FieldType>(type_))));
+      }
+    }
+
+    CProtoFieldExtractor::CProtoFieldExtractor() :
+      m_nodes(1),
+      m_value_count(0),
+      m_counter_count(0)
+    {
+    }
+
+    bool CProtoFieldExtractor::Compile(const google::protobuf::Descriptor* descriptor_, const std::vector<std::string>& paths_, std::string& error_)
+    {
+      m_nodes.assign(1, SNode());
+      m_value_count   = 0;
+      m_counter_count = 0;
+
+      if (descriptor_ == nullptr)
+      {
+        error_ = "No message descriptor";
+        return(false);
+      }
+
+      for (const auto& path : paths_)
+      {
+        const google::protobuf::Descriptor* descriptor = descriptor_;
+        int  node(0);
+
+        std::stringstream items(path);
+        std::string item;
+        std::string error;
+        bool leaf_added(false);
+        while (std::getline(items, item, '.'))
+        {
+          std::string name;
+          int index(-1);
+          const FieldDescriptor* field = ParsePathItem(item, name, index) ? descriptor->FindFieldByName(name) : nullptr;
+          if (field == nullptr)
+          {
+            error = "Unknown field \"" + item + "\" in path \"" + path + "\"";
+            break;
+          }
+          if (field->is_repeated() != (index >= 0))
+          {
+            error = "Field \"" + name + "\" in path \"" + path + "\"" + (field->is_repeated() ? " is repeated and needs an index" : " is not repeated");
+            break;
+          }
+          if (field->type() == FieldDescriptor::TYPE_GROUP)
+          {
+            error = "Group \"" + name + "\" in path \"" + path + "\" is not supported";
+            break;
+          }
+
+          const bool last = items.peek() == std::char_traits<char>::eof();
+          if (!last)
+          {
+            if (field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE)
+            {
+              error = "Field \"" + name + "\" in path \"" + path + "\" is not a message";
+              break;
+            }
+
+            // paths with the same prefix share their nodes
+            int child(-1);
+            for (const auto& entry : m_nodes[node].fields)
+            {
+              if ((entry.number == field->number()) && (entry.index == index)) child = entry.node;
+            }
+            if (child < 0)
+            {
+              child = static_cast<int>(m_nodes.size());
+              m_nodes.push_back(SNode());
+              AddField(node, field, index).node = child;
+            }
+            node       = child;
+            descriptor = field->message_type();
+          }
+          else
+          {
+            if (!IsNumeric(field))
+            {
+              error = "Field \"" + name + "\" in path \"" + path + "\" is not a numeric field";
+              break;
+            }
+            SField& leaf = AddField(node, field, index);
+            leaf.value         = static_cast<int>(m_value_count++);
+            leaf.default_value = DefaultValue(field);
+            leaf_added = true;
+          }
+        }
+
+        if (!leaf_added)
+        {
+          error_ = error.empty() ? "Invalid path \"" + path + "\"" : error;
+          m_nodes.assign(1, SNode());
+          m_value_count   = 0;
+          m_counter_count = 0;
+          return(false);
+        }
+      }
+
+      for (size_t node = 0; node < m_nodes.size(); ++node)
+      {
+        CollectDefaults(static_cast<int>(node), m_nodes[node]);
+      }
+
+      error_.clear();
+      return(true);
+    }
+
+    CProtoFieldExtractor::SField& CProtoFieldExtractor::AddField(int node_, const FieldDescriptor* field_, int index_)
+    {
+      SField field;
+      field.number  = field_->number();
+      field.type    = static_cast<int>(field_->type());
+      field.index   = index_;
+      field.counter = -1;
+      field.value   = -1;
+      field.node    = -1;
+      field.default_value = 0.0;
+
+      // the elements of a repeated field share one occurrence counter
+      if (field_->is_repeated())
+      {
+        for (const auto& entry : m_nodes[node_].fields)
+        {
+          if (entry.number == field.number) field.counter = entry.counter;
+        }
+        if (field.counter < 0) field.counter = m_counter_count++;
+      }
+
+      m_nodes[node_].fields.push_back(field);
+      return(m_nodes[node_].fields.back());
+    }
+
+    void CProtoFieldExtractor::CollectDefaults(int node_, SNode& target_) const
+    {
+      // the single fields of a present message are present as well, with their default values
+      for (const auto& field : m_nodes[node_].fields)
+      {
+        if (field.index >= 0) continue;
+        if (field.node >= 0) CollectDefaults(field.node, target_);
+        else                 target_.defaults.emplace_back(field.value, field.default_value);
+      }
+    }
+
+    bool CProtoFieldExtractor::Extract(const void* buffer_, size_t size_, std::vector<double>& values_) const
+    {
+      values_.assign(m_value_count, std::numeric_limits<double>::quiet_NaN());
+      if (m_value_count == 0) return(true);
+      if (size_ > static_cast<size_t>(std::numeric_limits<int>::max())) return(false);
+
+      // occurrence counters of the repeated fields, followed by the entered flags of the nodes
+      std::vector<int> state(static_cast<size_t>(m_counter_count) + m_nodes.size(), 0);
+      google::protobuf::io::CodedInputStream input(static_cast<const google::protobuf::uint8*>(buffer_), static_cast<int>(size_));
+      return(ExtractNode(input, 0, values_, state, 0));
+    }
+
+    bool CProtoFieldExtractor::ExtractNode(google::protobuf::io::CodedInputStream& input_, int node_, std::vector<double>& values_, std::vector<int>& state_, int depth_) const
+    {
+      if (depth_ > max_depth) return(false);
+
+      const SNode& node = m_nodes[node_];
+
+      // a non repeated message field may occur several times, it is merged then
+      int& entered = state_[static_cast<size_t>(m_counter_count + node_)];
+      if (entered == 0)
+      {
+        entered = 1;
+        for (const auto& value : node.defaults) values_[static_cast<size_t>(value.first)] = value.second;
+      }
+      for (;;)
+      {
+        const google::protobuf::uint32 tag = input_.ReadTag();
+        if (tag == 0) return(input_.ConsumedEntireMessage());
+
+        const int number = WireFormatLite::GetTagFieldNumber(tag);
+        const SField* field(nullptr);
+        for (const auto& entry : node.fields)
+        {
+          if (entry.number == number)
+          {
+            field = &entry;
+            break;
+          }
+        }
+
+        if (field == nullptr)
+        {
+          // not selected
+          if (!WireFormatLite::SkipField(&input_, tag)) return(false);
+        }
+        else if (field->node >= 0)
+        {
+          if (!ExtractMessage(input_, node, *field, tag, values_, state_, depth_)) return(false);
+        }
+        else
+        {
+          if (!ExtractValue(input_, node, *field, tag, values_, state_)) return(false);
+        }
+      }
+    }
+
+    bool CProtoFieldExtractor::ExtractMessage(google::protobuf::io::CodedInputStream& input_, const SNode& node_, const SField& field_, google::protobuf::uint32 tag_, std::vector<double>& values_, std::vector<int>& state_, int depth_) const
+    {
+      if (WireFormatLite::GetTagWireType(tag_) != WireFormatLite::WIRETYPE_LENGTH_DELIMITED) return(WireFormatLite::SkipField(&input_, tag_));
+
+      // find the selected element of a repeated field
+      const int occurrence = (field_.counter >= 0) ? state_[field_.counter]++ : -1;
+      const SField* selected(nullptr);
+      for (const auto& entry : node_.fields)
+      {
+        if ((entry.number == field_.number) && (entry.index == occurrence)) selected = &entry;
+      }
+      if (selected == nullptr) return(WireFormatLite::SkipField(&input_, tag_));
+
+      int length(0);
+      if (!input_.ReadVarintSizeAsInt(&length)) return(false);
+      if (!LengthAvailable(input_, length)) return(false);
+      const auto limit = input_.PushLimit(length);
+      if (!ExtractNode(input_, selected->node, values_, state_, depth_ + 1)) return(false);
+      input_.PopLimit(limit);
+      return(true);
+    }
+
+    bool CProtoFieldExtractor::ExtractValue(google::protobuf::io::CodedInputStream& input_, const SNode& node_, const SField& field_, google::protobuf::uint32 tag_, std::vector<double>& values_, std::vector<int>& state_) const
+    {
+      const int wire_type = static_cast<int>(WireFormatLite::GetTagWireType(tag_));
+      double value(0.0);
+
+      // packed repeated field
+      if ((field_.counter >= 0) && (wire_type == WireFormatLite::WIRETYPE_LENGTH_DELIMITED))
+      {
+        int length(0);
+        if (!input_.ReadVarintSizeAsInt(&length)) return(false);
+        if (!LengthAvailable(input_, length)) return(false);
+        const auto limit = input_.PushLimit(length);
+        while (input_.BytesUntilLimit() > 0)
+        {
+          if (!ReadValue(input_, field_.type, value)) return(false);
+          StoreValue(node_, field_.number, state_[field_.counter]++, value, values_);
+        }
+        input_.PopLimit(limit);
+        return(true);
+      }
+
+      // the field type was changed, ignore it
+      if (wire_type != WireType(field_.type)) return(WireFormatLite::SkipField(&input_, tag_));
+
+      if (!ReadValue(input_, field_.type, value)) return(false);
+      StoreValue(node_, field_.number, (field_.counter >= 0) ? state_[field_.counter]++ : -1, value, values_);
+      return(true);
+    }
+
+    void CProtoFieldExtractor::StoreValue(const SNode& node_, int number_, int occurrence_, double value_, std::vector<double>& values_) const
+    {
+      // a field may be selected by several paths
+      for (const auto& entry : node_.fields)
+      {
+        if ((entry.number == number_) && (entry.index == occurrence_)) values_[static_cast<size_t>(entry.value)] = value_;
+      }
+    }
+  }
+}
@@ -86,6 +86,45 @@ namespace eCAL
         CREATE
       };
 
+      /**
+       * @brief Codecs that can be used to compress measurement entries
+      **/
+      enum class CompressionCodec
+      {
+        None,         //!< Entries are stored uncompressed
+        Deflate,      //!< Entries are compressed with zlib / deflate (level 1-9)
+        Hdf5Filter,   //!< Entries are compressed with a registered HDF5 filter plugin (e.g. LZ4, zstd). Readers need the same plugin to decompress the data.
+      };
+
+      /**
+       * @brief Compression settings for a channel
+      **/
+      struct Compression
+      {
+        CompressionCodec          codec;          //!< The codec to use
+        int                       level;          //!< Codec specific compression level
+        unsigned int              filter_id;      //!< HDF5 filter ID (only used with CompressionCodec::Hdf5Filter)
+        std::vector<unsigned int> filter_params;  //!< HDF5 filter parameters (only used with CompressionCodec::Hdf5Filter)
+
+        //!< @cond
+        Compression() : codec(CompressionCodec::None), level(0), filter_id(0) {}
+
+        Compression(CompressionCodec codec_, int level_) : codec(codec_), level(level_), filter_id(0) {}
+
+        Compression(unsigned int filter_id_, const std::vector<unsigned int>& filter_params_) : codec(CompressionCodec::Hdf5Filter), level(0), filter_id(filter_id_), filter_params(filter_params_) {}
+
+        bool operator==(const Compression& other) const
+        {
+          return (codec == other.codec && level == other.level && filter_id == other.filter_id && filter_params == other.filter_params);
+        }
+
+        bool operator!=(const Compression& other) const
+        {
+          return !operator==(other);
+        }
+        //!< @endcond
+      };
+
     }
   }
 }
\ No newline at end of file
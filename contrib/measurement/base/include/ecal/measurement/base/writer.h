@@ -152,6 +152,18 @@ namespace eCAL
         **/
         virtual void SetChannelType(const std::string& channel_name, const std::string& type) = 0;
 
+        /**
+         * @brief Set the compression of the given channel
+         *
+         * Entries that are added after calling this function are compressed
+         * with the given settings. Readers decompress the data transparently.
+         * Implementations that do not support compression ignore the call.
+         *
+         * @param channel_name  channel name
+         * @param compression   compression settings of the channel
+        **/
+        virtual void SetChannelCompression(const std::string& /*channel_name*/, const Compression& /*compression*/) {}
+
         /**
          * @brief Set measurement file base name (desired name for the actual hdf5 files that will be created)
          *
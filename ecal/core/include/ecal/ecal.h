@@ -28,6 +28,7 @@
 #include <ecal/ecal_os.h>
 #include <ecal/ecal_defs.h>
 #include <ecal/ecal_callback.h>
+#include <ecal/ecal_callback_executor.h>
 #include <ecal/ecal_client.h>
 #include <ecal/ecal_config.h>
 #include <ecal/ecal_core.h>
@@ -0,0 +1,125 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   ecal_callback_executor.h
+ * @brief  eCAL subscriber callback executor interface
+**/
+
+#pragma once
+
+#include <ecal/ecal_os.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace eCAL
+{
+  class CCallbackExecutorImpl;
+  class CSubscriber;
+
+  /**
+   * @brief Behavior of a callback executor if a queue is full.
+  **/
+  enum eCallbackOverflowPolicy
+  {
+    callback_overflow_drop_oldest,  //!< discard the oldest queued sample, default value
+    callback_overflow_drop_newest,  //!< discard the new sample
+    callback_overflow_block,        //!< the transport thread waits until the queue has space
+  };
+
+  /**
+   * @brief Callback executor settings.
+  **/
+  struct SCallbackExecutorConfig
+  {
+    SCallbackExecutorConfig() : thread_count(1), queue_size(64), overflow_policy(callback_overflow_drop_oldest) {}
+    int                      thread_count;     //!< number of worker threads
+    size_t                   queue_size;       //!< number of samples a worker queues at most
+    eCallbackOverflowPolicy  overflow_policy;  //!< behavior if a queue is full
+  };
+
+  /**
+   * @brief Callback executor statistics.
+  **/
+  struct SCallbackExecutorStatistics
+  {
+    SCallbackExecutorStatistics() : queue_depth(0), queue_depth_max(0), executed(0), dropped(0), blocked(0) {}
+    size_t              queue_depth;      //!< number of currently queued samples
+    size_t              queue_depth_max;  //!< highest number of samples queued by a worker
+    unsigned long long  executed;         //!< number of executed callbacks
+    unsigned long long  dropped;          //!< number of samples discarded because of a full queue
+    unsigned long long  blocked;          //!< number of times a transport thread had to wait for a full queue
+  };
+
+  /**
+   * @brief eCAL subscriber callback executor.
+   *
+   * Subscribers that use an executor copy their received samples into a queue and
+   * return to the transport layer at once, the receive callbacks are called by the
+   * worker threads of the executor. All samples of one subscriber are handled by
+   * the same worker, so its callbacks are called in order and never concurrently.
+   *
+   * One executor can be shared by several subscribers. Its worker threads belong
+   * to the "callback" class of the [threads] configuration.
+  **/
+  class CCallbackExecutor
+  {
+  public:
+    /**
+     * @brief Constructor, starts the worker threads.
+     *
+     * @param config_  The executor settings.
+    **/
+    ECAL_API explicit CCallbackExecutor(const SCallbackExecutorConfig& config_ = SCallbackExecutorConfig());
+
+    /**
+     * @brief Destructor, the worker threads stop as soon as no subscriber uses the executor anymore.
+    **/
+    ECAL_API ~CCallbackExecutor();
+
+    /**
+     * @brief CCallbackExecutors are non-copyable
+    **/
+    ECAL_API CCallbackExecutor(const CCallbackExecutor&) = delete;
+
+    /**
+     * @brief CCallbackExecutors are non-copyable
+    **/
+    ECAL_API CCallbackExecutor& operator=(const CCallbackExecutor&) = delete;
+
+    /**
+     * @brief Get the executor settings.
+     *
+     * @return  The settings.
+    **/
+    ECAL_API SCallbackExecutorConfig GetConfig() const;
+
+    /**
+     * @brief Get the queue and execution statistics.
+     *
+     * @return  The statistics.
+    **/
+    ECAL_API SCallbackExecutorStatistics GetStatistics() const;
+
+  private:
+    friend class CSubscriber;
+    std::shared_ptr<CCallbackExecutorImpl> m_impl;
+  };
+}
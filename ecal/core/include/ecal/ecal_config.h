@@ -42,6 +42,7 @@ namespace eCAL
     ECAL_API std::string       GetLoadedEcalIniPath                 ();
     ECAL_API int               GetRegistrationTimeoutMs             ();
     ECAL_API int               GetRegistrationRefreshMs             ();
+    ECAL_API bool              IsRegistrationFastDiscoveryEnabled   ();
 
     /////////////////////////////////////
     // network
@@ -77,6 +78,8 @@ namespace eCAL
     /////////////////////////////////////
 
     ECAL_API std::string       GetTimesyncModuleName                ();
+    ECAL_API size_t            GetTimerThreadCount                  ();
+    ECAL_API bool              IsTimerHighPrecisionEnabled          ();
 
     /////////////////////////////////////
     // process
@@ -94,6 +97,9 @@ namespace eCAL
     ECAL_API eCAL_Logging_Filter GetConsoleLogFilter                  ();
     ECAL_API eCAL_Logging_Filter GetFileLogFilter                     ();
     ECAL_API eCAL_Logging_Filter GetUdpLogFilter                      ();
+    ECAL_API bool                IsAsyncLoggingEnabled                ();
+    ECAL_API size_t              GetAsyncLoggingQueueSize             ();
+    ECAL_API bool                IsTopicStatisticsEnabled             ();
 
     /////////////////////////////////////
     // sys
@@ -127,7 +133,9 @@ namespace eCAL
       ECAL_API bool              IsNetworkMonitoringDisabled        ();
       ECAL_API size_t            GetShmMonitoringQueueSize          ();
       ECAL_API std::string       GetShmMonitoringDomain             ();
+      ECAL_API int               GetShmMonitoringStatisticsRefreshMs();
       ECAL_API bool              GetDropOutOfOrderMessages          ();
+      ECAL_API std::string       GetTraceFile                       ();
     }
   }
 }
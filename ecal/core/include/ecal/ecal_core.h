@@ -100,6 +100,17 @@ namespace eCAL
   **/
   ECAL_API int IsInitialized(unsigned int component_ = 0);
 
+  /**
+   * @brief Get the startup time of the eCAL subsystems.
+   *
+   *        Subsystems that are not needed by every process (subscriber and service gate,
+   *        memory file observer pool, time synchronization, logging) are created on their
+   *        first use and are listed from then on.
+   *
+   * @return  Subsystem names and their startup time in microseconds in order of creation.
+  **/
+  ECAL_API std::vector<std::pair<std::string, long long>> GetStartupTimes();
+
   /**
    * @brief  Set/change the unit name of current module.
    *
@@ -84,5 +84,10 @@ namespace eCAL
      * @brief Returns the current measured core time in s. 
     **/
     ECAL_API double GetCoreTime();
+
+    /**
+     * @brief Returns the number of log messages dropped, because the asynchronous log queue was full.
+    **/
+    ECAL_API unsigned long long GetDroppedMessages();
   }
 }
@@ -36,6 +36,31 @@ namespace eCAL
 {
   namespace Monitoring
   {
+    struct SLatencyStatistics                                   //<! eCAL latency distribution of one registration cycle
+    {
+      SLatencyStatistics()
+      {
+        count = 0;
+        min   = 0;
+        max   = 0;
+        mean  = 0.0;
+        p50   = 0;
+        p90   = 0;
+        p99   = 0;
+        p999  = 0;
+      };
+
+      long long                           count;                //!< number of measured samples
+      long long                           min;                  //!< minimum latency [us]
+      long long                           max;                  //!< maximum latency [us]
+      double                              mean;                 //!< mean latency [us]
+      long long                           p50;                  //!< 50th percentile [us]
+      long long                           p90;                  //!< 90th percentile [us]
+      long long                           p99;                  //!< 99th percentile [us]
+      long long                           p999;                 //!< 99.9th percentile [us]
+      std::map<long long, long long>      histogram;            //!< histogram (upper bucket bound [us], count), empty buckets are skipped
+    };
+
     struct STopicMon                                            //<! eCAL Topic struct
     {
       STopicMon()
@@ -54,6 +79,7 @@ namespace eCAL
         did                = 0;
         dclock             = 0;
         dfreq              = 0;
+        drate              = 0;
       };
 
       int                                 rclock;               //!< registration clock (heart beat)
@@ -80,10 +106,30 @@ namespace eCAL
       long long                           did;                  //!< data send id (publisher setid)
       long long                           dclock;               //!< data clock (send / receive action)
       long                                dfreq;                //!< data frequency (send / receive samples per second) [mHz]
+      long long                           drate;                //!< data rate (received bytes per second), only with topic statistics enabled
+
+      SLatencyStatistics                  latency;              //!< send time -> receive callback entry, only with topic statistics enabled
+      SLatencyStatistics                  callback_duration;    //!< duration of the receive callback, only with topic statistics enabled
 
       std::map<std::string, std::string>  attr;                 //!< generic topic description
     };
 
+    struct SThreadMon                                           //<! eCAL internal thread struct
+    {
+      SThreadMon()
+      {
+        tid      = 0;
+        priority = 0;
+        cpu_time = 0;
+      };
+
+      std::string    name;                                      //!< thread name (ecal_<thread class>)
+      int            tid;                                       //!< os thread id
+      std::string    affinity;                                  //!< configured cpu list, empty if not pinned
+      int            priority;                                  //!< configured SCHED_FIFO priority, 0 for the default policy
+      long long      cpu_time;                                  //!< consumed cpu time [us]
+    };
+
     struct SProcessMon                                          //<! eCAL Process struct
     {
       SProcessMon()
@@ -138,6 +184,8 @@ namespace eCAL
       std::string    component_init_info;                       //!< like comp_init_state as human readable string (pub|sub|srv|mon|log|time|proc)
 
       std::string    ecal_runtime_version;                      //!< loaded / runtime eCAL version of a component
+
+      std::vector<SThreadMon>  threads;                         //!< eCAL internal threads
     };
 
     struct SMethodMon                                           //<! eCAL Server Method struct
@@ -213,5 +261,53 @@ namespace eCAL
      * @return Number of struct elements if succeeded.
     **/
     ECAL_API int GetMonitoring(eCAL::Monitoring::SMonitoring& mon_, unsigned int entities_ = Entity::All);
+
+    namespace Field                                             //<! optional (large) members of the monitoring structs
+    {
+      constexpr unsigned int TopicDescriptor   = 0x001;         //<! STopicMon::tinfo.descriptor
+      constexpr unsigned int TopicAttributes   = 0x002;         //<! STopicMon::attr
+      constexpr unsigned int TopicStatistics   = 0x004;         //<! STopicMon::latency, STopicMon::callback_duration
+      constexpr unsigned int ProcessThreads    = 0x008;         //<! SProcessMon::threads
+      constexpr unsigned int MethodDescriptors = 0x010;         //<! SMethodMon::req_desc, SMethodMon::resp_desc
+
+      constexpr unsigned int All = TopicDescriptor
+        | TopicAttributes
+        | TopicStatistics
+        | ProcessThreads
+        | MethodDescriptors;
+
+      constexpr unsigned int None = 0x000;
+    }
+
+    struct SMonitoringQuery                                     //<! eCAL Monitoring query, empty filters match everything
+    {
+      SMonitoringQuery()
+      {
+        entities   = Entity::All;
+        process_id = 0;
+        fields     = Field::All;
+      };
+
+      unsigned int  entities;                                   //<! entities to get (Entity::..)
+      std::string   host_name;                                  //<! host name
+      int           process_id;                                 //<! process id (0 == all)
+      std::string   process_name;                               //<! process name
+      std::string   unit_name;                                  //<! unit name
+      std::string   topic_name;                                 //<! topic name of publishers / subscribers, service name of servers / clients
+      unsigned int  fields;                                     //<! optional members to fill (Field::..)
+    };
+
+    /**
+     * @brief Get a filtered monitoring subset as a struct.
+     *
+     * The entities are filtered and copied directly from the monitoring database,
+     * so periodic queries (e.g. for process states only) do not pay for the whole system snapshot.
+     *
+     * @param [out] mon_    Target struct to store monitoring information.
+     * @param       query_  Entities, filters and optional members to get.
+     *
+     * @return Number of struct elements if succeeded.
+    **/
+    ECAL_API int GetMonitoring(eCAL::Monitoring::SMonitoring& mon_, const SMonitoringQuery& query_);
   }
 }
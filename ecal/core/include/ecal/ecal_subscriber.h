@@ -26,6 +26,7 @@
 
 #include <ecal/ecal_os.h>
 #include <ecal/ecal_callback.h>
+#include <ecal/ecal_callback_executor.h>
 #include <ecal/ecal_qos.h>
 #include <ecal/types/topic_information.h>
 
@@ -263,6 +264,16 @@ namespace eCAL
     **/
     ECAL_API bool RemReceiveCallback();
 
+    /**
+     * @brief Call the receive callback by the worker threads of an executor
+     *        instead of the transport layer thread.
+     *
+     * @param executor_  The executor, it may be shared by several subscribers (nullptr to call the callback directly).
+     *
+     * @return  True if succeeded, false if not.
+    **/
+    ECAL_API bool SetCallbackExecutor(std::shared_ptr<CCallbackExecutor> executor_);
+
     /**
      * @brief Add callback function for subscriber events.
      *
@@ -350,9 +361,10 @@ namespace eCAL
     bool ApplyTopicToDescGate(const std::string& topic_name_, const STopicInformation& topic_info_);
 
     // class members
-    std::shared_ptr<CDataReader>     m_datareader;
-    struct ECAL_API QOS::SReaderQOS  m_qos;
-    bool                             m_created;
-    bool                             m_initialized;
+    std::shared_ptr<CDataReader>        m_datareader;
+    std::shared_ptr<CCallbackExecutor>  m_callback_executor;
+    struct ECAL_API QOS::SReaderQOS     m_qos;
+    bool                                m_created;
+    bool                                m_initialized;
   };
 };
@@ -32,6 +32,19 @@ namespace eCAL
   class CTimerImpl;
   typedef std::function<void(void)> TimerCallbackT;
 
+  /**
+   * @brief Call statistics of a timer.
+  **/
+  struct STimerStatistics
+  {
+    STimerStatistics() : call_count(0), overrun_count(0), jitter_min_us(0), jitter_max_us(0), jitter_mean_us(0) {}
+    long long call_count;      //!< number of callback calls
+    long long overrun_count;   //!< number of calls skipped, because the callback took longer than the timer period
+    long long jitter_min_us;   //!< minimum delay of a call to its scheduled time in us
+    long long jitter_max_us;   //!< maximum delay of a call to its scheduled time in us
+    long long jitter_mean_us;  //!< mean delay of a call to its scheduled time in us
+  };
+
   /**
    * @brief eCAL timer class.
    *
@@ -77,6 +90,15 @@ namespace eCAL
     **/
     bool Stop();
 
+    /**
+     * @brief Get the call and jitter statistics of the running timer.
+     *
+     * @param stats_  The statistics.
+     *
+     * @return  True if the timer is running and statistics are available.
+    **/
+    bool GetStatistics(STimerStatistics& stats_) const;
+
   protected:
     // class members
     CTimerImpl*  m_timer;
@@ -0,0 +1,325 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   view_subscriber.h
+ * @brief  eCAL zero copy subscriber interface for Cap'n Proto message definitions
+**/
+
+#pragma once
+
+#include <ecal/ecal_subscriber.h>
+#include <ecal/msg/capnproto/helper.h>
+
+// capnp includes
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif /*_MSC_VER*/
+#include <capnp/serialize.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif /*_MSC_VER*/
+
+// stl includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+
+namespace eCAL
+{
+  namespace capnproto
+  {
+    /**
+    * @brief  eCAL capnp view subscriber class.
+    *
+    * Subscriber template class for capnp messages. The receive callback gets a reader on the
+    * received buffer, no message is copied into a builder. If the publisher uses the shared
+    * memory zero copy mode, the reader points directly into the memory file.
+    *
+    * The reader is only valid during the callback. For details see documentation of CSubscriber class.
+    **/
+    template <typename message_type>
+    class CViewSubscriber : public eCAL::CSubscriber
+    {
+    public:
+      /**
+      * @brief  Constructor.
+      **/
+      CViewSubscriber() : eCAL::CSubscriber()
+      {
+      }
+
+      /**
+      * @brief  Constructor.
+      *
+      * @param topic_name_  Unique topic name.
+      **/
+      CViewSubscriber(const std::string& topic_name_) : eCAL::CSubscriber(topic_name_, CViewSubscriber::GetTopicInformation())
+      {
+      }
+
+      /**
+      * @brief  Copy Constructor is not available.
+      **/
+      CViewSubscriber(const CViewSubscriber&) = delete;
+
+      /**
+      * @brief  Copy Constructor is not available.
+      **/
+      CViewSubscriber& operator=(const CViewSubscriber&) = delete;
+
+      /**
+      * @brief  Move Constructor
+      **/
+      CViewSubscriber(CViewSubscriber&& rhs)
+        : eCAL::CSubscriber(std::move(rhs))
+        , m_reader_options(rhs.m_reader_options)
+        , m_verify(rhs.m_verify)
+        , m_view_callback(std::move(rhs.m_view_callback))
+        , m_error_callback(std::move(rhs.m_error_callback))
+      {
+        // the callback bound to the CSubscriber belongs to rhs, bind to this callback instead
+        if (m_view_callback != nullptr) BindReceiveCallback();
+      }
+
+      /**
+      * @brief  Move assignment
+      **/
+      CViewSubscriber& operator=(CViewSubscriber&& rhs)
+      {
+        eCAL::CSubscriber::operator=(std::move(rhs));
+
+        m_reader_options = rhs.m_reader_options;
+        m_verify         = rhs.m_verify;
+        m_view_callback  = std::move(rhs.m_view_callback);
+        m_error_callback = std::move(rhs.m_error_callback);
+
+        // the callback bound to the CSubscriber belongs to rhs, bind to this callback instead
+        if (m_view_callback != nullptr) BindReceiveCallback();
+
+        return *this;
+      }
+
+      /**
+      * @brief  Destructor, removes the receive callback before the buffers are released.
+      **/
+      ~CViewSubscriber() override
+      {
+        RemReceiveCallback();
+      }
+
+      /**
+      * @brief  Creates this object.
+      *
+      * @param topic_name_  Unique topic name.
+      *
+      * @return  True if it succeeds, false if it fails.
+      **/
+      bool Create(const std::string& topic_name_)
+      {
+        return(eCAL::CSubscriber::Create(topic_name_, GetTopicInformation()));
+      }
+
+      /**
+      * @brief  Set the capnp reader options.
+      *
+      *         The traversal limit is raised to the size of the received message at least,
+      *         so large messages can be read completely once. Set the options before adding the callback.
+      *
+      * @param options_  The reader options.
+      **/
+      void SetReaderOptions(const capnp::ReaderOptions& options_)
+      {
+        m_reader_options = options_;
+      }
+
+      /**
+      * @brief  Enable the verification of the received messages (default: disabled).
+      *
+      *         Without verification only the segment table and the root pointer are checked before
+      *         the callback, a malformed message throws a kj::Exception while it is read in the callback.
+      *         The verification traverses the whole message, messages that fail it are dropped and
+      *         reported to the error callback. Set it before adding the callback.
+      *
+      * @param state_  Enable or disable the verification.
+      **/
+      void EnableVerification(bool state_)
+      {
+        m_verify = state_;
+      }
+
+      /**
+      * @brief eCAL capnp message view callback function
+      *
+      * @param topic_name_  Topic name of the data source (publisher).
+      * @param msg_         Reader of the received message, only valid during the callback.
+      * @param time_        Message time stamp.
+      * @param clock_       Message writer clock.
+      * @param id_          Message id.
+      **/
+      typedef std::function<void(const char* topic_name_, typename message_type::Reader msg_, long long time_, long long clock_, long long id_)> ViewCallbackT;
+
+      /**
+      * @brief Add callback function for incoming receives.
+      *
+      * @param callback_  The callback function to add.
+      *
+      * @return  True if succeeded, false if not.
+      **/
+      bool AddReceiveCallback(ViewCallbackT callback_)
+      {
+        RemReceiveCallback();
+
+        m_view_callback = std::move(callback_);
+        return(BindReceiveCallback());
+      }
+
+      /**
+      * @brief Remove callback function for incoming receives.
+      *
+      * @return  True if succeeded, false if not.
+      **/
+      bool RemReceiveCallback()
+      {
+        if (m_view_callback == nullptr) return(false);
+        // no callback is running after the subscriber callback was removed
+        const bool success = eCAL::CSubscriber::RemReceiveCallback();
+        m_view_callback = nullptr;
+        return(success);
+      }
+
+      /**
+      * @brief Callback function in case a received message is dropped.
+      *
+      * @param error_  The error message string.
+      **/
+      typedef std::function<void(const std::string& error_)> ErrorCallbackT;
+
+      /**
+      * @brief Add callback function in case a received message is dropped. Set it before adding the receive callback.
+      *
+      * @param callback_  The callback function to add.
+      *
+      * @return  True if succeeded, false if not.
+      **/
+      bool AddErrorCallback(ErrorCallbackT callback_)
+      {
+        m_error_callback = std::move(callback_);
+        return(true);
+      }
+
+      /**
+      * @brief Remove callback function in case a received message is dropped.
+      *
+      * @return  True if succeeded, false if not.
+      **/
+      bool RemErrorCallback()
+      {
+        m_error_callback = nullptr;
+        return(true);
+      }
+
+    private:
+      /**
+       * @brief   Get topic information of the message.
+       *
+       * @return  Topic information.
+      **/
+      STopicInformation GetTopicInformation() const
+      {
+        STopicInformation topic_info;
+        topic_info.encoding   = eCAL::capnproto::EncodingAsString();
+        topic_info.type       = eCAL::capnproto::TypeAsString<message_type>();
+        topic_info.descriptor = eCAL::capnproto::SchemaAsString<message_type>();
+        return topic_info;
+      }
+
+      bool BindReceiveCallback()
+      {
+        eCAL::CSubscriber::RemReceiveCallback();
+        auto callback = std::bind(&CViewSubscriber::OnReceive, this, std::placeholders::_1, std::placeholders::_2);
+        return(eCAL::CSubscriber::AddReceiveCallback(callback));
+      }
+
+      void OnReceive(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
+      {
+        if (m_view_callback == nullptr) return;
+
+        const size_t size = static_cast<size_t>(data_->size);
+        if ((size == 0) || (size % sizeof(capnp::word) != 0))
+        {
+          OnError("CViewSubscriber: Received message size is not a multiple of the word size");
+          return;
+        }
+
+        // the transport layers deliver word aligned buffers, copy the rare unaligned one
+        kj::ArrayPtr<const capnp::word> words;
+        if (reinterpret_cast<uintptr_t>(data_->buf) % sizeof(capnp::word) != 0)
+        {
+          if (m_aligned_buffer.size() < size / sizeof(capnp::word))
+          {
+            m_aligned_buffer = kj::heapArray<capnp::word>(size / sizeof(capnp::word));
+          }
+          std::memcpy(m_aligned_buffer.begin(), data_->buf, size);
+          words = kj::arrayPtr(m_aligned_buffer.begin(), size / sizeof(capnp::word));
+        }
+        else
+        {
+          words = kj::arrayPtr(static_cast<const capnp::word*>(data_->buf), size / sizeof(capnp::word));
+        }
+
+        capnp::ReaderOptions options(m_reader_options);
+        options.traversalLimitInWords = std::max<uint64_t>(options.traversalLimitInWords, words.size());
+
+        // check the message before the callback, exceptions of the callback itself are passed on
+        try
+        {
+          capnp::FlatArrayMessageReader check_reader(words, options);
+          const typename message_type::Reader root = check_reader.getRoot<message_type>();
+          if (m_verify) root.totalSize();
+        }
+        catch (const kj::Exception& e)
+        {
+          OnError(std::string("CViewSubscriber: Received message is malformed: ") + e.getDescription().cStr());
+          return;
+        }
+
+        // a fresh reader, the verification may have used up the traversal limit
+        capnp::FlatArrayMessageReader reader(words, options);
+        m_view_callback(topic_name_, reader.getRoot<message_type>(), data_->time, data_->clock, data_->id);
+      }
+
+      void OnError(const std::string& error_)
+      {
+        if (m_error_callback != nullptr) m_error_callback(error_);
+      }
+
+      capnp::ReaderOptions     m_reader_options;
+      bool                     m_verify = false;
+      ViewCallbackT            m_view_callback;
+      ErrorCallbackT           m_error_callback;
+      kj::Array<capnp::word>   m_aligned_buffer;
+    };
+    /** @example addressbook_rec_view.cpp
+    * This is an example how to use eCAL::capnproto::CViewSubscriber to read capnp data in place. To send the data, see @ref addressbook_snd.cpp .
+    */
+  }
+}
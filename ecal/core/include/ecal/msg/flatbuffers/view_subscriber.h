@@ -0,0 +1,285 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   view_subscriber.h
+ * @brief  eCAL zero copy subscriber interface for google::flatbuffers message definitions
+**/
+
+#pragma once
+
+#include <ecal/ecal_subscriber.h>
+
+// flatbuffers includes
+#include <flatbuffers/flatbuffers.h>
+
+// stl includes
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace flatbuffers
+  {
+    /**
+     * @brief  eCAL google::flatbuffers view subscriber class.
+     *
+     * Subscriber template class for google::flatbuffers messages, T is the root table type
+     * of the message. The receive callback gets a read-only view on the received buffer, no
+     * message is copied or unpacked. If the publisher uses the shared memory zero copy mode,
+     * the view points directly into the memory file.
+     *
+     * The view is only valid during the callback. For details see documentation of CSubscriber class.
+    **/
+    template <typename T>
+    class CViewSubscriber : public eCAL::CSubscriber
+    {
+    public:
+      /**
+       * @brief  Constructor.
+      **/
+      CViewSubscriber() : eCAL::CSubscriber()
+      {
+      }
+
+      /**
+       * @brief  Constructor.
+       *
+       * @param topic_name_  Unique topic name.
+      **/
+      CViewSubscriber(const std::string& topic_name_) : eCAL::CSubscriber(topic_name_, CViewSubscriber::GetTopicInformation())
+      {
+      }
+
+      /**
+      * @brief  Copy Constructor is not available.
+      **/
+      CViewSubscriber(const CViewSubscriber&) = delete;
+
+      /**
+      * @brief  Copy Constructor is not available.
+      **/
+      CViewSubscriber& operator=(const CViewSubscriber&) = delete;
+
+      /**
+      * @brief  Move Constructor
+      **/
+      CViewSubscriber(CViewSubscriber&& rhs)
+        : eCAL::CSubscriber(std::move(rhs))
+        , m_verify(rhs.m_verify)
+        , m_view_callback(std::move(rhs.m_view_callback))
+        , m_error_callback(std::move(rhs.m_error_callback))
+      {
+        // the callback bound to the CSubscriber belongs to rhs, bind to this callback instead
+        if (m_view_callback != nullptr) BindReceiveCallback();
+      }
+
+      /**
+      * @brief  Move assignment
+      **/
+      CViewSubscriber& operator=(CViewSubscriber&& rhs)
+      {
+        eCAL::CSubscriber::operator=(std::move(rhs));
+
+        m_verify         = rhs.m_verify;
+        m_view_callback  = std::move(rhs.m_view_callback);
+        m_error_callback = std::move(rhs.m_error_callback);
+
+        // the callback bound to the CSubscriber belongs to rhs, bind to this callback instead
+        if (m_view_callback != nullptr) BindReceiveCallback();
+
+        return *this;
+      }
+
+      /**
+       * @brief  Destructor, removes the receive callback before the buffers are released.
+      **/
+      ~CViewSubscriber() override
+      {
+        RemReceiveCallback();
+      }
+
+      /**
+       * @brief  Creates this object.
+       *
+       * @param topic_name_  Unique topic name.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool Create(const std::string& topic_name_)
+      {
+        return(eCAL::CSubscriber::Create(topic_name_, GetTopicInformation()));
+      }
+
+      /**
+       * @brief  Enable the verification of the received buffers (default: disabled).
+       *
+       *         The verifier touches the whole buffer, messages that fail the verification
+       *         are dropped and reported to the error callback. Set it before adding the callback.
+       *
+       * @param state_  Enable or disable the verification.
+      **/
+      void EnableVerification(bool state_)
+      {
+        m_verify = state_;
+      }
+
+      /**
+       * @brief eCAL flatbuffers message view callback function
+       *
+       * @param topic_name_  Topic name of the data source (publisher).
+       * @param msg_         Root table of the received buffer, only valid during the callback.
+       * @param time_        Message time stamp.
+       * @param clock_       Message writer clock.
+       * @param id_          Message id.
+      **/
+      typedef std::function<void(const char* topic_name_, const T* msg_, long long time_, long long clock_, long long id_)> ViewCallbackT;
+
+      /**
+       * @brief  Add receive callback for incoming messages.
+       *
+       * @param callback_  The callback function.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool AddReceiveCallback(ViewCallbackT callback_)
+      {
+        RemReceiveCallback();
+
+        m_view_callback = std::move(callback_);
+        return(BindReceiveCallback());
+      }
+
+      /**
+       * @brief  Remove receive callback for incoming messages.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool RemReceiveCallback()
+      {
+        if (m_view_callback == nullptr) return(false);
+        // no callback is running after the subscriber callback was removed
+        const bool success = eCAL::CSubscriber::RemReceiveCallback();
+        m_view_callback = nullptr;
+        return(success);
+      }
+
+      /**
+       * @brief Callback function in case a received buffer is dropped.
+       *
+       * @param error_  The error message string.
+      **/
+      typedef std::function<void(const std::string& error_)> ErrorCallbackT;
+
+      /**
+       * @brief  Add callback function in case a received buffer is dropped. Set it before adding the receive callback.
+       *
+       * @param callback_  The callback function to add.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool AddErrorCallback(ErrorCallbackT callback_)
+      {
+        m_error_callback = std::move(callback_);
+        return(true);
+      }
+
+      /**
+       * @brief  Remove callback function in case a received buffer is dropped.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool RemErrorCallback()
+      {
+        m_error_callback = nullptr;
+        return(true);
+      }
+
+    private:
+      /**
+      * @brief  Get topic information of the flatbuffers message.
+      *
+      * @return  Topic information.
+      **/
+      STopicInformation GetTopicInformation() const
+      {
+        STopicInformation topic_info;
+        topic_info.encoding = "flatb";
+        // empty type, empty descriptor
+        return topic_info;
+      }
+
+      bool BindReceiveCallback()
+      {
+        eCAL::CSubscriber::RemReceiveCallback();
+        auto callback = std::bind(&CViewSubscriber::OnReceive, this, std::placeholders::_1, std::placeholders::_2);
+        return(eCAL::CSubscriber::AddReceiveCallback(callback));
+      }
+
+      void OnReceive(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
+      {
+        if (m_view_callback == nullptr) return;
+
+        const size_t size = static_cast<size_t>(data_->size);
+        if (size < sizeof(::flatbuffers::uoffset_t))
+        {
+          OnError("CViewSubscriber: Received buffer is too small");
+          return;
+        }
+
+        // the transport layers deliver aligned buffers, copy the rare unaligned one
+        const uint8_t* buf = static_cast<const uint8_t*>(data_->buf);
+        if (reinterpret_cast<uintptr_t>(buf) % sizeof(uint64_t) != 0)
+        {
+          m_aligned_buffer.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+          std::memcpy(m_aligned_buffer.data(), buf, size);
+          buf = reinterpret_cast<const uint8_t*>(m_aligned_buffer.data());
+        }
+
+        if (m_verify)
+        {
+          ::flatbuffers::Verifier verifier(buf, size);
+          if (!verifier.VerifyBuffer<T>(nullptr))
+          {
+            OnError("CViewSubscriber: Received buffer failed the verification");
+            return;
+          }
+        }
+
+        m_view_callback(topic_name_, ::flatbuffers::GetRoot<T>(buf), data_->time, data_->clock, data_->id);
+      }
+
+      void OnError(const std::string& error_)
+      {
+        if (m_error_callback != nullptr) m_error_callback(error_);
+      }
+
+      bool                   m_verify = false;
+      ViewCallbackT          m_view_callback;
+      ErrorCallbackT         m_error_callback;
+      std::vector<uint64_t>  m_aligned_buffer;
+    };
+    /** @example monster_rec_view.cpp
+    * This is an example how to use eCAL::flatbuffers::CViewSubscriber to read google::flatbuffers data in place. To send the data, see @ref monster_snd.cpp .
+    */
+  }
+}
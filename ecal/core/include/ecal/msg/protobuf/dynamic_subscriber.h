@@ -27,7 +27,7 @@
 #include <exception>
 #include <sstream>
 #include <ecal/ecal.h>
-#include <ecal/protobuf/ecal_proto_dyn.h>
+#include <ecal/protobuf/ecal_proto_descriptor_cache.h>
 #include <ecal/msg/dynamic.h>
 
 #ifdef _MSC_VER
@@ -155,13 +155,13 @@ namespace eCAL
 
       std::shared_ptr<google::protobuf::Message> CreateMessagePointer(const std::string& topic_name_);
 
-      bool                                        created;
-      std::string                                 topic_name;
-      eCAL::protobuf::CProtoDynDecoder*           msg_decoder;
-      std::shared_ptr<google::protobuf::Message>  msg_ptr;
-      eCAL::CSubscriber                           msg_sub;
-      ProtoMsgCallbackT                           msg_callback;
-      ProtoErrorCallbackT                         err_callback;
+      bool                                              created;
+      std::string                                       topic_name;
+      std::shared_ptr<const google::protobuf::Message>  msg_prototype;  // shared with all subscribers of the same type, keeps the descriptors alive
+      std::shared_ptr<google::protobuf::Message>        msg_ptr;        // reused for all received messages
+      eCAL::CSubscriber                                 msg_sub;
+      ProtoMsgCallbackT                                 msg_callback;
+      ProtoErrorCallbackT                               err_callback;
 
     private:
       // this object must not be copied.
@@ -173,14 +173,12 @@ namespace eCAL
     **/
 
     inline CDynamicSubscriber::CDynamicSubscriber() :
-      created(false),
-      msg_decoder(nullptr)
+      created(false)
     {
     }
 
     inline CDynamicSubscriber::CDynamicSubscriber(const std::string& topic_name_) :
-      created(false),
-      msg_decoder(nullptr)
+      created(false)
     {
       Create(topic_name_);
     }
@@ -197,9 +195,6 @@ namespace eCAL
       // save the topic name (required for receive polling)
       topic_name = topic_name_;
 
-      // create message decoder
-      msg_decoder = new eCAL::protobuf::CProtoDynDecoder();
-
       // create subscriber
       msg_sub.Create(topic_name_);
 
@@ -213,11 +208,9 @@ namespace eCAL
       // destroy subscriber
       msg_sub.Destroy();
 
-      // delete message pointer
-      msg_ptr = nullptr;
-
-      // delete message decoder
-      delete msg_decoder;
+      // delete message pointer before its prototype
+      msg_ptr       = nullptr;
+      msg_prototype = nullptr;
 
       created = false;
     }
@@ -318,11 +311,10 @@ namespace eCAL
         throw DynamicReflectionException("CDynamicSubscriber: Could not get description for topic " + std::string(topic_name_));
       }
 
-      google::protobuf::FileDescriptorSet proto_desc;
-      proto_desc.ParseFromString(topic_desc);
+      // the descriptor is built only once for all dynamic subscribers of the process
       std::string error_s;
-      std::shared_ptr<google::protobuf::Message> proto_msg_ptr(msg_decoder->GetProtoMessageFromDescriptorSet(proto_desc, topic_type, error_s));
-      if (proto_msg_ptr == nullptr)
+      msg_prototype = GetCachedPrototype(topic_desc, topic_type, error_s);
+      if (msg_prototype == nullptr)
       {
         std::stringstream s;
         s << "CDynamicSubscriber: Message of type " + std::string(topic_name_) << " could not be decoded" << std::endl;
@@ -330,7 +322,7 @@ namespace eCAL
         throw DynamicReflectionException(s.str());
       }
 
-      return proto_msg_ptr;
+      return std::shared_ptr<google::protobuf::Message>(msg_prototype->New());
     }
   }
 }
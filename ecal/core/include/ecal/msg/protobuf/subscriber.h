@@ -31,6 +31,7 @@
 #ifdef _MSC_VER
 #pragma warning(push, 0) // disable proto warnings
 #endif
+#include <google/protobuf/arena.h>
 #include <google/protobuf/descriptor.pb.h>
 #ifdef _MSC_VER
 #pragma warning(pop)
@@ -40,11 +41,22 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
   namespace protobuf
   {
+    /**
+     * @brief  Allocation of the message objects passed to the receive callback.
+    **/
+    enum eMessageAllocation
+    {
+      message_allocation_new,    //!< a new message object for every sample, default value
+      message_allocation_reuse,  //!< one message object is reused, repeated and string fields keep their memory
+      message_allocation_arena,  //!< the message is created on an arena, its initial block is reused for the next sample
+    };
+
     /**
      * @brief  eCAL google::protobuf subscriber class.
      *
@@ -94,6 +106,14 @@ namespace eCAL
       **/
       CSubscriber& operator=(CSubscriber&&) = default;
 
+      /**
+       * @brief  Destructor, removes the receive callback before the message buffers are released.
+      **/
+      ~CSubscriber() override
+      {
+        this->RemReceiveCallback();
+      }
+
       /**
        * @brief  Creates this object.
        *
@@ -106,6 +126,92 @@ namespace eCAL
         return(CMsgSubscriber<T>::Create(topic_name_, GetTopicInformation()));
       }
 
+      /**
+       * @brief  Set the allocation of the message objects passed to the receive callback.
+       *
+       *         Reused and arena messages are only valid during the callback, they must
+       *         not be referenced afterwards. Set the allocation before adding the callback.
+       *
+       * @param allocation_  The message allocation.
+       *
+       * @return  True if it succeeds, false if a receive callback is set already.
+      **/
+      bool SetMessageAllocation(eMessageAllocation allocation_)
+      {
+        if (this->HasReceiveCallback()) return(false);
+        m_allocation = allocation_;
+        m_message.reset();
+        m_arena_block.clear();
+        m_arena_block.shrink_to_fit();
+        return(true);
+      }
+
+      /**
+       * @brief  Get the allocation of the message objects passed to the receive callback.
+       *
+       * @return  The message allocation.
+      **/
+      eMessageAllocation GetMessageAllocation() const
+      {
+        return(m_allocation);
+      }
+
+    protected:
+      /**
+       * @brief  Deserialize a received sample into the message object of the configured allocation.
+       *
+       * @param topic_name_  Topic name of the data source (publisher).
+       * @param data_        The received sample.
+      **/
+      void ReceiveMessage(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_) override
+      {
+        switch (m_allocation)
+        {
+        case message_allocation_reuse:
+        {
+          // ParseFromArray clears the message, but keeps the allocated repeated and string fields
+          if (!m_message) m_message.reset(new T());
+          if (Deserialize(*m_message, data_->buf, data_->size))
+          {
+            this->CallMessageCallback(topic_name_, *m_message, data_);
+          }
+          break;
+        }
+        case message_allocation_arena:
+        {
+          // protobuf needs some space of the initial block for the arena itself
+          if (m_arena_block.empty()) m_arena_block.resize(4096);
+
+          size_t space_allocated(0);
+          {
+            google::protobuf::ArenaOptions options;
+            options.initial_block      = m_arena_block.data();
+            options.initial_block_size = m_arena_block.size();
+            google::protobuf::Arena arena(options);
+
+            T* msg = google::protobuf::Arena::CreateMessage<T>(&arena);
+            if (Deserialize(*msg, data_->buf, data_->size))
+            {
+              this->CallMessageCallback(topic_name_, *msg, data_);
+            }
+            space_allocated = static_cast<size_t>(arena.SpaceAllocated());
+          }
+
+          // the arena needed additional blocks, so the next message gets a larger initial block
+          if (space_allocated > m_arena_block.size())
+          {
+            m_arena_block.resize(space_allocated);
+          }
+          break;
+        }
+        case message_allocation_new:
+        default:
+          CMsgSubscriber<T>::ReceiveMessage(topic_name_, data_);
+          break;
+        }
+      }
+
+
     private:
       /**
       * @brief  Get topic information of the protobuf message.
@@ -142,6 +248,9 @@ namespace eCAL
         return(false);
       }
 
+      eMessageAllocation  m_allocation = message_allocation_new;
+      std::unique_ptr<T>  m_message;
+      std::vector<char>   m_arena_block;
     };
     /** @example person_rec.cpp
     * This is an example how to use eCAL::CSubscriber to receive google::protobuf data with eCAL. To send the data, see @ref person_snd.cpp .
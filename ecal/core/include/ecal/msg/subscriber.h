@@ -177,7 +177,8 @@ namespace eCAL
     bool Receive(T& msg_, long long* time_ = nullptr, int rcv_timeout_ = 0) const
     {
       assert(IsCreated());
-      std::string rec_buf;
+      // the buffer is swapped with the receive buffer of the subscriber, so both keep their capacity
+      thread_local std::string rec_buf;
       bool success = CSubscriber::ReceiveBuffer(rec_buf, time_, rcv_timeout_);
       if (!success) return(false);
       return(Deserialize(msg_, rec_buf.c_str(), rec_buf.size()));
@@ -206,7 +207,7 @@ namespace eCAL
       assert(IsCreated());
       RemReceiveCallback();
 
-      m_cb_callback = callback_;
+      m_cb_callback = std::move(callback_);
       auto callback = std::bind(&CMsgSubscriber::ReceiveCallback, this, std::placeholders::_1, std::placeholders::_2);
       return(CSubscriber::AddReceiveCallback(callback));
     }
@@ -219,8 +220,10 @@ namespace eCAL
     bool RemReceiveCallback()
     {
       if (m_cb_callback == nullptr) return(false);
+      // no callback is running after the subscriber callback was removed
+      const bool success = CSubscriber::RemReceiveCallback();
       m_cb_callback = nullptr;
-      return(CSubscriber::RemReceiveCallback());
+      return(success);
     }
 
 protected:
@@ -241,20 +244,40 @@ protected:
     virtual STopicInformation GetTopicInformation() const { return STopicInformation{}; }
     virtual bool Deserialize(T& msg_, const void* buffer_, size_t size_) const = 0;
 
-  private:
-    void ReceiveCallback(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
+    /**
+     * @brief  Deserialize a received sample and pass it to the message callback.
+     *
+     *         A new message object is used for every sample, derived classes can
+     *         override this to reuse message objects.
+     *
+     * @param topic_name_  Topic name of the data source (publisher).
+     * @param data_        The received sample.
+    **/
+    virtual void ReceiveMessage(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
     {
-      MsgReceiveCallbackT fn_callback(m_cb_callback);
-
-      if(fn_callback == nullptr) return;
-
       T msg;
       if(Deserialize(msg, data_->buf, data_->size))
       {
-        (fn_callback)(topic_name_, msg, data_->time, data_->clock, data_->id);
+        CallMessageCallback(topic_name_, msg, data_);
       }
     }
 
+    void CallMessageCallback(const char* topic_name_, const T& msg_, const struct eCAL::SReceiveCallbackData* data_) const
+    {
+      (m_cb_callback)(topic_name_, msg_, data_->time, data_->clock, data_->id);
+    }
+
+    bool HasReceiveCallback() const { return(m_cb_callback != nullptr); }
+
+  private:
+    void ReceiveCallback(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
+    {
+      // the message callback is set before and reset after the subscriber callback,
+      // so it can be called without a copy
+      if(m_cb_callback == nullptr) return;
+      ReceiveMessage(topic_name_, data_);
+    }
+
     MsgReceiveCallbackT m_cb_callback;
   };
 }
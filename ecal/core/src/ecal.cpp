@@ -206,6 +206,17 @@ namespace eCAL
     return(g_globals()->IsInitialized(component_));
   }
 
+  /**
+   * @brief Get the startup time of the eCAL subsystems.
+   *
+   * @return  Subsystem names and their startup time in microseconds in order of creation.
+  **/
+  std::vector<std::pair<std::string, long long>> GetStartupTimes()
+  {
+    if (g_globals_ctx == nullptr) return({});
+    return(g_globals()->GetStartupTimes());
+  }
+
   /**
    * @brief  Set/change the unit name of current module.
    *
@@ -93,6 +93,7 @@ namespace eCAL
     ECAL_API std::string       GetLoadedEcalIniPath                 () { return g_default_ini_file; }
     ECAL_API int               GetRegistrationTimeoutMs             () { return eCALPAR(CMN, REGISTRATION_TO); }
     ECAL_API int               GetRegistrationRefreshMs             () { return eCALPAR(CMN, REGISTRATION_REFRESH); }
+    ECAL_API bool              IsRegistrationFastDiscoveryEnabled   () { return eCALPAR(CMN, REGISTRATION_FAST_DISCOVERY); }
 
     /////////////////////////////////////
     // network
@@ -139,6 +140,8 @@ namespace eCAL
     /////////////////////////////////////
     
     ECAL_API std::string       GetTimesyncModuleName                () { return eCALPAR(TIME, SYNC_MOD_RT); }
+    ECAL_API size_t            GetTimerThreadCount                  () { return static_cast<size_t>(eCALPAR(TIME, TIMER_THREADS)); }
+    ECAL_API bool              IsTimerHighPrecisionEnabled          () { return eCALPAR(TIME, TIMER_HIGH_PRECISION); }
 
     /////////////////////////////////////
     // process
@@ -156,6 +159,9 @@ namespace eCAL
     ECAL_API eCAL_Logging_Filter GetConsoleLogFilter                  () { return ParseLogLevel(eCALPAR(MON, LOG_FILTER_CON)); }
     ECAL_API eCAL_Logging_Filter GetFileLogFilter                     () { return ParseLogLevel(eCALPAR(MON, LOG_FILTER_FILE)); }
     ECAL_API eCAL_Logging_Filter GetUdpLogFilter                      () { return ParseLogLevel(eCALPAR(MON, LOG_FILTER_UDP)); }
+    ECAL_API bool                IsAsyncLoggingEnabled                () { return eCALPAR(MON, LOG_ASYNC); }
+    ECAL_API size_t              GetAsyncLoggingQueueSize             () { return static_cast<size_t>(eCALPAR(MON, LOG_ASYNC_QUEUE_SIZE)); }
+    ECAL_API bool                IsTopicStatisticsEnabled             () { return eCALPAR(MON, TOPIC_STATISTICS); }
 
     /////////////////////////////////////
     // sys
@@ -187,7 +193,9 @@ namespace eCAL
       ECAL_API bool              IsNetworkMonitoringDisabled        () { return eCALPAR(EXP, NETWORK_MONITORING_DISABLED); }
       ECAL_API size_t            GetShmMonitoringQueueSize          () { return static_cast<size_t>(eCALPAR(EXP, SHM_MONITORING_QUEUE_SIZE)); }
       ECAL_API std::string       GetShmMonitoringDomain             () { return eCALPAR(EXP, SHM_MONITORING_DOMAIN);}
+      ECAL_API int               GetShmMonitoringStatisticsRefreshMs() { return eCALPAR(EXP, SHM_MONITORING_STATISTICS_REFRESH); }
       ECAL_API bool              GetDropOutOfOrderMessages          () { return eCALPAR(EXP, DROP_OUT_OF_ORDER_MESSAGES); }
+      ECAL_API std::string       GetTraceFile                       () { return eCALPAR(EXP, TRACE_FILE); }
     }
   }
 }
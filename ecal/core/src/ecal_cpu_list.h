@@ -0,0 +1,100 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL cpu list parsing (e.g. "2,3" or "4-7")
+**/
+
+#pragma once
+
+#include <cctype>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+     * @brief Highest cpu number accepted in a cpu list.
+    **/
+    const int kMaxCpuListCpu = 1023;
+
+    /**
+     * @brief Parses a comma separated list of cpus and cpu ranges, e.g. "0,2-3".
+     *        Whitespace around the items is ignored.
+     *
+     * @param list_  The cpu list.
+     * @param cpus_  Receives the cpus of all valid items, in the order of the list.
+     *
+     * @return  False, if any item is invalid (not a number or range of numbers
+     *          in [0, kMaxCpuListCpu], or a range with first > last).
+    **/
+    inline bool ParseCpuList(const std::string& list_, std::vector<int>& cpus_)
+    {
+      cpus_.clear();
+
+      // parses a cpu number, the whole string has to be consumed
+      auto parse_cpu = [](const std::string& str_, int& cpu_)
+      {
+        const size_t begin = str_.find_first_not_of(" \t");
+        const size_t end   = str_.find_last_not_of(" \t");
+        if (begin == std::string::npos) return false;
+
+        int cpu(0);
+        for (size_t i = begin; i <= end; ++i)
+        {
+          if (std::isdigit(static_cast<unsigned char>(str_[i])) == 0) return false;
+          cpu = cpu * 10 + (str_[i] - '0');
+          if (cpu > kMaxCpuListCpu) return false;
+        }
+        cpu_ = cpu;
+        return true;
+      };
+
+      if (list_.find_first_not_of(" \t") == std::string::npos) return true;
+
+      bool valid(true);
+      size_t item_begin(0);
+      while (item_begin <= list_.size())
+      {
+        size_t item_end = list_.find(',', item_begin);
+        if (item_end == std::string::npos) item_end = list_.size();
+        const std::string item = list_.substr(item_begin, item_end - item_begin);
+        item_begin = item_end + 1;
+
+        int first(0);
+        int last(0);
+        const size_t dash = item.find('-');
+        if (dash == std::string::npos)
+        {
+          if (!parse_cpu(item, first)) { valid = false; continue; }
+          last = first;
+        }
+        else
+        {
+          if (!parse_cpu(item.substr(0, dash), first) || !parse_cpu(item.substr(dash + 1), last) || (first > last)) { valid = false; continue; }
+        }
+
+        for (int cpu = first; cpu <= last; ++cpu) cpus_.push_back(cpu);
+      }
+      return valid;
+    }
+  }
+}
@@ -52,6 +52,16 @@
 #define MON_LOG_FILTER_FILE                        ""
 #define MON_LOG_FILTER_UDP                         "info,warning,error,fatal"
 
+/* asynchronous logging, messages are queued per thread and written by a background thread */
+#define MON_LOG_ASYNC                              false
+/* number of messages per thread that can be queued before messages are dropped */
+#define MON_LOG_ASYNC_QUEUE_SIZE                   1024
+/* period of the asynchronous log flush thread in ms */
+#define MON_LOG_ASYNC_FLUSH_PERIOD                 10
+
+/* collect latency histograms and data rates of subscribers */
+#define MON_TOPIC_STATISTICS                       false
+
 
 /**********************************************************************************************/
 /*                                     sys settings                                       */
@@ -145,6 +155,11 @@
 #define TIME_SYNC_MOD_RT                              ""
 #define TIME_SYNC_MOD_REPLAY                          ""
 
+/* minimum number of worker threads executing the timer callbacks of the process */
+#define TIME_TIMER_THREADS                            1
+/* wait for the next timer tick with a timerfd (linux only) */
+#define TIME_TIMER_HIGH_PRECISION                     false
+
 /**********************************************************************************************/
 /*                                     process settings                                       */
 /**********************************************************************************************/
@@ -159,9 +174,23 @@
 /* time for resend registration info from publisher/subscriber in ms */
 #define CMN_REGISTRATION_REFRESH                    1000
 
+/* announce new publisher/subscriber immediately and answer new matching peers at once */
+#define CMN_REGISTRATION_FAST_DISCOVERY             false
+
+/* poll period of the shared memory registration layer in fast discovery mode in ms */
+#define CMN_REGISTRATION_FAST_SHM_POLL                 1
+
 /* delta time to check timeout for data readers in ms */
 #define CMN_DATAREADER_TIMEOUT_DTIME                  10
 
+/**********************************************************************************************/
+/*                                     threads                                                */
+/**********************************************************************************************/
+/* cpu list of a thread class (e.g. "2,3" or "4-7"), empty = inherit the process affinity */
+#define THREADS_AFFINITY                ""
+/* SCHED_FIFO priority of a thread class (1 - 99), 0 = default scheduling policy */
+#define THREADS_PRIORITY                0
+
 /**********************************************************************************************/
 /*                                     events                                                 */
 /**********************************************************************************************/
@@ -181,6 +210,13 @@
 #define EXP_SHM_MONITORING_DOMAIN                   "ecal_monitoring"
 /* memory file access timeout */
 #define EXP_MEMFILE_ACCESS_TIMEOUT                  100
+/* refresh cycle of the shared memory monitoring statistics (cpu load, data frequency, ..) if the registration state is unchanged [ms] */
+#define EXP_SHM_MONITORING_STATISTICS_REFRESH       5000
 
 /* enable dropping of payload messages that arrive out of order */
 #define EXP_DROP_OUT_OF_ORDER_MESSAGES              false
+
+/* base file name for the trace point export (requires ECAL_CORE_TRACING build option, empty = off) */
+#define EXP_TRACE_FILE                              ""
+/* number of trace point events kept per thread */
+#define EXP_TRACE_BUFFER_SIZE                       16384
@@ -29,6 +29,7 @@
 #define  CMN_SECTION_S                    "common"
 #define  CMN_REGISTRATION_TO_S            "registration_timeout"
 #define  CMN_REGISTRATION_REFRESH_S       "registration_refresh"
+#define  CMN_REGISTRATION_FAST_DISCOVERY_S "registration_fast_discovery"
 
 /////////////////////////////////////
 // network
@@ -67,6 +68,8 @@
 #define  TIME_SECTION_S                   "time"
 #define  TIME_SYNC_MOD_RT_S               "timesync_module_rt"
 #define  TIME_SYNC_MOD_REPLAY_S           "timesync_module_replay"
+#define  TIME_TIMER_THREADS_S             "timer_threads"
+#define  TIME_TIMER_HIGH_PRECISION_S      "timer_high_precision"
 
 /////////////////////////////////////
 // process
@@ -87,6 +90,11 @@
 #define  MON_LOG_FILTER_FILE_S            "filter_log_file"
 #define  MON_LOG_FILTER_UDP_S             "filter_log_udp"
 
+#define  MON_LOG_ASYNC_S                  "log_async"
+#define  MON_LOG_ASYNC_QUEUE_SIZE_S       "log_async_queue_size"
+
+#define  MON_TOPIC_STATISTICS_S           "topic_statistics"
+
 /////////////////////////////////////
 // sys
 /////////////////////////////////////
@@ -112,6 +120,15 @@
 #define  PUB_SHARE_TTYPE_S                "share_ttype"
 #define  PUB_SHARE_TDESC_S                "share_tdesc"
 
+/////////////////////////////////////
+// threads
+/////////////////////////////////////
+#define  THREADS_SECTION_S                "threads"
+
+// keys are prefixed by the thread class name (e.g. udp_receive_affinity)
+#define  THREADS_AFFINITY_S               "_affinity"
+#define  THREADS_PRIORITY_S               "_priority"
+
 /////////////////////////////////////
 // experimental
 /////////////////////////////////////
@@ -121,4 +138,6 @@
 #define  EXP_NETWORK_MONITORING_DISABLED_S   "network_monitoring_disabled"
 #define  EXP_SHM_MONITORING_QUEUE_SIZE_S     "shm_monitoring_queue_size"
 #define  EXP_SHM_MONITORING_DOMAIN_S         "shm_monitoring_domain"
+#define  EXP_SHM_MONITORING_STATISTICS_REFRESH_S "shm_monitoring_statistics_refresh"
 #define  EXP_DROP_OUT_OF_ORDER_MESSAGES_S    "drop_out_of_order_messages"
+#define  EXP_TRACE_FILE_S                    "trace_file"
@@ -98,6 +98,15 @@ namespace eCAL
         {
           return std::make_pair(it->first, it->second.first);
         };
+        // element access without copying the pair
+        const Key& key() const
+        {
+          return it->first;
+        };
+        T& value() const
+        {
+          return it->second.first;
+        };
         //friend void swap(iterator& lhs, iterator& rhs); //C++11 I think
         bool operator==(const iterator& rhs) const { return it == rhs.it; };
         bool operator!=(const iterator& rhs) const { return it != rhs.it; };
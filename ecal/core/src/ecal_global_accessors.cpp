@@ -69,7 +69,7 @@ namespace eCAL
   CLog* g_log()
   {
     if (!g_globals()) return(nullptr);
-    return(g_globals()->log().get());
+    return(g_globals()->log());
   }
 
   CMonitoring* g_monitoring()
@@ -81,7 +81,7 @@ namespace eCAL
   CTimeGate* g_timegate()
   {
     if (!g_globals()) return(nullptr);
-    return(g_globals()->timegate().get());
+    return(g_globals()->timegate());
   }
 
   CRegistrationProvider* g_registration_provider()
@@ -99,7 +99,7 @@ namespace eCAL
   CSubGate* g_subgate()
   {
     if (!g_globals()) return(nullptr);
-    return(g_globals()->subgate().get());
+    return(g_globals()->subgate());
   }
 
   CPubGate* g_pubgate()
@@ -111,7 +111,7 @@ namespace eCAL
   CServiceGate* g_servicegate()
   {
     if (!g_globals()) return(nullptr);
-    return(g_globals()->servicegate().get());
+    return(g_globals()->servicegate());
   }
 
   CClientGate* g_clientgate()
@@ -129,7 +129,7 @@ namespace eCAL
   CMemFileThreadPool* g_memfile_pool()
   {
     if (!g_globals()) return(nullptr);
-    return(g_globals()->memfile_pool().get());
+    return(g_globals()->memfile_pool());
   }
 
   CMemFileMap* g_memfile_map()
@@ -137,4 +137,34 @@ namespace eCAL
     if (!g_globals()) return(nullptr);
     return(g_globals()->memfile_map().get());
   }
+
+  CLog* g_ensure_log()
+  {
+    if (!g_globals()) return(nullptr);
+    return(g_globals()->ensure_log());
+  }
+
+  CTimeGate* g_ensure_timegate()
+  {
+    if (!g_globals()) return(nullptr);
+    return(g_globals()->ensure_timegate());
+  }
+
+  CSubGate* g_ensure_subgate()
+  {
+    if (!g_globals()) return(nullptr);
+    return(g_globals()->ensure_subgate());
+  }
+
+  CServiceGate* g_ensure_servicegate()
+  {
+    if (!g_globals()) return(nullptr);
+    return(g_globals()->ensure_servicegate());
+  }
+
+  CMemFileThreadPool* g_ensure_memfile_pool()
+  {
+    if (!g_globals()) return(nullptr);
+    return(g_globals()->ensure_memfile_pool());
+  }
 }
@@ -62,6 +62,13 @@ namespace eCAL
   CMemFileThreadPool*     g_memfile_pool();
   CMemFileMap*            g_memfile_map();
 
+  // Declaration of getter functions, that create the instance on first use
+  CLog*                   g_ensure_log();
+  CTimeGate*              g_ensure_timegate();
+  CSubGate*               g_ensure_subgate();
+  CServiceGate*           g_ensure_servicegate();
+  CMemFileThreadPool*     g_ensure_memfile_pool();
+
   // declaration of globally accessible variables
   extern CGlobals*                     g_globals_ctx;
   extern std::atomic<int>              g_globals_ctx_ref_cnt;
@@ -24,12 +24,14 @@
 #include "ecal_globals.h"
 #include "io/udp_init.h"
 #include "ecal_config_reader.h"
+#include "ecal_trace.h"
 
+#include <functional>
 #include <stdexcept>
 
 namespace eCAL
 {
-  CGlobals::CGlobals() : initialized(false), components(0)
+  CGlobals::CGlobals() : initialized(false), components(0), log_ptr(nullptr), timegate_ptr(nullptr), subgate_ptr(nullptr), servicegate_ptr(nullptr), memfile_pool_ptr(nullptr)
   {}
 
   CGlobals::~CGlobals()
@@ -40,7 +42,9 @@ namespace eCAL
   int CGlobals::Initialize(unsigned int components_, std::vector<std::string>* config_keys_ /*= nullptr*/)
   {
     // will be set if any new module was initialized
-    bool new_initialization(false);
+    bool new_initialization((components_ & ~components) != 0);
+
+    const TimePointT init_start = std::chrono::steady_clock::now();
 
     // this is needed here for functions like "GetHostName" on windows
     Net::Initialize();
@@ -72,6 +76,7 @@ namespace eCAL
         throw std::runtime_error(emsg.c_str());
       }
 
+      AddStartupTime("config", init_start);
       new_initialization = true;
     }
 
@@ -111,27 +116,6 @@ namespace eCAL
       new_initialization = true;
     }
 
-    /////////////////////
-    // MEMFILE POOL
-    /////////////////////
-    if(memfile_pool_instance == nullptr) 
-    {
-      memfile_pool_instance = std::make_unique<CMemFileThreadPool>();
-      new_initialization = true;
-    }
-
-    /////////////////////
-    // SUBSCRIBER GATE
-    /////////////////////
-    if (components_ & Init::Subscriber)
-    {
-      if (subgate_instance == nullptr)
-      {
-        subgate_instance = std::make_unique<CSubGate>();
-        new_initialization = true;
-      }
-    }
-
     /////////////////////
     // PUBLISHER GATE
     /////////////////////
@@ -144,20 +128,12 @@ namespace eCAL
       }
     }
 
+    /////////////////////
+    // CLIENT GATE
+    /////////////////////
+    // the client gate collects the service registrations, so it is created at once
     if (components_ & Init::Service)
     {
-      /////////////////////
-      // SERVICE GATE
-      /////////////////////
-      if (servicegate_instance == nullptr)
-      {
-        servicegate_instance = std::make_unique<CServiceGate>();
-        new_initialization = true;
-      }
-
-      /////////////////////
-      // CLIENT GATE
-      /////////////////////
       if (clientgate_instance == nullptr)
       {
         clientgate_instance = std::make_unique<CClientGate>();
@@ -165,18 +141,6 @@ namespace eCAL
       }
     }
 
-    /////////////////////
-    // TIMEGATE
-    /////////////////////
-    if (components_ & Init::TimeSync)
-    {
-      if (timegate_instance == nullptr)
-      {
-        timegate_instance = std::make_unique<CTimeGate>();
-        new_initialization = true;
-      }
-    }
-
     /////////////////////
     // MONITORING
     /////////////////////
@@ -190,35 +154,31 @@ namespace eCAL
     }
 
     /////////////////////
-    // LOGGING
+    // CREATE ALL
     /////////////////////
-    if (components_ & Init::Logging)
+    // the memory file pool, the subscriber and service gate, the timegate and the logging
+    // are created on their first use (see ensure_xxx functions)
+    auto create = [this](const char* name_, std::function<void()> create_)
     {
-      if (log_instance == nullptr)
-      {
-        log_instance = std::make_unique<CLog>();
-        new_initialization = true;
-      }
+      const TimePointT start = std::chrono::steady_clock::now();
+      create_();
+      AddStartupTime(name_, start);
+    };
+    //if (config_instance)                                          config_instance->Create();
+    if (registration_provider_instance)                           create("registration_provider", [&] { registration_provider_instance->Create(true, true, (components_ & Init::ProcessReg) != 0x0); });
+    if (descgate_instance)                                        create("descgate",              [&] { descgate_instance->Create(); });
+    if (registration_receiver_instance)                           create("registration_receiver", [&] { registration_receiver_instance->Create(); });
+    if (pubgate_instance && (components_ & Init::Publisher))      create("pubgate",               [&] { pubgate_instance->Create(); });
+    if (clientgate_instance && (components_ & Init::Service))     create("clientgate",            [&] { clientgate_instance->Create(); });
+    if (monitoring_instance && (components_ & Init::Monitoring))  create("monitoring",            [&] { monitoring_instance->Create(); });
+
+    {
+      const std::lock_guard<std::recursive_mutex> lock(lazy_sync);
+      initialized =  true;
+      components  |= components_;
     }
 
-    /////////////////////
-    // CREATE ALL
-    /////////////////////
-    //if (config_instance)                                          config_instance->Create();
-    if (log_instance && (components_ & Init::Logging))            log_instance->Create();
-    if (registration_provider_instance)                           registration_provider_instance->Create(true, true, (components_ & Init::ProcessReg) != 0x0);
-    if (descgate_instance)                                        descgate_instance->Create();
-    if (registration_receiver_instance)                           registration_receiver_instance->Create();
-    if (memfile_pool_instance)                                    memfile_pool_instance->Create();
-    if (subgate_instance && (components_ & Init::Subscriber))     subgate_instance->Create();
-    if (pubgate_instance && (components_ & Init::Publisher))      pubgate_instance->Create();
-    if (servicegate_instance && (components_ & Init::Service))    servicegate_instance->Create();
-    if (clientgate_instance && (components_ & Init::Service))     clientgate_instance->Create();
-    if (timegate_instance && (components_ & Init::TimeSync))      timegate_instance->Create(CTimeGate::eTimeSyncMode::realtime);
-    if (monitoring_instance && (components_ & Init::Monitoring))  monitoring_instance->Create();
-
-    initialized =  true;
-    components  |= components_;
+    AddStartupTime("initialize", init_start);
 
     if (new_initialization) return 0;
     else                    return 1;
@@ -233,29 +193,113 @@ namespace eCAL
     }
 
     // check single component initialization
+    // (lazily created subsystems are initialized as soon as they are requested)
     switch (component_)
     {
     case Init::Publisher:
       return(pubgate_instance != nullptr);
     case Init::Subscriber:
-      return(subgate_instance != nullptr);
     case Init::Service:
-      return(servicegate_instance != nullptr);
-    case Init::Monitoring:
-      return(monitoring_instance != nullptr);
     case Init::Logging:
-      return(log_instance != nullptr);
     case Init::TimeSync:
-      return(timegate_instance != nullptr);
+      return((components & component_) != 0);
+    case Init::Monitoring:
+      return(monitoring_instance != nullptr);
     default:
       return(0);
     }
   }
 
+  template <typename T, typename CreateT>
+  T* CGlobals::EnsureInstance(std::unique_ptr<T>& instance_, std::atomic<T*>& ptr_, unsigned int component_, const char* name_, CreateT create_)
+  {
+    T* ptr = ptr_.load(std::memory_order_acquire);
+    if (ptr != nullptr) return(ptr);
+
+    // not (or no longer) available, no need to serialize on the lazy creation lock
+    if (!initialized.load(std::memory_order_acquire)) return(nullptr);
+    if ((component_ != 0) && ((components.load(std::memory_order_acquire) & component_) == 0)) return(nullptr);
+
+    const std::lock_guard<std::recursive_mutex> lock(lazy_sync);
+    if (!initialized) return(nullptr);
+    if ((component_ != 0) && ((components & component_) == 0)) return(nullptr);
+
+    // created meanwhile by another thread (or by a nested call during creation)
+    if (instance_ != nullptr) return(instance_.get());
+
+    const TimePointT start = std::chrono::steady_clock::now();
+    instance_ = std::make_unique<T>();
+    create_(*instance_);
+    AddStartupTime(name_, start);
+
+    ptr_.store(instance_.get(), std::memory_order_release);
+    return(instance_.get());
+  }
+
+  CLog* CGlobals::ensure_log()
+  {
+    return(EnsureInstance(log_instance, log_ptr, Init::Logging, "log", [](CLog& log_) { log_.Create(); }));
+  }
+
+  CTimeGate* CGlobals::ensure_timegate()
+  {
+    return(EnsureInstance(timegate_instance, timegate_ptr, Init::TimeSync, "timegate", [](CTimeGate& timegate_) { timegate_.Create(CTimeGate::eTimeSyncMode::realtime); }));
+  }
+
+  CSubGate* CGlobals::ensure_subgate()
+  {
+    return(EnsureInstance(subgate_instance, subgate_ptr, Init::Subscriber, "subgate", [](CSubGate& subgate_) { subgate_.Create(); }));
+  }
+
+  CServiceGate* CGlobals::ensure_servicegate()
+  {
+    return(EnsureInstance(servicegate_instance, servicegate_ptr, Init::Service, "servicegate", [](CServiceGate& servicegate_) { servicegate_.Create(); }));
+  }
+
+  CMemFileThreadPool* CGlobals::ensure_memfile_pool()
+  {
+    return(EnsureInstance(memfile_pool_instance, memfile_pool_ptr, 0, "memfile_pool", [](CMemFileThreadPool& memfile_pool_) { memfile_pool_.Create(); }));
+  }
+
+  std::vector<std::pair<std::string, long long>> CGlobals::GetStartupTimes()
+  {
+    const std::lock_guard<std::mutex> lock(startup_times_sync);
+    return(startup_times);
+  }
+
+  void CGlobals::AddStartupTime(const std::string& name_, TimePointT start_)
+  {
+    const long long duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_).count();
+    const std::lock_guard<std::mutex> lock(startup_times_sync);
+
+    // subsystems are created once, further Initialize calls only add their components
+    for (const auto& startup_time : startup_times)
+    {
+      if (startup_time.first == name_) return;
+    }
+    startup_times.emplace_back(name_, duration);
+  }
+
   int CGlobals::Finalize(unsigned int /*components_*/)
   {
     if (!initialized) return(1);
 
+#ifdef ECAL_CORE_TRACING
+    // write the trace point events, as long as the configuration is available
+    Trace::ExportConfigured();
+#endif
+
+    // no more lazy creations from now on
+    {
+      const std::lock_guard<std::recursive_mutex> lock(lazy_sync);
+      initialized = false;
+      log_ptr          = nullptr;
+      timegate_ptr     = nullptr;
+      subgate_ptr      = nullptr;
+      servicegate_ptr  = nullptr;
+      memfile_pool_ptr = nullptr;
+    }
+
     // start destruction
     if (monitoring_instance)             monitoring_instance->Destroy();
     if (timegate_instance)               timegate_instance->Destroy();
@@ -287,7 +331,10 @@ namespace eCAL
     // last not least we close all
     Net::Finalize();
 
-    initialized = false;
+    {
+      const std::lock_guard<std::mutex> lock(startup_times_sync);
+      startup_times.clear();
+    }
 
     return(0);
   }
@@ -37,7 +37,13 @@
 #include "io/ecal_memfile_pool.h"
 #include "io/ecal_memfile_db.h"
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace eCAL
 {
@@ -55,22 +61,39 @@ namespace eCAL
     int Finalize(unsigned int components_);
 
     const std::unique_ptr<CConfig>&                                       config()                 { return config_instance; };
-    const std::unique_ptr<CLog>&                                          log()                    { return log_instance; };
+    CLog*                                                                 log()                    { return log_ptr.load(std::memory_order_acquire); };
     const std::unique_ptr<CMonitoring>&                                   monitoring()             { return monitoring_instance; };
-    const std::unique_ptr<CTimeGate>&                                     timegate()               { return timegate_instance; };
-    const std::unique_ptr<CSubGate>&                                      subgate()                { return subgate_instance; };
+    CTimeGate*                                                            timegate()               { return timegate_ptr.load(std::memory_order_acquire); };
+    CSubGate*                                                             subgate()                { return subgate_ptr.load(std::memory_order_acquire); };
     const std::unique_ptr<CPubGate>&                                      pubgate()                { return pubgate_instance; };
-    const std::unique_ptr<CServiceGate>&                                  servicegate()            { return servicegate_instance; };
+    CServiceGate*                                                         servicegate()            { return servicegate_ptr.load(std::memory_order_acquire); };
     const std::unique_ptr<CClientGate>&                                   clientgate()             { return clientgate_instance; };
     const std::unique_ptr<CRegistrationProvider>&                         registration_provider()  { return registration_provider_instance; };
     const std::unique_ptr<CDescGate>&                                     descgate()               { return descgate_instance; };
     const std::unique_ptr<CRegistrationReceiver>&                         registration_receiver()  { return registration_receiver_instance; };
-    const std::unique_ptr<CMemFileThreadPool>&                            memfile_pool()           { return memfile_pool_instance; };
+    CMemFileThreadPool*                                                   memfile_pool()           { return memfile_pool_ptr.load(std::memory_order_acquire); };
     const std::unique_ptr<CMemFileMap>&                                   memfile_map()            { return memfile_map_instance; };
 
+    // subsystems that are not needed by every process are created on their first use,
+    // these functions return nullptr if the related component is not initialized
+    CLog*                                                                 ensure_log();
+    CTimeGate*                                                            ensure_timegate();
+    CSubGate*                                                             ensure_subgate();
+    CServiceGate*                                                         ensure_servicegate();
+    CMemFileThreadPool*                                                   ensure_memfile_pool();
+
+    // subsystem names and their creation time in microseconds
+    std::vector<std::pair<std::string, long long>> GetStartupTimes();
+
   private:
-    bool                                                                  initialized;
-    unsigned int                                                          components;
+    typedef std::chrono::steady_clock::time_point                         TimePointT;
+    void AddStartupTime(const std::string& name_, TimePointT start_);
+
+    template <typename T, typename CreateT>
+    T* EnsureInstance(std::unique_ptr<T>& instance_, std::atomic<T*>& ptr_, unsigned int component_, const char* name_, CreateT create_);
+
+    std::atomic<bool>                                                     initialized;
+    std::atomic<unsigned int>                                             components;
     std::unique_ptr<CConfig>                                              config_instance;
     std::unique_ptr<CLog>                                                 log_instance;
     std::unique_ptr<CMonitoring>                                          monitoring_instance;
@@ -84,5 +107,18 @@ namespace eCAL
     std::unique_ptr<CRegistrationReceiver>                                registration_receiver_instance;
     std::unique_ptr<CMemFileThreadPool>                                   memfile_pool_instance;
     std::unique_ptr<CMemFileMap>                                          memfile_map_instance;
+
+    // published instances of the lazily created subsystems
+    std::atomic<CLog*>                                                    log_ptr;
+    std::atomic<CTimeGate*>                                               timegate_ptr;
+    std::atomic<CSubGate*>                                                subgate_ptr;
+    std::atomic<CServiceGate*>                                            servicegate_ptr;
+    std::atomic<CMemFileThreadPool*>                                      memfile_pool_ptr;
+
+    // subsystems may use each other during their creation
+    std::recursive_mutex                                                  lazy_sync;
+
+    std::mutex                                                            startup_times_sync;
+    std::vector<std::pair<std::string, long long>>                        startup_times;
   };
 }
@@ -39,7 +39,8 @@ namespace eCAL
     **/
     void SetLogLevel(const eCAL_Logging_eLogLevel level_)
     {
-      if(g_log()) g_log()->SetLogLevel(level_);
+      CLog* log = g_ensure_log();
+      if(log) log->SetLogLevel(level_);
     }
 
     /**
@@ -49,8 +50,9 @@ namespace eCAL
     **/
     eCAL_Logging_eLogLevel GetLogLevel()
     {
-      if(g_log()) return(g_log()->GetLogLevel());
-      else        return(log_level_none);
+      CLog* log = g_ensure_log();
+      if(log) return(log->GetLogLevel());
+      else    return(log_level_none);
     }
 
     /**
@@ -60,7 +62,8 @@ namespace eCAL
     **/
     void Log(const std::string& msg_)
     {
-      if(g_log()) g_log()->Log(msg_);
+      CLog* log = g_ensure_log();
+      if(log) log->Log(msg_);
     }
 
     /**
@@ -68,7 +71,8 @@ namespace eCAL
     **/
     void StartCoreTimer()
     {
-      if(g_log()) g_log()->StartCoreTimer();
+      CLog* log = g_ensure_log();
+      if(log) log->StartCoreTimer();
     }
 
     /**
@@ -76,7 +80,8 @@ namespace eCAL
     **/
     void StopCoreTimer()
     {
-      if(g_log()) g_log()->StopCoreTimer();
+      CLog* log = g_ensure_log();
+      if(log) log->StopCoreTimer();
     }
 
     /**
@@ -84,7 +89,8 @@ namespace eCAL
     **/
     void SetCoreTime(const double time_)
     {
-      if(g_log()) g_log()->SetCoreTime(std::chrono::duration<double>(time_));
+      CLog* log = g_ensure_log();
+      if(log) log->SetCoreTime(std::chrono::duration<double>(time_));
     }
 
     /**
@@ -92,14 +98,24 @@ namespace eCAL
     **/
     double GetCoreTime()
     {
-      if(g_log())
+      CLog* log = g_ensure_log();
+      if(log)
       {
-        return(g_log()->GetCoreTime().count());
+        return(log->GetCoreTime().count());
       }
       else
       {
         return(0.0);
       }
     }
+
+    /**
+     * @brief Returns the number of log messages dropped, because the asynchronous log queue was full.
+    **/
+    unsigned long long GetDroppedMessages()
+    {
+      if(g_log()) return(g_log()->GetDroppedMessages());
+      else        return(0);
+    }
   }
 }
@@ -41,14 +41,7 @@
 #include <iomanip>
 #include <ctime>
 #include <chrono>
-
-#ifdef _MSC_VER
-#pragma warning(push, 0) // disable proto warnings
-#endif
-#include <ecal/core/pb/monitoring.pb.h>
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
+#include <algorithm>
 
 #ifdef ECAL_OS_WINDOWS
 #include "ecal_win_main.h"
@@ -103,16 +96,147 @@ static std::string get_time_str()
 }
 #endif
 
+namespace
+{
+  const char* get_level_str(const eCAL_Logging_eLogLevel level_)
+  {
+    switch (level_)
+    {
+    case log_level_info:
+      return "info";
+    case log_level_warning:
+      return "warning";
+    case log_level_error:
+      return "error";
+    case log_level_fatal:
+      return "fatal";
+    case log_level_debug1:
+      return "debug1";
+    case log_level_debug2:
+      return "debug2";
+    case log_level_debug3:
+      return "debug3";
+    case log_level_debug4:
+      return "debug4";
+    case log_level_none:
+    case log_level_all:
+    default:
+      return "";
+    }
+  }
+
+  std::atomic<unsigned long long> g_log_instance_counter(0);
+}
+
 namespace eCAL
 {
+  ////////////////////////////////////////
+  // CLogRing
+  ////////////////////////////////////////
+
+  // Single producer / single consumer ring buffer of log entries. Every thread
+  // that logs in asynchronous mode owns one ring and is the only producer, the
+  // flush thread is the only consumer. The message strings of the slots are
+  // reused, so logging does not allocate once a slot has seen a long message.
+  class CLogRing
+  {
+  public:
+    struct SSlot
+    {
+      SSlot() : level(log_level_none) {}
+      eCAL_Logging_eLogLevel             level;
+      eCAL::Time::ecal_clock::time_point time;
+      std::string                        msg;
+    };
+
+    explicit CLogRing(size_t size_) : m_write_idx(0), m_read_idx(0), m_dropped(0)
+    {
+      // round up to a power of 2, so the index can be masked
+      size_t size(1);
+      while (size < std::max<size_t>(size_, 2)) size <<= 1;
+      m_slots.resize(size);
+      m_mask = size - 1;
+    }
+
+    bool Push(const eCAL_Logging_eLogLevel level_, const eCAL::Time::ecal_clock::time_point& time_, const std::string& msg_)
+    {
+      const size_t write_idx = m_write_idx.load(std::memory_order_relaxed);
+      if (write_idx - m_read_idx.load(std::memory_order_acquire) > m_mask)
+      {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+
+      SSlot& slot = m_slots[write_idx & m_mask];
+      slot.level = level_;
+      slot.time  = time_;
+      slot.msg.assign(msg_);
+
+      m_write_idx.store(write_idx + 1, std::memory_order_release);
+      return true;
+    }
+
+    template <typename F>
+    size_t Pop(F func_)
+    {
+      const size_t read_idx  = m_read_idx.load(std::memory_order_relaxed);
+      const size_t write_idx = m_write_idx.load(std::memory_order_acquire);
+      for (size_t idx = read_idx; idx != write_idx; ++idx)
+      {
+        func_(m_slots[idx & m_mask]);
+      }
+      m_read_idx.store(write_idx, std::memory_order_release);
+      return(write_idx - read_idx);
+    }
+
+    bool IsEmpty() const
+    {
+      return(m_write_idx.load(std::memory_order_acquire) == m_read_idx.load(std::memory_order_acquire));
+    }
+
+    unsigned long long GetDropped() const
+    {
+      return(m_dropped.load(std::memory_order_relaxed));
+    }
+
+  private:
+    std::vector<SSlot>               m_slots;
+    size_t                           m_mask;
+
+    alignas(64) std::atomic<size_t>  m_write_idx;
+    alignas(64) std::atomic<size_t>  m_read_idx;
+    alignas(64) std::atomic<unsigned long long> m_dropped;
+  };
+
+  namespace
+  {
+    // the ring of the calling thread, bound to the CLog instance that created it
+    struct SThreadRing
+    {
+      SThreadRing() : instance_id(0) {}
+      unsigned long long        instance_id;
+      std::shared_ptr<CLogRing> ring;
+    };
+    thread_local SThreadRing g_thread_ring;
+  }
+
+  ////////////////////////////////////////
+  // CLog
+  ////////////////////////////////////////
+
   CLog::CLog() :
           m_created(false),
+          m_async(false),
+          m_async_queue_size(0),
+          m_instance_id(++g_log_instance_counter),
           m_pid(0),
           m_logfile(nullptr),
           m_level(log_level_none),
           m_filter_mask_con(log_level_info | log_level_warning | log_level_error | log_level_fatal),
           m_filter_mask_file(log_level_info | log_level_warning | log_level_error | log_level_fatal | log_level_debug1 | log_level_debug2),
           m_filter_mask_udp(log_level_info | log_level_warning | log_level_error | log_level_fatal | log_level_debug1 | log_level_debug2),
+          m_dropped_removed_rings(0),
+          m_dropped_reported(0),
           m_core_time_start(std::chrono::nanoseconds(0))
   {
     m_core_time = std::chrono::duration<double>(-1.0);
@@ -163,12 +287,28 @@ namespace eCAL
       m_udp_sender = std::make_unique<CUDPSender>(attr);
     }
 
+    // start the flush thread for asynchronous logging
+    m_async            = Config::IsAsyncLoggingEnabled();
+    m_async_queue_size = Config::GetAsyncLoggingQueueSize();
+    if(m_async)
+    {
+      m_flush_thread.Start(MON_LOG_ASYNC_FLUSH_PERIOD, std::bind(&CLog::FlushAsync, this));
+    }
+
     m_created = true;
   }
 
   void CLog::Destroy()
   {
     if(!m_created) return;
+    m_created = false;
+
+    // stop the flush thread and write everything that is left
+    if(m_async)
+    {
+      m_flush_thread.Stop();
+      FlushAsync();
+    }
 
     const std::lock_guard<std::mutex> lock(m_log_sync);
 
@@ -176,26 +316,20 @@ namespace eCAL
 
     if(m_logfile != nullptr) fclose(m_logfile);
     m_logfile = nullptr;
-
-    m_created = false;
   }
 
   void CLog::SetLogLevel(const eCAL_Logging_eLogLevel level_)
   {
-    const std::lock_guard<std::mutex> lock(m_log_sync);
     m_level = level_;
   }
 
   eCAL_Logging_eLogLevel CLog::GetLogLevel()
   {
-    const std::lock_guard<std::mutex> lock(m_log_sync);
     return(m_level);
   }
 
   void CLog::Log(const eCAL_Logging_eLogLevel level_, const std::string& msg_)
   {
-    const std::lock_guard<std::mutex> lock(m_log_sync);
-
     if(!m_created) return;
     if(msg_.empty()) return;
 
@@ -204,81 +338,25 @@ namespace eCAL
     const eCAL_Logging_Filter log_udp  = level_ & m_filter_mask_udp;
     if((log_con | log_file | log_udp) == 0) return;
 
-    static eCAL::pb::LogMessage ecal_msg;
-    static std::string        ecal_msg_s;
-    auto                      log_time = eCAL::Time::ecal_clock::now();
-
-    if(log_con != 0)
+    // asynchronous mode, hand the message over to the flush thread
+    if(m_async)
     {
-      std::cout << msg_ << std::endl;
-    }
-
-    if((log_file != 0) && (m_logfile != nullptr))
-    {
-      std::stringstream msg_stream;
-      msg_stream << std::chrono::duration_cast<std::chrono::milliseconds>(log_time.time_since_epoch()).count();
-      msg_stream << " ms";
-      msg_stream << " | ";
-      msg_stream << m_hname;
-      msg_stream << " | ";
-      msg_stream << eCAL::Process::GetUnitName();
-      msg_stream << " | ";
-      msg_stream << m_pid;
-      msg_stream << " | ";
-      switch(level_)
+      CLogRing* ring = GetThreadRing();
+      if(ring->Push(level_, eCAL::Time::ecal_clock::now(), msg_) && (level_ == log_level_fatal))
       {
-      case log_level_none:
-      case log_level_all:
-        break;
-      case log_level_info:
-        msg_stream << "info";
-        break;
-      case log_level_warning:
-        msg_stream << "warning";
-        break;
-      case log_level_error:
-        msg_stream << "error";
-        break;
-      case log_level_fatal:
-        msg_stream << "fatal";
-        break;
-      case log_level_debug1:
-        msg_stream << "debug1";
-        break;
-      case log_level_debug2:
-        msg_stream << "debug2";
-        break;
-      case log_level_debug3:
-        msg_stream << "debug3";
-        break;
-      case log_level_debug4:
-        msg_stream << "debug4";
-        break;
+        // fatal messages should not wait for the next flush period
+        m_flush_thread.Fire();
       }
-      msg_stream << " | ";
-      msg_stream << msg_;
-
-      fprintf(m_logfile, "%s\n", msg_stream.str().c_str());
-      fflush(m_logfile);
+      return;
     }
 
-    if((log_udp != 0) && m_udp_sender)
-    {
-      ecal_msg.Clear();
-      ecal_msg.set_time(std::chrono::duration_cast<std::chrono::microseconds>(log_time.time_since_epoch()).count());
-      ecal_msg.set_hname(m_hname);
-      ecal_msg.set_pid(m_pid);
-      ecal_msg.set_pname(m_pname);
-      ecal_msg.set_uname(eCAL::Process::GetUnitName());
-      ecal_msg.set_level(level_);
-      ecal_msg.set_content(msg_);
-
-      ecal_msg_s = ecal_msg.SerializeAsString();
-      if(!ecal_msg_s.empty())
-      {
-        m_udp_sender->Send((void*)ecal_msg_s.data(), ecal_msg_s.size());
-      }
-    }
+    const std::lock_guard<std::mutex> lock(m_log_sync);
+
+    SLogEntry entry;
+    entry.level = level_;
+    entry.time  = eCAL::Time::ecal_clock::now();
+    entry.msg   = msg_;
+    WriteLog(&entry, 1);
   }
 
   void CLog::Log(const std::string& msg_)
@@ -313,4 +391,162 @@ namespace eCAL
 
     return(m_core_time);
   }
+
+  unsigned long long CLog::GetDroppedMessages()
+  {
+    const std::lock_guard<std::mutex> lock(m_rings_sync);
+
+    unsigned long long dropped = m_dropped_removed_rings;
+    for (const auto& ring : m_rings)
+    {
+      dropped += ring->GetDropped();
+    }
+    return(dropped);
+  }
+
+  CLogRing* CLog::GetThreadRing()
+  {
+    // the first message of a thread creates and registers its ring
+    if(g_thread_ring.instance_id != m_instance_id)
+    {
+      auto ring = std::make_shared<CLogRing>(m_async_queue_size);
+      {
+        const std::lock_guard<std::mutex> lock(m_rings_sync);
+        m_rings.push_back(ring);
+      }
+      g_thread_ring.instance_id = m_instance_id;
+      g_thread_ring.ring        = std::move(ring);
+    }
+    return(g_thread_ring.ring.get());
+  }
+
+  int CLog::FlushAsync()
+  {
+    const std::lock_guard<std::mutex> lock(m_log_sync);
+
+    size_t             count(0);
+    unsigned long long dropped(0);
+    {
+      const std::lock_guard<std::mutex> rings_lock(m_rings_sync);
+
+      auto collect_entry = [this, &count](const CLogRing::SSlot& slot_)
+      {
+        if(m_flush_batch.size() <= count) m_flush_batch.resize(count + 1);
+        SLogEntry& entry = m_flush_batch[count++];
+        entry.level = slot_.level;
+        entry.time  = slot_.time;
+        entry.msg.assign(slot_.msg);
+      };
+
+      for (auto ring_it = m_rings.begin(); ring_it != m_rings.end();)
+      {
+        (*ring_it)->Pop(collect_entry);
+
+        // the thread of this ring has terminated, no one can push anymore
+        if(ring_it->use_count() == 1 && (*ring_it)->IsEmpty())
+        {
+          m_dropped_removed_rings += (*ring_it)->GetDropped();
+          ring_it = m_rings.erase(ring_it);
+        }
+        else
+        {
+          dropped += (*ring_it)->GetDropped();
+          ++ring_it;
+        }
+      }
+      dropped += m_dropped_removed_rings;
+    }
+
+    // report dropped messages once per flush
+    if(dropped > m_dropped_reported)
+    {
+      if(m_flush_batch.size() <= count) m_flush_batch.resize(count + 1);
+      SLogEntry& entry = m_flush_batch[count++];
+      entry.level = log_level_warning;
+      entry.time  = eCAL::Time::ecal_clock::now();
+      entry.msg   = "eCAL logging: " + std::to_string(dropped - m_dropped_reported) + " messages dropped, asynchronous log queue is full";
+      m_dropped_reported = dropped;
+    }
+
+    if(count == 0) return(0);
+
+    // every thread has its own ring, so restore the global order
+    std::stable_sort(m_flush_batch.begin(), m_flush_batch.begin() + static_cast<std::ptrdiff_t>(count),
+      [](const SLogEntry& lhs, const SLogEntry& rhs) { return lhs.time < rhs.time; });
+
+    WriteLog(m_flush_batch.data(), count);
+    return(0);
+  }
+
+  void CLog::WriteLog(const SLogEntry* entries_, size_t count_)
+  {
+    m_con_buffer.clear();
+    m_file_buffer.clear();
+
+    for (size_t i = 0; i < count_; ++i)
+    {
+      const SLogEntry& entry = entries_[i];
+
+      const eCAL_Logging_Filter log_con  = entry.level & m_filter_mask_con;
+      const eCAL_Logging_Filter log_file = entry.level & m_filter_mask_file;
+      const eCAL_Logging_Filter log_udp  = entry.level & m_filter_mask_udp;
+
+      if(log_con != 0)
+      {
+        m_con_buffer += entry.msg;
+        m_con_buffer += '\n';
+      }
+
+      if((log_file != 0) && (m_logfile != nullptr))
+      {
+        AppendFileLine(entry, m_file_buffer);
+      }
+
+      if((log_udp != 0) && m_udp_sender)
+      {
+        m_udp_msg.Clear();
+        m_udp_msg.set_time(std::chrono::duration_cast<std::chrono::microseconds>(entry.time.time_since_epoch()).count());
+        m_udp_msg.set_hname(m_hname);
+        m_udp_msg.set_pid(m_pid);
+        m_udp_msg.set_pname(m_pname);
+        m_udp_msg.set_uname(eCAL::Process::GetUnitName());
+        m_udp_msg.set_level(entry.level);
+        m_udp_msg.set_content(entry.msg);
+
+        m_udp_msg_s.clear();
+        if(m_udp_msg.SerializeToString(&m_udp_msg_s) && !m_udp_msg_s.empty())
+        {
+          m_udp_sender->Send((void*)m_udp_msg_s.data(), m_udp_msg_s.size());
+        }
+      }
+    }
+
+    // write console and file output in one go
+    if(!m_con_buffer.empty())
+    {
+      std::cout << m_con_buffer << std::flush;
+    }
+
+    if(!m_file_buffer.empty())
+    {
+      fwrite(m_file_buffer.data(), 1, m_file_buffer.size(), m_logfile);
+      fflush(m_logfile);
+    }
+  }
+
+  void CLog::AppendFileLine(const SLogEntry& entry_, std::string& line_)
+  {
+    line_ += std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(entry_.time.time_since_epoch()).count());
+    line_ += " ms | ";
+    line_ += m_hname;
+    line_ += " | ";
+    line_ += eCAL::Process::GetUnitName();
+    line_ += " | ";
+    line_ += std::to_string(m_pid);
+    line_ += " | ";
+    line_ += get_level_str(entry_.level);
+    line_ += " | ";
+    line_ += entry_.msg;
+    line_ += '\n';
+  }
 }
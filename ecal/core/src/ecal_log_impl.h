@@ -31,14 +31,27 @@
 #include <ecal/ecal_log_level.h>
 
 #include "ecal_global_accessors.h"
+#include "ecal_thread.h"
 
 #include <atomic>
 #include <mutex>
 #include <memory>
 #include <chrono>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <ecal/core/pb/monitoring.pb.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
 
 namespace eCAL
 {
+  class CLogRing;
+
   class CLog
   {
   public:
@@ -115,8 +128,26 @@ namespace eCAL
     **/
     std::chrono::duration<double> GetCoreTime();
 
+    /**
+      * @brief Returns the number of messages that have been dropped,
+      *        because the asynchronous log queue of a thread was full.
+    **/
+    unsigned long long GetDroppedMessages();
+
   private:
-    char ParseLogLevel(const std::string& filter_);
+    struct SLogEntry
+    {
+      SLogEntry() : level(log_level_none) {}
+      eCAL_Logging_eLogLevel            level;
+      eCAL::Time::ecal_clock::time_point time;
+      std::string                       msg;
+    };
+
+    CLogRing* GetThreadRing();
+    int       FlushAsync();
+
+    void      WriteLog(const SLogEntry* entries_, size_t count_);
+    void      AppendFileLine(const SLogEntry& entry_, std::string& line_);
 
     CLog(const CLog&);                 // prevent copy-construction
     CLog& operator=(const CLog&);      // prevent assignment
@@ -124,6 +155,9 @@ namespace eCAL
     std::mutex                   m_log_sync;
 
     std::atomic<bool>            m_created;
+    bool                         m_async;
+    size_t                       m_async_queue_size;
+    unsigned long long           m_instance_id;
     std::unique_ptr<CUDPSender>  m_udp_sender;
 
     std::string                  m_hname;
@@ -133,11 +167,23 @@ namespace eCAL
     std::string                  m_logfile_name;
     FILE*                        m_logfile;
 
-    eCAL_Logging_eLogLevel       m_level;
+    std::atomic<eCAL_Logging_eLogLevel> m_level;
     eCAL_Logging_Filter          m_filter_mask_con;
     eCAL_Logging_Filter          m_filter_mask_file;
     eCAL_Logging_Filter          m_filter_mask_udp;
 
+    eCAL::pb::LogMessage         m_udp_msg;
+    std::string                  m_udp_msg_s;
+    std::string                  m_con_buffer;
+    std::string                  m_file_buffer;
+
+    std::mutex                               m_rings_sync;
+    std::vector<std::shared_ptr<CLogRing>>   m_rings;
+    std::atomic<unsigned long long>          m_dropped_removed_rings;
+    unsigned long long                       m_dropped_reported;
+    std::vector<SLogEntry>                   m_flush_batch;
+    CThread                                  m_flush_thread;
+
     std::chrono::duration<double> m_core_time;
 
     std::chrono::steady_clock::time_point m_core_time_start;
@@ -252,14 +252,14 @@ namespace eCAL
       sstream << "Synchronization realtime : " << Config::GetTimesyncModuleName() << std::endl;
       sstream << "Synchronization replay   : " << eCALPAR(TIME, SYNC_MOD_REPLAY) << std::endl;
       sstream << "State                    : ";
-      if (g_timegate()->IsSynchronized()) sstream << " synchronized " << std::endl;
+      if (Time::IsSynchronized())         sstream << " synchronized " << std::endl;
       else                                sstream << " not synchronized " << std::endl;
       sstream << "Master / Slave           : ";
-      if (g_timegate()->IsMaster())       sstream << " Master " << std::endl;
+      if (Time::IsMaster())               sstream << " Master " << std::endl;
       else                                sstream << " Slave " << std::endl;
       int         status_state;
       std::string status_msg;
-      g_timegate()->GetStatus(status_state, &status_msg);
+      Time::GetStatus(status_state, &status_msg);
       sstream << "Status (Code)            : \"" << status_msg << "\" (" << status_state << ")" << std::endl;
       sstream << std::endl;
 
@@ -305,6 +305,7 @@ namespace eCAL
       sstream << "SHM Monitoring           : " << (Config::Experimental::IsShmMonitoringEnabled() ? "on" : "off") << std::endl;
       sstream << "SHM Monitoring (Domain)  : " << Config::Experimental::GetShmMonitoringDomain() << std::endl;
       sstream << "SHM Monitoring (Queue)   : " << Config::Experimental::GetShmMonitoringQueueSize() << std::endl;
+      sstream << "SHM Monitoring (Stats)   : " << Config::Experimental::GetShmMonitoringStatisticsRefreshMs() << " ms" << std::endl;
       sstream << "Network Monitoring       : " << (!Config::Experimental::IsNetworkMonitoringDisabled() ? "on" : "off") << std::endl;
       sstream << "Drop out-of-order msgs   : " << (Config::Experimental::GetDropOutOfOrderMessages() ? "on" : "off") << std::endl;
       sstream << std::endl;
@@ -32,10 +32,77 @@
 #include "ecal_globals.h"
 #include "ecal_registration_provider.h"
 #include "ecal_descgate.h"
+#include "ecal_thread_registry.h"
 
 #include "io/udp_configurations.h"
 #include "io/snd_sample.h"
 
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace
+{
+  // clears the statistics that change with every registration cycle
+  // and leaves the registration state
+  void ClearStatistics(eCAL::pb::Sample& sample_)
+  {
+    if (sample_.has_process())
+    {
+      auto* process = sample_.mutable_process();
+      process->clear_pmemory();
+      process->clear_pcpu();
+      process->clear_usrptime();
+      process->clear_datawrite();
+      process->clear_dataread();
+      for (auto& thread : *process->mutable_threads())
+      {
+        thread.clear_cpu_time();
+      }
+    }
+    if (sample_.has_topic())
+    {
+      auto* topic = sample_.mutable_topic();
+      topic->clear_message_drops();
+      topic->clear_dclock();
+      topic->clear_dfreq();
+      topic->clear_drate();
+      topic->clear_latency();
+      topic->clear_callback_duration();
+    }
+    if (sample_.has_service())
+    {
+      for (auto& method : *sample_.mutable_service()->mutable_methods())
+      {
+        method.clear_call_count();
+      }
+    }
+  }
+
+  // serializes the registration state of the samples (without the statistics) deterministically,
+  // so that equal states give equal strings, scratch_sample_ keeps its buffers from call to call
+  void SerializeRegistrationState(const eCAL::pb::SampleList& sample_list_, eCAL::pb::Sample& scratch_sample_, std::string& state_)
+  {
+    state_.clear();
+    google::protobuf::io::StringOutputStream output(&state_);
+    google::protobuf::io::CodedOutputStream  coded_output(&output);
+    coded_output.SetSerializationDeterministic(true);
+
+    for (const auto& sample : sample_list_.samples())
+    {
+      scratch_sample_.CopyFrom(sample);
+      ClearStatistics(scratch_sample_);
+      coded_output.WriteVarint64(static_cast<google::protobuf::uint64>(scratch_sample_.ByteSizeLong()));
+      scratch_sample_.SerializeWithCachedSizes(&coded_output);
+    }
+  }
+}
+
 namespace eCAL
 {
   extern eCAL_Process_eSeverity  g_process_severity;
@@ -55,7 +122,8 @@ namespace eCAL
                     m_reg_services(false),
                     m_reg_process(false),
                     m_use_network_monitoring(false),
-                    m_use_shm_monitoring(false)
+                    m_use_shm_monitoring(false),
+                    m_shm_statistics_refresh(EXP_SHM_MONITORING_STATISTICS_REFRESH)
 
   {
   }
@@ -77,6 +145,7 @@ namespace eCAL
 
     m_use_shm_monitoring     = Config::Experimental::IsShmMonitoringEnabled();
     m_use_network_monitoring = !Config::Experimental::IsNetworkMonitoringDisabled();
+    m_shm_statistics_refresh = Config::Experimental::GetShmMonitoringStatisticsRefreshMs();
 
     if (m_use_network_monitoring)
     {
@@ -316,6 +385,17 @@ namespace eCAL
 
     process_sample_mutable_process->set_ecal_runtime_version(eCAL::GetVersionString());
 
+    // eCAL internal threads
+    for (const auto& thread_info : GetThreadInfos())
+    {
+      auto* thread = process_sample_mutable_process->add_threads();
+      thread->set_name(thread_info.name);
+      thread->set_tid(thread_info.tid);
+      thread->set_affinity(thread_info.affinity);
+      thread->set_priority(thread_info.priority);
+      thread->set_cpu_time(google::protobuf::int64(thread_info.cpu_time_us));
+    }
+
     // apply registration sample
     const bool return_value = ApplySample(Process::GetHostName(), process_sample);
 
@@ -440,15 +520,39 @@ namespace eCAL
 
     if(m_use_shm_monitoring)
     {
+      bool rewrite {true};
+      int  sample_count {0};
       {
         const std::lock_guard<std::mutex> lock(m_sample_list_sync);
-        m_sample_list.SerializeToString(&m_sample_list_buffer);
+        sample_count = m_sample_list.samples_size();
+
+        // readers only parse a rewritten payload, so rewrite it only if the registration state
+        // changed or the statistics need to be refreshed
+        SerializeRegistrationState(m_sample_list, m_sample_state_scratch, m_sample_list_state_scratch);
+        const auto now = std::chrono::steady_clock::now();
+        if((m_sample_list_state_scratch == m_sample_list_state)
+          && (now - m_sample_list_write_time < std::chrono::milliseconds(m_shm_statistics_refresh)))
+        {
+          rewrite = false;
+        }
+        else
+        {
+          m_sample_list_state.swap(m_sample_list_state_scratch);
+          m_sample_list_write_time = now;
+          m_sample_list.SerializeToString(&m_sample_list_buffer);
+        }
+
         if(reset_sample_list_)
           m_sample_list.clear_samples();
       }
 
-      if(!m_sample_list_buffer.empty())
-        return_value &=m_memfile_broadcast_writer.Write(m_sample_list_buffer.data(), m_sample_list_buffer.size());
+      if(sample_count > 0)
+      {
+        // confirm an unchanged payload, the writer refuses that if the last write failed,
+        // then the last serialized payload is written again
+        if(rewrite || !m_memfile_broadcast_writer.Refresh())
+          return_value &=m_memfile_broadcast_writer.Write(m_sample_list_buffer.data(), m_sample_list_buffer.size());
+      }
     }
 
     return return_value;
@@ -36,6 +36,7 @@
 #include "io/ecal_memfile_broadcast_writer.h"
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -116,11 +117,16 @@ namespace eCAL
     std::mutex                       m_sample_list_sync;
     eCAL::pb::SampleList             m_sample_list;
     std::string                      m_sample_list_buffer;
+    std::string                      m_sample_list_state;          // deterministic serialization without the statistics
+    std::string                      m_sample_list_state_scratch;
+    eCAL::pb::Sample                 m_sample_state_scratch;
+    std::chrono::steady_clock::time_point m_sample_list_write_time;
 
     eCAL::CMemoryFileBroadcast       m_memfile_broadcast;
     eCAL::CMemoryFileBroadcastWriter m_memfile_broadcast_writer;
 
     bool m_use_network_monitoring;
     bool m_use_shm_monitoring;
+    int  m_shm_statistics_refresh;
   };
 };
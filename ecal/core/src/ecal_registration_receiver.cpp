@@ -51,6 +51,7 @@ namespace eCAL
   {
     if (m_created) return false;
     m_memfile_broadcast_reader = memfile_broadcast_reader_;
+    m_sample_lists.set_expiration(std::chrono::milliseconds(Config::GetRegistrationTimeoutMs()));
     m_created = true;
     return true;
   }
@@ -63,23 +64,38 @@ namespace eCAL
     if(!m_memfile_broadcast_reader->Read(message_list, 0))
       return false;
 
-    eCAL::pb::SampleList sample_list;
     bool return_value {true};
 
     for(const auto& message: message_list)
     {
-      if(sample_list.ParseFromArray(message.data, static_cast<int>(message.size)))
+      if(message.type == eMemfileBroadcastEventType::EVENT_REMOVED)
       {
-        for(const auto& sample: sample_list.samples())
+        m_sample_lists.erase(message.event_id);
+        continue;
+      }
+
+      // parse changed payloads only
+      eCAL::pb::SampleList& sample_list = m_sample_lists[message.event_id];
+      if((message.type == eMemfileBroadcastEventType::EVENT_UPDATED) || (sample_list.samples_size() == 0))
+      {
+        if(!sample_list.ParseFromArray(message.data, static_cast<int>(message.size)))
         {
-          return_value &= ApplySample(sample);
+          m_sample_lists.erase(message.event_id);
+          return_value = false;
+          continue;
         }
       }
-      else
+
+      // apply unchanged samples as well to keep them alive
+      for(const auto& sample: sample_list.samples())
       {
-        return_value = false;
+        return_value &= ApplySample(sample);
       }
     }
+
+    // sample lists of crashed writers are never removed by an event
+    m_sample_lists.remove_deprecated();
+
     return return_value;
   }
 
@@ -87,6 +103,7 @@ namespace eCAL
   {
     if (!m_created) return false;
     m_memfile_broadcast_reader = nullptr;
+    m_sample_lists.clear();
     m_created = false;
     return true;
   }
@@ -144,7 +161,7 @@ namespace eCAL
       attr.rcvbuf    = Config::GetUdpMulticastRcvBufSizeBytes();
 
       m_reg_rcv.Create(attr);
-      m_reg_rcv_thread.Start(0, std::bind(&CUdpRegistrationReceiver::Receive, &m_reg_rcv_process, &m_reg_rcv));
+      m_reg_rcv_thread.Start(0, std::bind(&CUdpRegistrationReceiver::Receive, &m_reg_rcv_process, &m_reg_rcv), thread_class_registration);
     }
 
     if (m_use_shm_monitoring)
@@ -154,7 +171,10 @@ namespace eCAL
       m_memfile_broadcast_reader.Bind(&m_memfile_broadcast);
 
       m_memfile_reg_rcv.Create(&m_memfile_broadcast_reader);
-      m_memfile_reg_rcv_thread.Start(Config::GetRegistrationRefreshMs() / 2 , std::bind(&CMemfileRegistrationReceiver::Receive, &m_memfile_reg_rcv));
+
+      // in fast discovery mode new registrations are picked up from the shared memory registry within a few ms
+      const int memfile_reg_rcv_period = Config::IsRegistrationFastDiscoveryEnabled() ? CMN_REGISTRATION_FAST_SHM_POLL : Config::GetRegistrationRefreshMs() / 2;
+      m_memfile_reg_rcv_thread.Start(memfile_reg_rcv_period, std::bind(&CMemfileRegistrationReceiver::Receive, &m_memfile_reg_rcv));
     }
 
     m_created = true;
@@ -30,6 +30,7 @@
 #include <ecal/ecal.h>
 
 #include "ecal_def.h"
+#include "ecal_expmap.h"
 #include "ecal_thread.h"
 
 #include "io/rcv_sample.h"
@@ -39,6 +40,7 @@
 
 #include <string>
 #include <atomic>
+#include <unordered_map>
 
 #ifdef _MSC_VER
 #pragma warning(push, 0) // disable proto warnings
@@ -68,6 +70,10 @@ namespace eCAL
   private:
     bool m_created = false;
     eCAL::CMemoryFileBroadcastReader* m_memfile_broadcast_reader = nullptr;
+
+    // last parsed sample list of every payload memfile, applied again as long as the payload is unchanged,
+    // expires if the payload was not read for the registration timeout (writer ended without removing it)
+    Util::CExpMap<std::uint64_t, eCAL::pb::SampleList> m_sample_lists;
   };
 
   using ApplySampleCallbackT = std::function<void (const eCAL::pb::Sample &)>;
@@ -28,7 +28,7 @@
 
 namespace eCAL
 {
-  CThread::CThread()
+  CThread::CThread() : m_wheel_id(0)
   {
   }
 
@@ -37,14 +37,27 @@ namespace eCAL
     try { Stop(); } catch(...) { /*??*/ }
   }
 
-  int CThread::Start(int period_, std::function<int()> ext_caller_)
+  int CThread::Start(int period_, std::function<int()> ext_caller_, eThreadClass thread_class_)
   {
     if(m_tdata.is_started) return(0);
 
+    if(period_ > 0)
+    {
+      m_tdata.period      = period_;
+      m_tdata.ext_caller  = ext_caller_;
+      m_wheel             = CTimerWheel::GetInstance();
+      // like the own thread, wait one period before the first call and between the calls
+      m_wheel_id          = m_wheel->Add(std::chrono::milliseconds(period_), std::chrono::milliseconds(period_), ext_caller_, true);
+      m_tdata.is_running  = (m_wheel_id != 0);
+      m_tdata.is_started  = true;
+      return(1);
+    }
+
     gOpenEvent(&m_tdata.event);
     m_tdata.do_stop     = false;
     m_tdata.period      = period_;
     m_tdata.ext_caller  = ext_caller_;
+    m_tdata.thread_class = thread_class_;
     m_tdata.thread      = std::thread(CThread::HelperThread, (void*)&m_tdata);
     m_tdata.is_started  = true;
 
@@ -55,7 +68,15 @@ namespace eCAL
 
   int CThread::Stop()
   {
-    if(m_tdata.is_started)
+    if(m_tdata.is_started && m_wheel)
+    {
+      m_wheel->Remove(m_wheel_id);
+      m_wheel.reset();
+      m_wheel_id          = 0;
+      m_tdata.is_running  = false;
+      m_tdata.is_started  = false;
+    }
+    else if(m_tdata.is_started)
     {
       // signal thread to stop
       m_tdata.do_stop = true;
@@ -78,6 +99,11 @@ namespace eCAL
 
   int CThread::Fire()
   {
+    if(m_wheel)
+    {
+      m_wheel->Trigger(m_wheel_id);
+      return(1);
+    }
     gSetEvent(m_tdata.event);
     return(1);
   }
@@ -89,6 +115,8 @@ namespace eCAL
     struct ThreadData* tdata = static_cast<ThreadData*>(par_);
     if(!gEventIsValid(tdata->event)) return;
 
+    const CThreadScope thread_scope(tdata->thread_class);
+
     // mark as running
     tdata->is_running = true;
 
@@ -25,19 +25,26 @@
 
 #include <ecal/ecal_eventhandle.h>
 
+#include "ecal_thread_registry.h"
+#include "ecal_timer_wheel.h"
+
 #include <atomic>
 #include <thread>
 #include <functional>
+#include <memory>
 
 namespace eCAL
 {
+  // Periodic threads (period > 0) are executed by the process wide timer wheel,
+  // only threads with period 0 (e.g. blocking socket receive) get their own thread,
+  // that is configured by its thread class.
   class CThread
   {
   public:
     CThread();
     virtual ~CThread();
 
-    int Start(int period, std::function<int()> ext_caller_);
+    int Start(int period, std::function<int()> ext_caller_, eThreadClass thread_class_ = thread_class_timer);
     int Stop();
     int Fire();
 
@@ -51,6 +58,7 @@ namespace eCAL
        , is_running(false)
        , is_started(false)
        , do_stop(false)
+       , thread_class(thread_class_timer)
       {
       };
       std::thread             thread;
@@ -60,9 +68,13 @@ namespace eCAL
       std::atomic<bool>       is_started;
       std::atomic<bool>       do_stop;
       std::function<int()>    ext_caller;
+      eThreadClass            thread_class;
     };
     struct ThreadData m_tdata;
 
+    std::shared_ptr<CTimerWheel> m_wheel;
+    CTimerWheel::TimerIdT        m_wheel_id;
+
     static void HelperThread(void* par_);
   };
 }
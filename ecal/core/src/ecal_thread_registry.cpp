@@ -0,0 +1,227 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL internal thread naming, cpu affinity and priority control
+**/
+
+#include <ecal/ecal.h>
+
+#include "ecal_def.h"
+#include "ecal_def_ini.h"
+#include "ecal_config_reader.h"
+#include "ecal_cpu_list.h"
+#include "ecal_global_accessors.h"
+#include "ecal_thread_registry.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#ifdef ECAL_OS_LINUX
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+  const char* g_thread_class_names[eCAL::thread_class_count] =
+  {
+    "udp_receive",
+    "registration",
+    "shm_observer",
+    "tcp",
+    "service",
+    "timer",
+    "monitoring",
+    "callback",
+  };
+
+  struct SThreadSettings
+  {
+    SThreadSettings() : priority(0) {}
+
+    std::string       affinity;
+    std::vector<int>  cpus;
+    int               priority;
+  };
+
+  SThreadSettings GetThreadSettings(eCAL::eThreadClass class_)
+  {
+    SThreadSettings settings;
+    eCAL::CConfig* config = eCAL::g_config();
+    if (config == nullptr) return settings;
+
+    const std::string class_name = g_thread_class_names[class_];
+    settings.affinity = config->get(THREADS_SECTION_S, class_name + THREADS_AFFINITY_S, THREADS_AFFINITY);
+    settings.priority = config->get(THREADS_SECTION_S, class_name + THREADS_PRIORITY_S, THREADS_PRIORITY);
+    if (!eCAL::Util::ParseCpuList(settings.affinity, settings.cpus))
+    {
+      eCAL::Logging::Log(log_level_warning, "Invalid cpu list in [" THREADS_SECTION_S "] configuration: " + settings.affinity);
+    }
+    return settings;
+  }
+
+  void ApplyThreadSettings(eCAL::eThreadClass class_, const SThreadSettings& settings_)
+  {
+#ifdef ECAL_OS_LINUX
+    // thread names are limited to 15 characters
+    const std::string name = std::string("ecal_") + g_thread_class_names[class_];
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+
+    if (!settings_.cpus.empty())
+    {
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      for (const int cpu : settings_.cpus)
+      {
+        if ((cpu >= 0) && (cpu < CPU_SETSIZE)) CPU_SET(cpu, &cpu_set);
+      }
+      if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0)
+      {
+        eCAL::Logging::Log(log_level_warning, name + ": Could not set cpu affinity " + settings_.affinity);
+      }
+    }
+
+    if (settings_.priority > 0)
+    {
+      sched_param param{};
+      param.sched_priority = settings_.priority;
+      if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0)
+      {
+        eCAL::Logging::Log(log_level_warning, name + ": Could not set SCHED_FIFO priority " + std::to_string(settings_.priority) + " (missing CAP_SYS_NICE ?)");
+      }
+    }
+#else
+    (void)class_;
+    (void)settings_;
+#endif
+  }
+
+  struct SThreadEntry
+  {
+    eCAL::SThreadInfo  info;
+#ifdef ECAL_OS_LINUX
+    clockid_t          cpu_clock;
+#endif
+  };
+
+  // entries are removed by the thread itself before it terminates
+  std::mutex& ThreadMapSync()
+  {
+    static std::mutex sync;
+    return sync;
+  }
+
+  std::map<void*, SThreadEntry>& ThreadMap()
+  {
+    static std::map<void*, SThreadEntry> thread_map;
+    return thread_map;
+  }
+}
+
+namespace eCAL
+{
+  CThreadScope::CThreadScope(eThreadClass class_)
+  {
+    const SThreadSettings settings = GetThreadSettings(class_);
+    ApplyThreadSettings(class_, settings);
+
+    SThreadEntry entry;
+    entry.info.name     = std::string("ecal_") + g_thread_class_names[class_];
+    entry.info.affinity = settings.affinity;
+    entry.info.priority = settings.priority;
+#ifdef ECAL_OS_LINUX
+    entry.info.tid      = static_cast<int>(syscall(SYS_gettid));
+    if (pthread_getcpuclockid(pthread_self(), &entry.cpu_clock) != 0) entry.cpu_clock = CLOCK_THREAD_CPUTIME_ID;
+#endif
+
+    const std::lock_guard<std::mutex> lock(ThreadMapSync());
+    ThreadMap()[this] = entry;
+  }
+
+  CThreadScope::~CThreadScope()
+  {
+    const std::lock_guard<std::mutex> lock(ThreadMapSync());
+    ThreadMap().erase(this);
+  }
+
+  struct CThreadInheritScope::SSavedState
+  {
+#ifdef ECAL_OS_LINUX
+    SSavedState() : name(), affinity_valid(false), affinity(), sched_valid(false), policy(0), param() {}
+
+    char         name[16];
+    bool         affinity_valid;
+    cpu_set_t    affinity;
+    bool         sched_valid;
+    int          policy;
+    sched_param  param;
+#endif
+  };
+
+  CThreadInheritScope::CThreadInheritScope(eThreadClass class_) : m_saved(new SSavedState)
+  {
+#ifdef ECAL_OS_LINUX
+    if (pthread_getname_np(pthread_self(), m_saved->name, sizeof(m_saved->name)) != 0) m_saved->name[0] = 0;
+    m_saved->affinity_valid = (pthread_getaffinity_np(pthread_self(), sizeof(m_saved->affinity), &m_saved->affinity) == 0);
+    m_saved->sched_valid    = (pthread_getschedparam(pthread_self(), &m_saved->policy, &m_saved->param) == 0);
+#endif
+    ApplyThreadSettings(class_, GetThreadSettings(class_));
+  }
+
+  CThreadInheritScope::~CThreadInheritScope()
+  {
+#ifdef ECAL_OS_LINUX
+    if (m_saved->name[0] != 0)  pthread_setname_np(pthread_self(), m_saved->name);
+    if (m_saved->affinity_valid) pthread_setaffinity_np(pthread_self(), sizeof(m_saved->affinity), &m_saved->affinity);
+    if (m_saved->sched_valid)    pthread_setschedparam(pthread_self(), m_saved->policy, &m_saved->param);
+#endif
+  }
+
+  const char* GetThreadClassName(eThreadClass class_)
+  {
+    if (class_ >= thread_class_count) return "";
+    return g_thread_class_names[class_];
+  }
+
+  std::vector<SThreadInfo> GetThreadInfos()
+  {
+    std::vector<SThreadInfo> thread_infos;
+
+    const std::lock_guard<std::mutex> lock(ThreadMapSync());
+    for (const auto& thread : ThreadMap())
+    {
+      SThreadInfo info = thread.second.info;
+#ifdef ECAL_OS_LINUX
+      timespec cpu_time{};
+      if (clock_gettime(thread.second.cpu_clock, &cpu_time) == 0)
+      {
+        info.cpu_time_us = static_cast<long long>(cpu_time.tv_sec) * 1000000 + cpu_time.tv_nsec / 1000;
+      }
+#endif
+      thread_infos.push_back(info);
+    }
+
+    return thread_infos;
+  }
+}
@@ -0,0 +1,103 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL internal thread naming, cpu affinity and priority control
+**/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Classes of the eCAL internal threads, every class can be configured
+   *        in the [threads] section of the ecal.ini.
+  **/
+  enum eThreadClass
+  {
+    thread_class_udp_receive = 0,
+    thread_class_registration,
+    thread_class_shm_observer,
+    thread_class_tcp,
+    thread_class_service,
+    thread_class_timer,
+    thread_class_monitoring,
+    thread_class_callback,
+    thread_class_count
+  };
+
+  struct SThreadInfo
+  {
+    SThreadInfo() : tid(0), priority(0), cpu_time_us(0) {}
+
+    std::string  name;          // thread name (ecal_<class>)
+    int          tid;           // os thread id
+    std::string  affinity;      // configured cpu list, empty if not pinned
+    int          priority;      // configured SCHED_FIFO priority, 0 for the default scheduling policy
+    long long    cpu_time_us;   // consumed cpu time
+  };
+
+  /**
+   * @brief Names the calling thread, applies the cpu affinity and priority
+   *        configured for its class and lists it in the process registration,
+   *        as long as the object exists. Create it at the top of the thread function.
+  **/
+  class CThreadScope
+  {
+  public:
+    explicit CThreadScope(eThreadClass class_);
+    ~CThreadScope();
+
+    CThreadScope(const CThreadScope&) = delete;
+    CThreadScope& operator=(const CThreadScope&) = delete;
+  };
+
+  /**
+   * @brief Applies the settings of a thread class to the calling thread and
+   *        restores the previous ones on destruction. Threads that are created
+   *        meanwhile (e.g. by third party thread pools) inherit the settings.
+  **/
+  class CThreadInheritScope
+  {
+  public:
+    explicit CThreadInheritScope(eThreadClass class_);
+    ~CThreadInheritScope();
+
+    CThreadInheritScope(const CThreadInheritScope&) = delete;
+    CThreadInheritScope& operator=(const CThreadInheritScope&) = delete;
+
+  private:
+    struct SSavedState;
+    std::unique_ptr<SSavedState> m_saved;
+  };
+
+  /**
+   * @brief Returns the name of a thread class as used in the ecal.ini keys.
+  **/
+  const char* GetThreadClassName(eThreadClass class_);
+
+  /**
+   * @brief Returns all running eCAL threads of the process.
+  **/
+  std::vector<SThreadInfo> GetThreadInfos();
+}
@@ -35,69 +35,77 @@ namespace eCAL
   {
     std::string GetName()
     {
-      if (!g_timegate() || !g_timegate()->IsValid()) return("");
-      return(g_timegate()->GetName());
+      CTimeGate* timegate = g_ensure_timegate();
+      if (!timegate || !timegate->IsValid()) return("");
+      return(timegate->GetName());
     }
 
     long long GetMicroSeconds()
     {
-      if (!g_timegate() || !g_timegate()->IsValid())
+      CTimeGate* timegate = g_ensure_timegate();
+      if (!timegate || !timegate->IsValid())
       {
         const std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
         return(std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count());
       }
-      return(g_timegate()->GetMicroSeconds());
+      return(timegate->GetMicroSeconds());
     }
 
     long long GetNanoSeconds()
     {
-      if (!g_timegate() || !g_timegate()->IsValid())
+      CTimeGate* timegate = g_ensure_timegate();
+      if (!timegate || !timegate->IsValid())
       {
         const std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
         return(std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count());
       }
-      return(g_timegate()->GetNanoSeconds());
+      return(timegate->GetNanoSeconds());
     }
 
     bool SetNanoSeconds(long long time_)
     {
-      if (!g_timegate() || !g_timegate()->IsValid()) return(false);
-      return(g_timegate()->SetNanoSeconds(time_));
+      CTimeGate* timegate = g_ensure_timegate();
+      if (!timegate || !timegate->IsValid()) return(false);
+      return(timegate->SetNanoSeconds(time_));
     }
 
     bool IsSynchronized()
     {
-      if (!g_timegate() || !g_timegate()->IsValid()) return(false);
-      return(g_timegate()->IsSynchronized());
+      CTimeGate* timegate = g_ensure_timegate();
+      if (!timegate || !timegate->IsValid()) return(false);
+      return(timegate->IsSynchronized());
     }
 
     bool IsMaster()
     {
-      if (!g_timegate() || !g_timegate()->IsValid()) return(false);
-      return(g_timegate()->IsMaster());
+      CTimeGate* timegate = g_ensure_timegate();
+      if (!timegate || !timegate->IsValid()) return(false);
+      return(timegate->IsMaster());
     }
     
     void SleepForNanoseconds(long long duration_nsecs_)
     {
-      if (!g_timegate() || !g_timegate()->IsValid())
+      CTimeGate* timegate = g_ensure_timegate();
+      if (!timegate || !timegate->IsValid())
       {
         eCAL::Process::SleepFor(std::chrono::nanoseconds(duration_nsecs_));
       }
       else
       {
-        g_timegate()->SleepForNanoseconds(duration_nsecs_);
+        timegate->SleepForNanoseconds(duration_nsecs_);
       }
     }
 
     void GetStatus(int& error_, std::string* const status_message_) {
-      if (!g_timegate()) {
+      CTimeGate* timegate = g_ensure_timegate();
+      if (!timegate) {
         error_ = -1;
         if (status_message_) {
           status_message_->assign("Timegate has not been initialized!");
         }
       }
       else {
-        g_timegate()->GetStatus(error_, status_message_);
+        timegate->GetStatus(error_, status_message_);
       }
     }
   }
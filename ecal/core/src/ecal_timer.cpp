@@ -23,19 +23,38 @@
 
 #include <ecal/ecal.h>
 
+#include "ecal_thread_registry.h"
+#include "ecal_timer_wheel.h"
+
 #include <atomic>
 #include <chrono>
 #include <thread>
 #include <assert.h>
+#include <memory>
+#include <string>
+
+namespace
+{
+  // The shared timer wheel runs on the steady clock. This only matches the eCAL
+  // time for time adapters that follow the real time. Timers of all other
+  // adapters (e.g. simulation time) keep their own thread sleeping in eCAL time.
+  bool IsRealTimeAdapter()
+  {
+    const std::string time_adapter = eCAL::Time::GetName();
+    return time_adapter.empty()
+      || (time_adapter.find("ecaltime-localtime") != std::string::npos)
+      || (time_adapter.find("ecaltime-linuxptp")  != std::string::npos);
+  }
+}
 
 namespace eCAL
 {
   class CTimerImpl
   {
   public:
-    CTimerImpl() : m_stop(false), m_running(false), m_last_error(0) {}
+    CTimerImpl() : m_stop(false), m_running(false), m_wheel_id(0), m_last_error(0) {}
 
-    CTimerImpl(const int timeout_, TimerCallbackT callback_, const int delay_) : m_stop(false), m_running(false) { Start(timeout_, callback_, delay_); }
+    CTimerImpl(const int timeout_, TimerCallbackT callback_, const int delay_) : m_stop(false), m_running(false), m_wheel_id(0) { Start(timeout_, callback_, delay_); }
 
     virtual ~CTimerImpl() { Stop(); }
 
@@ -45,7 +64,19 @@ namespace eCAL
       if(m_running)    return(false);
       if(timeout_ < 0) return(false);
       m_stop = false;
-      m_thread = std::thread(&CTimerImpl::Thread, this, callback_, timeout_, delay_);
+
+      if (IsRealTimeAdapter())
+      {
+        assert(callback_ != nullptr);
+        if (callback_ == nullptr) return(false);
+
+        m_wheel    = CTimerWheel::GetInstance();
+        m_wheel_id = m_wheel->Add(std::chrono::milliseconds(timeout_), std::chrono::milliseconds(delay_), [callback_]() { callback_(); return(0); });
+      }
+      else
+      {
+        m_thread = std::thread(&CTimerImpl::Thread, this, callback_, timeout_, delay_);
+      }
       m_running = true;
       return(true);
     }
@@ -53,17 +84,34 @@ namespace eCAL
     bool Stop()
     {
       if(!m_running) return(false);
-      m_stop = true;
-      m_thread.join();
+      if (m_wheel)
+      {
+        m_wheel->Remove(m_wheel_id);
+        m_wheel.reset();
+        m_wheel_id = 0;
+      }
+      else
+      {
+        m_stop = true;
+        m_thread.join();
+      }
       m_running = false;
       return(true);
     }
 
+    bool GetStatistics(STimerStatistics& stats_)
+    {
+      if (!m_running || !m_wheel) return(false);
+      return(m_wheel->GetStatistics(m_wheel_id, stats_));
+    }
+
   private:
     void Thread(TimerCallbackT callback_, int timeout_, int delay_)
     {
       assert(callback_ != nullptr);
       if (callback_ == nullptr) return;
+
+      const CThreadScope thread_scope(thread_class_timer);
       if (delay_ > 0) eCAL::Time::sleep_for(std::chrono::milliseconds(delay_));
 
       const std::chrono::nanoseconds loop_duration((long long)timeout_ * 1000LL * 1000LL);
@@ -122,10 +170,12 @@ namespace eCAL
       m_stop = false;
     }
 
-    std::atomic<bool>        m_stop;
-    std::atomic<bool>        m_running;
-    std::thread              m_thread;
-    std::chrono::nanoseconds m_last_error;
+    std::atomic<bool>            m_stop;
+    std::atomic<bool>            m_running;
+    std::thread                  m_thread;
+    std::shared_ptr<CTimerWheel> m_wheel;
+    CTimerWheel::TimerIdT        m_wheel_id;
+    std::chrono::nanoseconds     m_last_error;
   };
 
 
@@ -155,4 +205,9 @@ namespace eCAL
   {
     return(m_timer->Stop());
   }
+
+  bool CTimer::GetStatistics(STimerStatistics& stats_) const
+  {
+    return(m_timer->GetStatistics(stats_));
+  }
 }
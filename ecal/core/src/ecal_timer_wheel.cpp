@@ -0,0 +1,533 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL process wide timer scheduler
+**/
+
+#include <ecal/ecal.h>
+#include <ecal/ecal_config.h>
+
+#include "ecal_def.h"
+#include "ecal_global_accessors.h"
+#include "ecal_thread_registry.h"
+#include "ecal_timer_wheel.h"
+
+#include <algorithm>
+#include <limits>
+
+#ifdef ECAL_OS_LINUX
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+  typedef std::chrono::milliseconds tick_duration;
+
+  const unsigned long long kNoTick = std::numeric_limits<unsigned long long>::max();
+
+  // a new worker is only started, if a timer waited that long for a free one
+  const std::chrono::milliseconds kWorkerSpawnDelay(5);
+
+  // additional workers exit, if they did not get any work for that long
+  const std::chrono::seconds kWorkerIdleTimeout(10);
+
+  // the timer wheel the current thread belongs to
+  thread_local const eCAL::CTimerWheel* t_thread_wheel = nullptr;
+
+  unsigned long long to_ticks(std::chrono::nanoseconds duration_)
+  {
+    if (duration_.count() <= 0) return(0);
+    return(static_cast<unsigned long long>((duration_ + tick_duration(1) - std::chrono::nanoseconds(1)) / tick_duration(1)));
+  }
+}
+
+namespace eCAL
+{
+  std::shared_ptr<CTimerWheel> CTimerWheel::GetInstance()
+  {
+    // intentionally leaked, timers may still be stopped during static destruction
+    static std::mutex*                 instance_mutex = new std::mutex;
+    static std::weak_ptr<CTimerWheel>* instance       = new std::weak_ptr<CTimerWheel>;
+
+    const std::lock_guard<std::mutex> lock(*instance_mutex);
+    auto wheel = instance->lock();
+    if (!wheel)
+    {
+      size_t min_threads(TIME_TIMER_THREADS);
+      bool   high_precision(TIME_TIMER_HIGH_PRECISION);
+      if (g_config() != nullptr)
+      {
+        min_threads    = Config::GetTimerThreadCount();
+        high_precision = Config::IsTimerHighPrecisionEnabled();
+      }
+      wheel     = std::shared_ptr<CTimerWheel>(new CTimerWheel(min_threads, high_precision), &CTimerWheel::Destroy);
+      *instance = wheel;
+    }
+    return(wheel);
+  }
+
+  void CTimerWheel::Destroy(CTimerWheel* wheel_)
+  {
+    // a timer callback released the last reference, the destructor has to
+    // join the worker that is running this callback, so we hand it over
+    if (t_thread_wheel == wheel_)
+    {
+      std::thread([wheel_]() { delete wheel_; }).detach();
+    }
+    else
+    {
+      delete wheel_;
+    }
+  }
+
+  CTimerWheel::CTimerWheel(size_t min_threads_, bool high_precision_) :
+    m_start_time(clock::now()),
+    m_min_threads(std::max<size_t>(min_threads_, 1)),
+    m_high_precision(high_precision_),
+    m_stop(false),
+    m_wakeup(false),
+    m_wait_tick(kNoTick),
+    m_current_tick(0),
+    m_scheduled_count(0),
+    m_next_id(1),
+    m_idle_workers(0)
+#ifdef ECAL_OS_LINUX
+    , m_timer_fd(-1)
+    , m_event_fd(-1)
+#endif
+  {
+#ifdef ECAL_OS_LINUX
+    if (m_high_precision)
+    {
+      m_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+      m_event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+      if ((m_timer_fd < 0) || (m_event_fd < 0))
+      {
+        // fall back to the condition variable
+        if (m_timer_fd >= 0) close(m_timer_fd);
+        if (m_event_fd >= 0) close(m_event_fd);
+        m_timer_fd = -1;
+        m_event_fd = -1;
+      }
+    }
+#endif
+
+    for (size_t i = 0; i < m_min_threads; ++i)
+    {
+      m_workers.emplace_back(&CTimerWheel::WorkerThread, this);
+    }
+    m_tick_thread = std::thread(&CTimerWheel::TickThread, this);
+  }
+
+  CTimerWheel::~CTimerWheel()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+      WakeUpTickThread();
+    }
+    m_work_cv.notify_all();
+
+    // never called from our own threads, see Destroy
+    if (m_tick_thread.joinable()) m_tick_thread.join();
+    for (auto& worker : m_workers)
+    {
+      if (worker.joinable()) worker.join();
+    }
+    for (auto& worker : m_exited_workers)
+    {
+      if (worker.joinable()) worker.join();
+    }
+
+#ifdef ECAL_OS_LINUX
+    if (m_timer_fd >= 0) close(m_timer_fd);
+    if (m_event_fd >= 0) close(m_event_fd);
+#endif
+  }
+
+  CTimerWheel::TimerIdT CTimerWheel::Add(std::chrono::nanoseconds period_, std::chrono::nanoseconds delay_, CallbackT callback_, bool fixed_delay_)
+  {
+    if (!callback_) return(0);
+
+    auto timer = std::make_shared<STimer>();
+    timer->callback     = std::move(callback_);
+    timer->period_ticks = std::max<unsigned long long>(to_ticks(period_), 1);
+    timer->fixed_delay  = fixed_delay_;
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    timer->id = m_next_id++;
+    m_timers.emplace(timer->id, timer);
+    Schedule(timer, std::max(NowTick(), m_current_tick) + to_ticks(delay_));
+
+    return(timer->id);
+  }
+
+  bool CTimerWheel::Remove(TimerIdT id_)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto timer_it = m_timers.find(id_);
+    if (timer_it == m_timers.end()) return(false);
+
+    TimerPtrT timer = timer_it->second;
+    m_timers.erase(timer_it);
+    timer->is_removed   = true;
+    timer->is_scheduled = false;
+
+    // wait for a running callback, unless we have been called from it
+    if (timer->running_thread != std::this_thread::get_id())
+    {
+      m_done_cv.wait(lock, [&timer]() { return !timer->is_running; });
+    }
+    return(true);
+  }
+
+  bool CTimerWheel::Trigger(TimerIdT id_)
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto timer_it = m_timers.find(id_);
+    if (timer_it == m_timers.end()) return(false);
+
+    auto& timer = timer_it->second;
+    if (timer->is_running)
+    {
+      // run again as soon as the current call has finished
+      timer->is_triggered = true;
+    }
+    else if (timer->due_tick > m_current_tick + 1)
+    {
+      Schedule(timer, m_current_tick + 1);
+    }
+    return(true);
+  }
+
+  bool CTimerWheel::GetStatistics(TimerIdT id_, STimerStatistics& stats_)
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto timer_it = m_timers.find(id_);
+    if (timer_it == m_timers.end()) return(false);
+
+    const auto& timer = timer_it->second;
+    stats_ = timer->stats;
+    stats_.jitter_mean_us = (timer->stats.call_count > 0) ? (timer->jitter_sum_us / timer->stats.call_count) : 0;
+    return(true);
+  }
+
+  void CTimerWheel::Schedule(const TimerPtrT& timer_, unsigned long long due_tick_)
+  {
+    // the current tick has already been processed
+    due_tick_ = std::max(due_tick_, m_current_tick + 1);
+
+    timer_->due_tick     = due_tick_;
+    timer_->is_scheduled = true;
+    Insert(timer_, due_tick_);
+
+    // the tick thread sleeps longer than this timer may wait
+    if (due_tick_ < m_wait_tick) WakeUpTickThread();
+  }
+
+  void CTimerWheel::Insert(const TimerPtrT& timer_, unsigned long long due_tick_)
+  {
+    const unsigned long long delta = due_tick_ - m_current_tick;
+
+    size_t level = 0;
+    while ((level < kLevels - 1) && (delta >= (1ULL << ((level + 1) * kLevelBits)))) level++;
+
+    // timers beyond the range of the wheel are parked in the last slot reachable
+    // and inserted again when this slot is cascaded
+    const unsigned long long max_delta = (1ULL << (kLevels * kLevelBits)) - 1;
+    const unsigned long long slot_tick = (delta > max_delta) ? (m_current_tick + max_delta) : due_tick_;
+
+    m_wheel[level][(slot_tick >> (level * kLevelBits)) & kLevelMask].emplace_back(timer_, due_tick_);
+    m_scheduled_count++;
+  }
+
+  void CTimerWheel::Advance(std::vector<TimerPtrT>& due_timers_)
+  {
+    const unsigned long long tick = ++m_current_tick;
+
+    auto is_valid = [](const TimerPtrT& timer_, unsigned long long due_tick_)
+    {
+      return !timer_->is_removed && timer_->is_scheduled && (timer_->due_tick == due_tick_);
+    };
+
+    // cascade the higher levels down, starting with the highest one that wrapped
+    size_t cascade_level = 0;
+    while ((cascade_level < kLevels - 1) && ((tick & ((1ULL << ((cascade_level + 1) * kLevelBits)) - 1)) == 0)) cascade_level++;
+
+    for (size_t level = cascade_level; level > 0; --level)
+    {
+      SlotT slot;
+      slot.swap(m_wheel[level][(tick >> (level * kLevelBits)) & kLevelMask]);
+      m_scheduled_count -= slot.size();
+      for (const auto& entry : slot)
+      {
+        if (is_valid(entry.first, entry.second)) Insert(entry.first, entry.second);
+      }
+    }
+
+    SlotT slot;
+    slot.swap(m_wheel[0][tick & kLevelMask]);
+    m_scheduled_count -= slot.size();
+    for (const auto& entry : slot)
+    {
+      if (!is_valid(entry.first, entry.second)) continue;
+      entry.first->is_scheduled = false;
+      due_timers_.push_back(entry.first);
+    }
+  }
+
+  unsigned long long CTimerWheel::NextEventTick() const
+  {
+    if (m_scheduled_count == 0) return(kNoTick);
+
+    for (unsigned long long tick = m_current_tick + 1; tick <= m_current_tick + kLevelSlots; ++tick)
+    {
+      if (!m_wheel[0][tick & kLevelMask].empty()) return(tick);
+
+      // a higher level has to be cascaded
+      if ((tick & kLevelMask) == 0)
+      {
+        if (!m_wheel[1][(tick >> kLevelBits) & kLevelMask].empty()) return(tick);
+        if ((tick & ((1ULL << (2 * kLevelBits)) - 1)) == 0)          return(tick);
+      }
+    }
+    return(m_current_tick + kLevelSlots);
+  }
+
+  unsigned long long CTimerWheel::NowTick() const
+  {
+    return(static_cast<unsigned long long>(std::chrono::duration_cast<tick_duration>(clock::now() - m_start_time).count()));
+  }
+
+  void CTimerWheel::TickThread()
+  {
+    const CThreadScope thread_scope(thread_class_timer);
+    t_thread_wheel = this;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    std::vector<TimerPtrT> due_timers;
+    while (!m_stop)
+    {
+      JoinExitedWorkers(lock);
+      if (m_stop) break;
+
+      const unsigned long long now_tick = NowTick();
+      while (m_current_tick < now_tick) Advance(due_timers);
+
+      // hand the due timers over to the workers
+      if (!due_timers.empty())
+      {
+        const auto now = clock::now();
+        for (auto& timer : due_timers)
+        {
+          timer->is_running = true;
+          m_work_queue.emplace_back(std::move(timer), now);
+        }
+        due_timers.clear();
+        m_work_cv.notify_all();
+      }
+
+      // more due timers than idle workers for a while, so we need another one
+      unsigned long long wait_tick = NextEventTick();
+      if (m_work_queue.size() > m_idle_workers)
+      {
+        if (clock::now() - m_work_queue.front().second >= kWorkerSpawnDelay)
+        {
+          m_workers.emplace_back(&CTimerWheel::WorkerThread, this);
+        }
+        wait_tick = std::min(wait_tick, m_current_tick + 1);
+      }
+
+      WaitForTick(lock, wait_tick);
+    }
+  }
+
+  void CTimerWheel::WorkerThread()
+  {
+    const CThreadScope thread_scope(thread_class_timer);
+    t_thread_wheel = this;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_stop)
+    {
+      m_idle_workers++;
+      const bool has_work = m_work_cv.wait_for(lock, kWorkerIdleTimeout, [this]() { return m_stop || !m_work_queue.empty(); });
+      m_idle_workers--;
+      if (m_stop) break;
+
+      if (!has_work)
+      {
+        // shrink the pool to its configured size again, the tick thread joins us
+        if (m_workers.size() > m_min_threads)
+        {
+          const auto this_thread_id = std::this_thread::get_id();
+          auto worker_it = std::find_if(m_workers.begin(), m_workers.end(), [&this_thread_id](const std::thread& worker_) { return worker_.get_id() == this_thread_id; });
+          if (worker_it != m_workers.end())
+          {
+            m_exited_workers.splice(m_exited_workers.end(), m_workers, worker_it);
+            WakeUpTickThread();
+            break;
+          }
+        }
+        continue;
+      }
+
+      TimerPtrT timer = std::move(m_work_queue.front().first);
+      m_work_queue.pop_front();
+
+      if (!timer->is_removed)
+      {
+        // jitter is the delay of the call to its scheduled tick
+        const auto due_time  = m_start_time + tick_duration(timer->due_tick);
+        const long long jitter_us = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - due_time).count();
+        auto& stats = timer->stats;
+        stats.jitter_min_us = (stats.call_count == 0) ? jitter_us : std::min(stats.jitter_min_us, jitter_us);
+        stats.jitter_max_us = (stats.call_count == 0) ? jitter_us : std::max(stats.jitter_max_us, jitter_us);
+        stats.call_count++;
+        timer->jitter_sum_us += jitter_us;
+
+        timer->running_thread = std::this_thread::get_id();
+        lock.unlock();
+        const int state = timer->callback();
+        lock.lock();
+        timer->running_thread = std::thread::id();
+
+        if ((state < 0) && !timer->is_removed)
+        {
+          m_timers.erase(timer->id);
+          timer->is_removed = true;
+        }
+      }
+      timer->is_running = false;
+
+      if (!timer->is_removed)
+      {
+        unsigned long long next_tick(0);
+        if (timer->is_triggered)
+        {
+          next_tick = m_current_tick + 1;
+          timer->is_triggered = false;
+        }
+        else if (timer->fixed_delay)
+        {
+          // one period after the call has finished, so there are no overruns
+          next_tick = std::max(NowTick(), m_current_tick) + timer->period_ticks;
+        }
+        else
+        {
+          next_tick = timer->due_tick + timer->period_ticks;
+          if (next_tick <= m_current_tick)
+          {
+            // the callback took longer than its period, skip the missed calls
+            const unsigned long long missed = (m_current_tick - next_tick) / timer->period_ticks + 1;
+            timer->stats.overrun_count += static_cast<long long>(missed);
+            next_tick += missed * timer->period_ticks;
+          }
+        }
+        Schedule(timer, next_tick);
+      }
+
+      m_done_cv.notify_all();
+    }
+  }
+
+  void CTimerWheel::WaitForTick(std::unique_lock<std::mutex>& lock_, unsigned long long tick_)
+  {
+    m_wait_tick = tick_;
+
+#ifdef ECAL_OS_LINUX
+    if (m_timer_fd >= 0)
+    {
+      // arm the timerfd with the absolute deadline, this is more precise than
+      // the timeout of a condition variable
+      struct itimerspec deadline = {};
+      if (tick_ != kNoTick)
+      {
+        const auto deadline_ns = std::chrono::duration_cast<std::chrono::nanoseconds>((m_start_time + tick_duration(tick_)).time_since_epoch()).count();
+        deadline.it_value.tv_sec  = static_cast<time_t>(deadline_ns / 1000000000LL);
+        deadline.it_value.tv_nsec = static_cast<long>(deadline_ns % 1000000000LL);
+        if ((deadline.it_value.tv_sec == 0) && (deadline.it_value.tv_nsec == 0)) deadline.it_value.tv_nsec = 1;
+      }
+      timerfd_settime(m_timer_fd, TFD_TIMER_ABSTIME, &deadline, nullptr);
+
+      lock_.unlock();
+      struct pollfd fds[2] = { { m_timer_fd, POLLIN, 0 }, { m_event_fd, POLLIN, 0 } };
+      poll(fds, 2, -1);
+
+      uint64_t value(0);
+      if (fds[0].revents & POLLIN) { ssize_t ret = read(m_timer_fd, &value, sizeof(value)); (void)ret; }
+      if (fds[1].revents & POLLIN) { ssize_t ret = read(m_event_fd, &value, sizeof(value)); (void)ret; }
+      lock_.lock();
+
+      m_wakeup    = false;
+      m_wait_tick = kNoTick;
+      return;
+    }
+#endif
+
+    auto wakeup = [this]() { return m_stop || m_wakeup; };
+    if (tick_ == kNoTick) m_tick_cv.wait(lock_, wakeup);
+    else                  m_tick_cv.wait_until(lock_, m_start_time + tick_duration(tick_), wakeup);
+
+    m_wakeup    = false;
+    m_wait_tick = kNoTick;
+  }
+
+  void CTimerWheel::JoinExitedWorkers(std::unique_lock<std::mutex>& lock_)
+  {
+    if (m_exited_workers.empty()) return;
+
+    std::list<std::thread> exited_workers;
+    exited_workers.swap(m_exited_workers);
+
+    // the exited workers may still need the lock to leave their loop
+    lock_.unlock();
+    for (auto& worker : exited_workers)
+    {
+      if (worker.joinable()) worker.join();
+    }
+    lock_.lock();
+  }
+
+  void CTimerWheel::WakeUpTickThread()
+  {
+    m_wakeup = true;
+
+#ifdef ECAL_OS_LINUX
+    if (m_event_fd >= 0)
+    {
+      const uint64_t value(1);
+      ssize_t ret = write(m_event_fd, &value, sizeof(value));
+      (void)ret;
+      return;
+    }
+#endif
+
+    m_tick_cv.notify_one();
+  }
+}
@@ -0,0 +1,176 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL process wide timer scheduler
+**/
+
+#pragma once
+
+#include <ecal/ecal_timer.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Hierarchical timer wheel, that executes the periodic callbacks of
+   *        all CTimer and CThread instances of the process.
+   *
+   * A single thread advances the wheel in ticks of 1 ms and hands due timers
+   * over to a pool of worker threads. The pool grows, if all workers are busy,
+   * so a blocking callback never delays other timers, and shrinks again to the
+   * configured size when workers have been idle for a while. A timer callback
+   * is never executed concurrently to itself, the next call is scheduled when
+   * the last one has finished. Missed periods are skipped and counted as
+   * overruns.
+  **/
+  class CTimerWheel
+  {
+  public:
+    typedef unsigned long long  TimerIdT;
+    typedef std::function<int()> CallbackT;
+
+    /**
+     * @brief Returns the process wide timer wheel, it is created on first use
+     *        and destroyed when the last user has released it. If this happens
+     *        in a timer callback, the wheel is destroyed by a separate thread,
+     *        as it cannot join its own threads.
+    **/
+    static std::shared_ptr<CTimerWheel> GetInstance();
+
+    CTimerWheel(size_t min_threads_, bool high_precision_);
+    ~CTimerWheel();
+
+    /**
+     * @brief Add a periodic timer.
+     *
+     * @param period_       Period of the callback.
+     * @param delay_        Delay of the first call.
+     * @param callback_     The callback. The timer is removed, if it returns a negative value.
+     * @param fixed_delay_  Schedule the next call one period after the last call has
+     *                      finished instead of one period after it was due.
+     *
+     * @return  Id of the timer, 0 on failure.
+    **/
+    TimerIdT Add(std::chrono::nanoseconds period_, std::chrono::nanoseconds delay_, CallbackT callback_, bool fixed_delay_ = false);
+
+    /**
+     * @brief Remove a timer. Waits for a running callback to finish, unless it is
+     *        called from the callback itself.
+    **/
+    bool Remove(TimerIdT id_);
+
+    /**
+     * @brief Execute the callback of a timer as soon as possible.
+    **/
+    bool Trigger(TimerIdT id_);
+
+    /**
+     * @brief Get the call and jitter statistics of a timer.
+    **/
+    bool GetStatistics(TimerIdT id_, STimerStatistics& stats_);
+
+  private:
+    typedef std::chrono::steady_clock clock;
+
+    struct STimer
+    {
+      STimer() : id(0), period_ticks(1), fixed_delay(false), due_tick(0), is_scheduled(false), is_running(false), is_removed(false), is_triggered(false), jitter_sum_us(0) {}
+
+      TimerIdT            id;
+      CallbackT           callback;
+      unsigned long long  period_ticks;
+      bool                fixed_delay;
+      unsigned long long  due_tick;
+      bool                is_scheduled;
+      bool                is_running;
+      bool                is_removed;
+      bool                is_triggered;
+      std::thread::id     running_thread;
+      STimerStatistics    stats;
+      long long           jitter_sum_us;
+    };
+    typedef std::shared_ptr<STimer> TimerPtrT;
+
+    // slots store the due tick, so entries of rescheduled timers can be detected
+    typedef std::vector<std::pair<TimerPtrT, unsigned long long>> SlotT;
+
+    static const size_t kLevelBits  = 6;
+    static const size_t kLevelSlots = 1 << kLevelBits;
+    static const size_t kLevelMask  = kLevelSlots - 1;
+    static const size_t kLevels     = 4;
+
+    static void Destroy(CTimerWheel* wheel_);
+
+    void Schedule(const TimerPtrT& timer_, unsigned long long due_tick_);
+    void Insert(const TimerPtrT& timer_, unsigned long long due_tick_);
+    void Advance(std::vector<TimerPtrT>& due_timers_);
+    unsigned long long NextEventTick() const;
+    unsigned long long NowTick() const;
+
+    void TickThread();
+    void WorkerThread();
+    void WaitForTick(std::unique_lock<std::mutex>& lock_, unsigned long long tick_);
+    void WakeUpTickThread();
+    void JoinExitedWorkers(std::unique_lock<std::mutex>& lock_);
+
+    std::mutex                                        m_mutex;
+    std::condition_variable                           m_tick_cv;
+    std::condition_variable                           m_work_cv;
+    std::condition_variable                           m_done_cv;
+
+    const clock::time_point                           m_start_time;
+    const size_t                                      m_min_threads;
+    const bool                                        m_high_precision;
+    bool                                              m_stop;
+    bool                                              m_wakeup;
+    unsigned long long                                m_wait_tick;
+
+    std::array<std::array<SlotT, kLevelSlots>, kLevels> m_wheel;
+    unsigned long long                                m_current_tick;
+    size_t                                            m_scheduled_count;
+
+    TimerIdT                                          m_next_id;
+    std::unordered_map<TimerIdT, TimerPtrT>           m_timers;
+
+    std::deque<std::pair<TimerPtrT, clock::time_point>> m_work_queue;
+    size_t                                            m_idle_workers;
+    std::list<std::thread>                            m_workers;
+    std::list<std::thread>                            m_exited_workers;
+    std::thread                                       m_tick_thread;
+
+#ifdef ECAL_OS_LINUX
+    int                                               m_timer_fd;
+    int                                               m_event_fd;
+#endif
+  };
+}
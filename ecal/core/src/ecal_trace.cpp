@@ -0,0 +1,231 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL hot path trace points
+**/
+
+#include <ecal/ecal.h>
+#include <ecal/ecal_config.h>
+
+#include "ecal_def.h"
+#include "ecal_trace.h"
+
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef ECAL_OS_LINUX
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+  const char* g_stage_names[eCAL::Trace::stage_count] =
+  {
+    "CDataWriter::Write",
+    "CSyncMemoryFile::SyncContent",
+    "CSyncMemoryFile::AckWait",
+    "CMemFileObserver::Observe",
+    "CSubGate::ApplySample",
+    "ReceiveCallback",
+  };
+
+  // one event of the ring buffer, the sequence is odd while the slot is written
+  // and 2 * (index + 1) when event number index has been written completely
+  struct SEventSlot
+  {
+    std::atomic<unsigned long long>  seq{0};
+    std::atomic<long long>           begin_ns{0};
+    std::atomic<long long>           end_ns{0};
+    std::atomic<unsigned long long>  hash{0};
+    std::atomic<long long>           clock{0};
+    std::atomic<unsigned char>       stage{eCAL::Trace::stage_count};
+  };
+
+  // events of one thread, written by this thread only
+  struct SThreadBuffer
+  {
+    explicit SThreadBuffer(unsigned long long tid_) : tid(tid_), events(EXP_TRACE_BUFFER_SIZE), write_count(0) {}
+
+    const unsigned long long            tid;
+    std::vector<SEventSlot>             events;
+    std::atomic<unsigned long long>     write_count;
+  };
+
+  // copies event number index_, fails if it has been overwritten in the meantime
+  bool ReadEvent(const SThreadBuffer& buffer_, unsigned long long index_, eCAL::Trace::SEvent& event_)
+  {
+    const SEventSlot& slot = buffer_.events[index_ % buffer_.events.size()];
+
+    const unsigned long long seq = slot.seq.load(std::memory_order_acquire);
+    if (seq != 2 * (index_ + 1)) return false;
+
+    event_.begin_ns = slot.begin_ns.load(std::memory_order_relaxed);
+    event_.end_ns   = slot.end_ns.load(std::memory_order_relaxed);
+    event_.hash     = slot.hash.load(std::memory_order_relaxed);
+    event_.clock    = slot.clock.load(std::memory_order_relaxed);
+    event_.stage    = static_cast<eCAL::Trace::eStage>(slot.stage.load(std::memory_order_relaxed));
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.seq.load(std::memory_order_relaxed) == seq;
+  }
+
+  // the buffers are kept after the thread terminated, so its events can still be exported
+  std::mutex& BuffersSync()
+  {
+    static std::mutex sync;
+    return sync;
+  }
+
+  std::vector<std::shared_ptr<SThreadBuffer>>& Buffers()
+  {
+    static std::vector<std::shared_ptr<SThreadBuffer>> buffers;
+    return buffers;
+  }
+
+  unsigned long long GetThreadId()
+  {
+#ifdef ECAL_OS_LINUX
+    return static_cast<unsigned long long>(syscall(SYS_gettid));
+#else
+    return static_cast<unsigned long long>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+  }
+
+  SThreadBuffer& GetThreadBuffer()
+  {
+    thread_local std::shared_ptr<SThreadBuffer> buffer = []()
+    {
+      auto new_buffer = std::make_shared<SThreadBuffer>(GetThreadId());
+      const std::lock_guard<std::mutex> lock(BuffersSync());
+      Buffers().push_back(new_buffer);
+      return new_buffer;
+    }();
+    return *buffer;
+  }
+
+  std::string EscapeJson(const std::string& str_)
+  {
+    std::string escaped;
+    for (const char c : str_)
+    {
+      if ((c == '"') || (c == '\\')) escaped += '\\';
+      if (static_cast<unsigned char>(c) < 0x20) continue;
+      escaped += c;
+    }
+    return escaped;
+  }
+}
+
+namespace eCAL
+{
+  namespace Trace
+  {
+    void Record(eStage stage_, long long begin_ns_, long long end_ns_, size_t hash_, long long clock_)
+    {
+      SThreadBuffer& buffer = GetThreadBuffer();
+
+      const unsigned long long count = buffer.write_count.load(std::memory_order_relaxed);
+      SEventSlot& slot = buffer.events[count % buffer.events.size()];
+
+      // the exporting thread may read this slot at the same time
+      slot.seq.store(2 * count + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      slot.begin_ns.store(begin_ns_,                         std::memory_order_relaxed);
+      slot.end_ns.store  (end_ns_,                           std::memory_order_relaxed);
+      slot.hash.store    (hash_,                             std::memory_order_relaxed);
+      slot.clock.store   (clock_,                            std::memory_order_relaxed);
+      slot.stage.store   (static_cast<unsigned char>(stage_), std::memory_order_relaxed);
+      slot.seq.store(2 * (count + 1), std::memory_order_release);
+
+      buffer.write_count.store(count + 1, std::memory_order_release);
+    }
+
+    bool Export(const std::string& file_name_)
+    {
+      std::ofstream file(file_name_);
+      if (!file.is_open()) return false;
+
+      const int         pid       = Process::GetProcessID();
+      const std::string host_name = EscapeJson(Process::GetHostName());
+      const std::string unit_name = EscapeJson(Process::GetUnitName());
+
+      // the merge tool relies on one event per line
+      file << "{\n";
+      file << "\"displayTimeUnit\": \"ns\",\n";
+      file << "\"otherData\": {\"host\": \"" << host_name << "\", \"pid\": " << pid << ", \"unit_name\": \"" << unit_name << "\", \"clock\": \"steady\"},\n";
+      file << "\"traceEvents\": [\n";
+      file << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << pid << ", \"args\": {\"name\": \"" << unit_name << " (" << host_name << ")\"}}";
+
+      file << std::fixed << std::setprecision(3);
+
+      std::vector<std::shared_ptr<SThreadBuffer>> buffers;
+      {
+        const std::lock_guard<std::mutex> lock(BuffersSync());
+        buffers = Buffers();
+      }
+
+      for (const auto& buffer : buffers)
+      {
+        // events of still running threads may be overwritten during the export,
+        // these are skipped
+        const unsigned long long count = buffer->write_count.load(std::memory_order_acquire);
+        const unsigned long long size  = buffer->events.size();
+        const unsigned long long first = (count > size) ? count - size : 0;
+
+        SEvent event;
+        for (unsigned long long i = first; i < count; ++i)
+        {
+          if (!ReadEvent(*buffer, i, event)) continue;
+          if (event.stage >= stage_count)    continue;
+
+          file << ",\n{\"name\": \"" << g_stage_names[event.stage] << "\", \"cat\": \"ecal\", \"ph\": \"X\"";
+          file << ", \"pid\": " << pid << ", \"tid\": " << buffer->tid;
+          file << ", \"ts\": "  << static_cast<double>(event.begin_ns) / 1000.0;
+          file << ", \"dur\": " << static_cast<double>(event.end_ns - event.begin_ns) / 1000.0;
+          // hashes exceed the precision of json numbers
+          file << ", \"args\": {\"hash\": \"" << event.hash << "\", \"clock\": " << event.clock << "}}";
+        }
+      }
+
+      file << "\n]\n}\n";
+
+      return file.good();
+    }
+
+    void ExportConfigured()
+    {
+      const std::string trace_file = Config::Experimental::GetTraceFile();
+      if (trace_file.empty()) return;
+
+      const std::string file_name = trace_file + "_" + Process::GetHostName() + "_" + std::to_string(Process::GetProcessID()) + ".json";
+      if (!Export(file_name))
+      {
+        Logging::Log(log_level_error, "Trace::ExportConfigured: could not write " + file_name);
+      }
+    }
+  }
+}
@@ -0,0 +1,122 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL hot path trace points
+ *
+ * The trace points are compiled in with the ECAL_CORE_TRACING option only,
+ * otherwise the macros expand to nothing. Every thread records its events
+ * into an own ring buffer, the buffers are exported as Chrome trace JSON
+ * (chrome://tracing, ui.perfetto.dev) on eCAL::Finalize.
+**/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace eCAL
+{
+  namespace Trace
+  {
+    enum eStage : unsigned char
+    {
+      stage_write = 0,
+      stage_shm_sync,
+      stage_shm_ack_wait,
+      stage_shm_observe,
+      stage_apply_sample,
+      stage_user_callback,
+      stage_count
+    };
+
+    struct SEvent
+    {
+      long long           begin_ns;
+      long long           end_ns;
+      unsigned long long  hash;
+      long long           clock;
+      eStage              stage;
+    };
+
+    inline long long Now()
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Add an event to the ring buffer of the calling thread.
+    **/
+    void Record(eStage stage_, long long begin_ns_, long long end_ns_, size_t hash_, long long clock_);
+
+    /**
+     * @brief Write the events of all threads as Chrome trace JSON.
+     *
+     * @param file_name_  Output file name.
+     *
+     * @return  True if succeeded.
+    **/
+    bool Export(const std::string& file_name_);
+
+    /**
+     * @brief Export to the file configured by experimental/trace_file, if set.
+     *        The host name and process id are appended to the file name.
+    **/
+    void ExportConfigured();
+
+    /**
+     * @brief Records the lifetime of the scope as event.
+    **/
+    class CScope
+    {
+    public:
+      explicit CScope(eStage stage_, size_t hash_ = 0, long long clock_ = 0) :
+        m_stage(stage_), m_hash(hash_), m_clock(clock_), m_begin_ns(Now()) {}
+
+      ~CScope()
+      {
+        Record(m_stage, m_begin_ns, Now(), m_hash, m_clock);
+      }
+
+      void SetSample(size_t hash_, long long clock_)
+      {
+        m_hash  = hash_;
+        m_clock = clock_;
+      }
+
+      CScope(const CScope&) = delete;
+      CScope& operator=(const CScope&) = delete;
+
+    private:
+      eStage     m_stage;
+      size_t     m_hash;
+      long long  m_clock;
+      long long  m_begin_ns;
+    };
+  }
+}
+
+#ifdef ECAL_CORE_TRACING
+#define ECAL_TRACE_SCOPE(var_, stage_, hash_, clock_)  eCAL::Trace::CScope var_(eCAL::Trace::stage_, hash_, clock_)
+#define ECAL_TRACE_SAMPLE(var_, hash_, clock_)         var_.SetSample(hash_, clock_)
+#else
+#define ECAL_TRACE_SCOPE(var_, stage_, hash_, clock_)
+#define ECAL_TRACE_SAMPLE(var_, hash_, clock_)
+#endif
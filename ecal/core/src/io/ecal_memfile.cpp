@@ -167,7 +167,7 @@ namespace eCAL
       m_memfile_mutex.DropOwnership();
 
     // destroy memory file
-    ret_state &= memfile::db::RemoveFile(m_name, remove_);
+    ret_state &= memfile::db::RemoveFile(m_name, remove_, m_memfile_info);
 
     // Destroy mutex
     m_memfile_mutex.Destroy();
@@ -353,6 +353,23 @@ namespace eCAL
     }
   }
 
+  bool CMemoryFile::Grow(const size_t len_)
+  {
+    if (!m_created)                                          return(false);
+    if (m_access_state != access_state::write_access)        return(false);
+    if (len_ <= static_cast<size_t>(m_header.max_data_size)) return(true);
+
+    // grow file and map it again
+    if (!memfile::db::GrowFile(m_name, static_cast<size_t>(m_header.int_hdr_size) + len_, m_memfile_info)) return(false);
+
+    // publish the new size, readers remap the file when they find it in the header
+    m_header.max_data_size = (unsigned long)len_;
+    SInternalHeader* pHeader = static_cast<SInternalHeader*>(m_memfile_info.mem_address);
+    pHeader->max_data_size = m_header.max_data_size;
+
+    return(true);
+  }
+
   bool CMemoryFile::GetAccess(int timeout_)
   {
     if (!m_created)                            return(false);
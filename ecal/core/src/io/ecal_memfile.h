@@ -155,6 +155,16 @@ namespace eCAL
     **/
     size_t WritePayload(CPayloadWriter& payload_, size_t len_, size_t offset_);
 
+    /**
+     * @brief Grow the memory file while keeping its name. Requires write access.
+     *        Connected readers map the larger file on their next access.
+     *
+     * @param len_     The new maximum data size.
+     *
+     * @return  true if it succeeds, false if the file can not grow on this platform.
+    **/
+    bool Grow(const size_t len_);
+
     /**
      * @brief Maximum data size of the whole memory file.
      *
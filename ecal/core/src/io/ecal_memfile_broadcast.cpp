@@ -35,7 +35,7 @@ namespace eCAL
 #pragma pack(push, 1)
   struct SMemfileBroadcastHeader
   {
-    std::uint32_t version = 1;
+    std::uint32_t version = 2;
     std::uint64_t message_queue_offset = sizeof(SMemfileBroadcastHeader);
     std::int64_t timestamp = CreateTimestamp();
     std::array<uint8_t, 4> _reserved_0 = {};
@@ -211,7 +211,7 @@ namespace eCAL
     return true;
   }
 
-  bool CMemoryFileBroadcast::SendEvent(std::uint64_t event_id, eMemfileBroadcastEventType type)
+  bool CMemoryFileBroadcast::SendEvent(std::uint64_t event_id, eMemfileBroadcastEventType type, std::uint64_t sequence)
   {
     if (!m_created) return false;
 
@@ -229,7 +229,7 @@ namespace eCAL
       m_event_queue.SetBaseAddress(GetEventQueueAddress(memfile_address));
       const auto timestamp = CreateTimestamp();
 
-      m_event_queue.Push({g_process_id, timestamp, event_id, type});
+      m_event_queue.Push({g_process_id, timestamp, event_id, type, sequence});
       GetMemfileHeader(memfile_address)->timestamp = timestamp;
 
       m_broadcast_memfile->ReleaseWriteAccess();
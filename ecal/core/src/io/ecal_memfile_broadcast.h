@@ -59,7 +59,7 @@ namespace eCAL
     EVENT_CREATED,
     EVENT_REMOVED,
     EVENT_UPDATED,
-    //EVENT_HEARTBEAT
+    EVENT_HEARTBEAT
   };
 
 #pragma pack(push, 1)
@@ -69,6 +69,7 @@ namespace eCAL
     std::int64_t timestamp;
     std::uint64_t event_id;
     eMemfileBroadcastEventType type;
+    std::uint64_t sequence;       // payload change counter of the writer, incremented with every payload update
   };
 #pragma pack(pop)
 
@@ -87,7 +88,7 @@ namespace eCAL
     bool FlushLocalEventQueue();
     bool FlushGlobalEventQueue();
 
-    bool SendEvent(std::uint64_t event_id, eMemfileBroadcastEventType type);
+    bool SendEvent(std::uint64_t event_id, eMemfileBroadcastEventType type, std::uint64_t sequence = 0);
     bool ReceiveEvents(MemfileBroadcastEventListT& event_list, std::int64_t timeout, bool enable_loopback = false);
 
   private:
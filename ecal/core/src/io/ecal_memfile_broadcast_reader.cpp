@@ -62,7 +62,7 @@ namespace eCAL
       decltype(m_payload_memfiles)::iterator iterator;
       bool is_new_payload_memfile {false};
       std::tie(iterator, is_new_payload_memfile) = m_payload_memfiles.insert(
-        {event_id, {std::make_shared<CMemoryFile>(), std::vector<char>(), 0}});
+        {event_id, {std::make_shared<CMemoryFile>(), std::vector<char>(), 0, 0}});
 
       auto &memfile_broadcast_payload = iterator->second;
       if (is_new_payload_memfile && broadcast_event->type != eMemfileBroadcastEventType::EVENT_REMOVED)
@@ -73,6 +73,7 @@ namespace eCAL
 #ifndef NDEBUG
           std::cerr << "Error opening payload memory file" << std::endl;
 #endif
+          m_payload_memfiles.erase(iterator);
           return_result = false;
           continue;
         }
@@ -83,7 +84,21 @@ namespace eCAL
       switch (broadcast_event->type)
       {
         case eMemfileBroadcastEventType::EVENT_UPDATED:
+        case eMemfileBroadcastEventType::EVENT_HEARTBEAT:
         {
+          // the buffered payload is still up to date, no need to read it again
+          if ((memfile_broadcast_payload.sequence != 0) && (memfile_broadcast_payload.sequence == broadcast_event->sequence))
+          {
+            memfile_broadcast_payload.timestamp = broadcast_event->timestamp;
+            memfile_broadcast_message_list.push_back({memfile_broadcast_payload.payload_memfile_buffer.data(),
+                                                      memfile_broadcast_payload.payload_memfile_buffer.size(),
+                                                      memfile_broadcast_payload.timestamp,
+                                                      event_id,
+                                                      eMemfileBroadcastEventType::EVENT_HEARTBEAT});
+            break;
+          }
+
+          // payload changed or not read so far (e.g. first heartbeat after joining)
           if (memfile_broadcast_payload.payload_memfile->GetReadAccess(EXP_MEMFILE_ACCESS_TIMEOUT)) {
             memfile_broadcast_payload.payload_memfile_buffer.resize(
               memfile_broadcast_payload.payload_memfile->CurDataSize());
@@ -92,10 +107,13 @@ namespace eCAL
                                                             0);
             memfile_broadcast_payload.payload_memfile->ReleaseReadAccess();
             memfile_broadcast_payload.timestamp = broadcast_event->timestamp;
+            memfile_broadcast_payload.sequence = broadcast_event->sequence;
 
             memfile_broadcast_message_list.push_back({memfile_broadcast_payload.payload_memfile_buffer.data(),
                                                               memfile_broadcast_payload.payload_memfile_buffer.size(),
-                                                              memfile_broadcast_payload.timestamp});
+                                                              memfile_broadcast_payload.timestamp,
+                                                              event_id,
+                                                              eMemfileBroadcastEventType::EVENT_UPDATED});
           }
           else
           {
@@ -109,6 +127,8 @@ namespace eCAL
         }
         case eMemfileBroadcastEventType::EVENT_REMOVED:
           m_payload_memfiles.erase(event_id);
+          if (!is_new_payload_memfile)
+            memfile_broadcast_message_list.push_back({nullptr, 0, broadcast_event->timestamp, event_id, eMemfileBroadcastEventType::EVENT_REMOVED});
           break;
         case eMemfileBroadcastEventType::EVENT_CREATED:
         default:
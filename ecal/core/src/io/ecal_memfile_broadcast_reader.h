@@ -33,10 +33,15 @@
 namespace eCAL
 {
   struct SMemfileBroadcastMessage
-    {
+  {
     const void *data;
     std::size_t size;
     std::int64_t timestamp;
+    std::uint64_t event_id;
+    // EVENT_UPDATED   : new payload
+    // EVENT_HEARTBEAT : payload unchanged since the last message of this event id
+    // EVENT_REMOVED   : payload memfile removed by the writer (no data)
+    eMemfileBroadcastEventType type;
   };
 
   typedef std::vector<SMemfileBroadcastMessage> MemfileBroadcastMessageListT;
@@ -48,6 +53,7 @@ namespace eCAL
       std::shared_ptr <CMemoryFile> payload_memfile;
       std::vector<char> payload_memfile_buffer;
       std::int64_t timestamp;
+      std::uint64_t sequence;     // sequence of the buffered payload, 0 if nothing has been read yet
     };
   public:
     bool Bind(CMemoryFileBroadcast *memfile_broadcast);
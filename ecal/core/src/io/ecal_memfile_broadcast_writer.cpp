@@ -74,7 +74,7 @@ namespace eCAL
     {
       m_payload_memfile->WriteBuffer(data, size, 0);
       m_payload_memfile->ReleaseWriteAccess();
-      m_memfile_broadcast->SendEvent(m_event_id, eMemfileBroadcastEventType::EVENT_UPDATED);
+      m_memfile_broadcast->SendEvent(m_event_id, eMemfileBroadcastEventType::EVENT_UPDATED, ++m_sequence);
 
       return true;
     }
@@ -89,6 +89,16 @@ namespace eCAL
     return false;
   }
 
+  bool CMemoryFileBroadcastWriter::Refresh()
+  {
+    if (!m_bound) return false;
+
+    // nothing valid written so far
+    if ((m_sequence == 0) || m_reset) return false;
+
+    return m_memfile_broadcast->SendEvent(m_event_id, eMemfileBroadcastEventType::EVENT_HEARTBEAT, m_sequence);
+  }
+
   void CMemoryFileBroadcastWriter::Unbind()
   {
     if (!m_bound) return;
@@ -97,6 +107,7 @@ namespace eCAL
     m_memfile_broadcast = nullptr;
     m_payload_memfile->Destroy(true);
     m_payload_memfile.reset();
+    m_sequence = 0;
     m_bound = false;
     m_reset = false;
   }
@@ -36,11 +36,15 @@ namespace eCAL
     bool Bind(CMemoryFileBroadcast *memfile_broadcast);
     void Unbind();
 
+    // writes a new payload, readers will read and parse it
     bool Write(const void *data, std::size_t size);
+    // confirms the last written payload without rewriting it, readers can keep their copy
+    bool Refresh();
   private:
     CMemoryFileBroadcast *m_memfile_broadcast = nullptr;
     std::unique_ptr<CMemoryFile> m_payload_memfile;
     std::uint64_t m_event_id = 0;
+    std::uint64_t m_sequence = 0;
     bool m_bound = false;
     bool m_reset = false;
   };
@@ -54,8 +54,19 @@ namespace eCAL
       memfile::os::DeAllocFile(memfile_info);
     }
 
-    // clear map
+    // unmap replaced mappings
+    for (auto& retired : m_retired_map)
+    {
+      for (auto& memfile_info : retired.second)
+      {
+        memfile::os::UnMapFile(memfile_info);
+      }
+    }
+
+    // clear maps
     m_memfile_map.clear();
+    m_retired_map.clear();
+    m_generation_users.clear();
   }
 
   bool CMemFileMap::AddFile(const std::string& name_, const bool create_, const size_t len_, SMemFileInfo& mem_file_info_)
@@ -85,6 +96,7 @@ namespace eCAL
       // and add to memory file map
       mem_file_info_.refcnt++;
       m_memfile_map[name_] = mem_file_info_;
+      m_generation_users[name_][mem_file_info_.generation]++;
     }
     else
     {
@@ -99,13 +111,14 @@ namespace eCAL
 
       // copy info from memory file map
       mem_file_info_ = iter->second;
+      m_generation_users[name_][mem_file_info_.generation]++;
     }
 
     // return success
     return(true);
   }
 
-  bool CMemFileMap::RemoveFile(const std::string& name_, const bool remove_)
+  bool CMemFileMap::RemoveFile(const std::string& name_, const bool remove_, const SMemFileInfo& mem_file_info_)
   {
     // lock memory map access
     const std::lock_guard<std::mutex> lock(m_memfile_map_mtx);
@@ -127,6 +140,7 @@ namespace eCAL
 
         // unmap memory file
         memfile::os::UnMapFile(memfile_info);
+        UnMapRetired(name_);
 
         // remove memory file from system
         if (remove_from_system) memfile::os::RemoveFile(memfile_info);
@@ -135,6 +149,14 @@ namespace eCAL
         memfile::os::DeAllocFile(memfile_info);
 
         memfile_map.erase(iter);
+        m_generation_users.erase(name_);
+      }
+      else
+      {
+        // the mapping used by this object may not be needed anymore
+        auto& generation_users = m_generation_users[name_];
+        generation_users[mem_file_info_.generation]--;
+        UnMapUnusedRetired(name_);
       }
 
       // we removed the file (or marked it for later removal)
@@ -146,18 +168,117 @@ namespace eCAL
 
   bool CMemFileMap::CheckFileSize(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_)
   {
-    // check and correct file size
-    memfile::os::CheckFileSize(len_, false, mem_file_info_);
+    // lock memory map access
+    const std::lock_guard<std::mutex> lock(m_memfile_map_mtx);
 
+    const MemFileMapT::iterator iter = m_memfile_map.find(name_);
+    if (iter == m_memfile_map.end())
+    {
+      // check and correct file size
+      memfile::os::CheckFileSize(len_, false, mem_file_info_);
+      return(true);
+    }
+
+    // the file may have been remapped already by another memory file object of this process,
+    // the old mapping can still be in use by other memory file objects, so we keep it
+    auto& memfile_info = iter->second;
+    if (len_ > memfile_info.size)
+    {
+      RetireMapping(name_, memfile_info);
+      memfile::os::CheckFileSize(len_, false, memfile_info);
+    }
+
+    // copy info from memory file map
+    const unsigned int old_generation = mem_file_info_.generation;
+    mem_file_info_ = memfile_info;
+    ChangeGeneration(name_, old_generation, mem_file_info_.generation);
+
+    return(true);
+  }
+
+  bool CMemFileMap::GrowFile(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_)
+  {
     // lock memory map access
     const std::lock_guard<std::mutex> lock(m_memfile_map_mtx);
 
-    // update/set info
-    m_memfile_map[name_] = mem_file_info_;
+    const MemFileMapT::iterator iter = m_memfile_map.find(name_);
+    if (iter == m_memfile_map.end()) return(false);
+
+    auto& memfile_info = iter->second;
+    if (len_ > memfile_info.size)
+    {
+      const SMemFileInfo old_memfile_info = memfile_info;
+      if (!memfile::os::GrowFile(len_, memfile_info)) return(false);
+      m_retired_map[name_].push_back(old_memfile_info);
+      memfile_info.generation++;
+    }
+
+    // copy info from memory file map
+    const unsigned int old_generation = mem_file_info_.generation;
+    mem_file_info_ = memfile_info;
+    ChangeGeneration(name_, old_generation, mem_file_info_.generation);
 
     return(true);
   }
 
+  void CMemFileMap::RetireMapping(const std::string& name_, SMemFileInfo& mem_file_info_)
+  {
+    if (mem_file_info_.mem_address == nullptr) return;
+
+    m_retired_map[name_].push_back(mem_file_info_);
+    mem_file_info_.mem_address = nullptr;
+    mem_file_info_.map_region  = MapRegionT();
+    mem_file_info_.generation++;
+  }
+
+  void CMemFileMap::ChangeGeneration(const std::string& name_, unsigned int old_generation_, unsigned int new_generation_)
+  {
+    if (old_generation_ == new_generation_) return;
+
+    // the object uses the new mapping from now on, it only remaps while
+    // holding the access lock, so it does not touch the old one anymore
+    auto& generation_users = m_generation_users[name_];
+    generation_users[old_generation_]--;
+    generation_users[new_generation_]++;
+    UnMapUnusedRetired(name_);
+  }
+
+  void CMemFileMap::UnMapUnusedRetired(const std::string& name_)
+  {
+    const RetiredMapT::iterator iter = m_retired_map.find(name_);
+    if (iter == m_retired_map.end()) return;
+
+    auto& generation_users = m_generation_users[name_];
+    auto& retired          = iter->second;
+    for (auto retired_it = retired.begin(); retired_it != retired.end();)
+    {
+      const auto users_it = generation_users.find(retired_it->generation);
+      if ((users_it == generation_users.end()) || (users_it->second <= 0))
+      {
+        memfile::os::UnMapFile(*retired_it);
+        if (users_it != generation_users.end()) generation_users.erase(users_it);
+        retired_it = retired.erase(retired_it);
+      }
+      else
+      {
+        ++retired_it;
+      }
+    }
+    if (retired.empty()) m_retired_map.erase(iter);
+  }
+
+  void CMemFileMap::UnMapRetired(const std::string& name_)
+  {
+    const RetiredMapT::iterator iter = m_retired_map.find(name_);
+    if (iter == m_retired_map.end()) return;
+
+    for (auto& memfile_info : iter->second)
+    {
+      memfile::os::UnMapFile(memfile_info);
+    }
+    m_retired_map.erase(iter);
+  }
+
   namespace memfile
   {
     namespace db
@@ -168,10 +289,10 @@ namespace eCAL
         return g_memfile_map()->AddFile(name_, create_, len_, mem_file_info_);
       }
 
-      bool RemoveFile(const std::string& name_, const bool remove_)
+      bool RemoveFile(const std::string& name_, const bool remove_, const SMemFileInfo& mem_file_info_)
       {
         if (!g_memfile_map()) return false;
-        return g_memfile_map()->RemoveFile(name_, remove_);
+        return g_memfile_map()->RemoveFile(name_, remove_, mem_file_info_);
       }
 
       bool CheckFileSize(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_)
@@ -179,6 +300,12 @@ namespace eCAL
         if (!g_memfile_map()) return false;
         return g_memfile_map()->CheckFileSize(name_, len_, mem_file_info_);
       }
+
+      bool GrowFile(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_)
+      {
+        if (!g_memfile_map()) return false;
+        return g_memfile_map()->GrowFile(name_, len_, mem_file_info_);
+      }
     }
   }
 }
@@ -23,9 +23,11 @@
 
 #pragma once
 
+#include <map>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "ecal_memfile_info.h"
 
@@ -40,13 +42,28 @@ namespace eCAL
     void Destroy();
 
     bool AddFile(const std::string& name_, const bool create_, const size_t len_, SMemFileInfo& mem_file_info_);
-    bool RemoveFile(const std::string& name_, const bool remove_);
+    bool RemoveFile(const std::string& name_, const bool remove_, const SMemFileInfo& mem_file_info_);
     bool CheckFileSize(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_);
+    bool GrowFile(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_);
 
   protected:
+    void RetireMapping(const std::string& name_, SMemFileInfo& mem_file_info_);
+    void ChangeGeneration(const std::string& name_, unsigned int old_generation_, unsigned int new_generation_);
+    void UnMapUnusedRetired(const std::string& name_);
+    void UnMapRetired(const std::string& name_);
+
     typedef std::unordered_map<std::string, SMemFileInfo> MemFileMapT;
     std::mutex  m_memfile_map_mtx;
     MemFileMapT m_memfile_map;
+
+    // mappings replaced by a larger one, memory file objects of this process may
+    // still use them, so they are released when no object uses their generation
+    typedef std::unordered_map<std::string, std::vector<SMemFileInfo>> RetiredMapT;
+    RetiredMapT m_retired_map;
+
+    // number of memory file objects per mapping generation of a file
+    typedef std::unordered_map<std::string, std::map<unsigned int, int>> GenerationUsersMapT;
+    GenerationUsersMapT m_generation_users;
   };
 
   namespace memfile
@@ -54,9 +71,10 @@ namespace eCAL
     namespace db
     {
       bool AddFile(const std::string& name_, const bool create_, const size_t len_, SMemFileInfo& mem_file_info_);
-      bool RemoveFile(const std::string& name_, const bool remove_);
+      bool RemoveFile(const std::string& name_, const bool remove_, const SMemFileInfo& mem_file_info_);
 
       bool CheckFileSize(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_);
+      bool GrowFile(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_);
     }
   }
 }
@@ -57,6 +57,7 @@ namespace eCAL
       mem_address = 0;
       size        = 0;
       exists      = false;
+      generation  = 0;
     }
     int          refcnt;
     bool         remove;
@@ -66,5 +67,6 @@ namespace eCAL
     std::string  name;
     size_t       size;
     bool         exists;
+    unsigned int generation;
   };
 }
@@ -41,6 +41,9 @@ namespace eCAL
       bool UnMapFile(SMemFileInfo& mem_file_info_);
 
       bool CheckFileSize(const size_t len_, const bool create_, SMemFileInfo& mem_file_info_);
+
+      // grow a created memory file and map it again, the old mapping stays valid
+      bool GrowFile(const size_t len_, SMemFileInfo& mem_file_info_);
     }
   }
 }
@@ -24,6 +24,8 @@
 
 #include "ecal_def.h"
 #include "ecal_memfile_pool.h"
+#include "ecal_thread_registry.h"
+#include "ecal_trace.h"
 
 #include <chrono>
 
@@ -144,6 +146,8 @@ namespace eCAL
 
   void CMemFileObserver::Observe(const std::string& topic_name_, const std::string& topic_id_, const int timeout_)
   {
+    const CThreadScope thread_scope(thread_class_shm_observer);
+
     // internal clock sample update checking
     uint64_t last_sample_clock(0);
 
@@ -162,12 +166,15 @@ namespace eCAL
         // last chance to stop ..
         if(m_do_stop) break;
 
+        ECAL_TRACE_SCOPE(trace_observe, stage_shm_observe, 0, 0);
+
         // try to open memory file (timeout 5 ms)
         if(m_memfile.GetReadAccess(5))
         {
           // read the file header
           SMemFileHeader mfile_hdr;
           ReadFileHeader(mfile_hdr);
+          ECAL_TRACE_SAMPLE(trace_observe, static_cast<size_t>(mfile_hdr.hash), static_cast<long long>(mfile_hdr.clock));
 
           // check for new content
           if (mfile_hdr.clock <= last_sample_clock)
@@ -382,6 +389,8 @@ namespace eCAL
 
   void CMemFileThreadPool::CleanupPoolThread()
   {
+    const CThreadScope thread_scope(thread_class_shm_observer);
+
     for (;;)
     {
       {
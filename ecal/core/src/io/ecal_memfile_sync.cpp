@@ -27,6 +27,7 @@
 #include "ecal_memfile_header.h"
 #include "ecal_memfile_naming.h"
 #include "ecal_memfile_sync.h"
+#include "ecal_trace.h"
 
 #include <chrono>
 #include <sstream>
@@ -109,16 +110,26 @@ namespace eCAL
   {
     if (!m_created) return false;
 
-    // we recreate a memory file if the file size is too small
+    // we grow or recreate a memory file if the file size is too small
     const bool file_to_small = m_memfile.MaxDataSize() < (sizeof(SMemFileHeader) + size_);
     if (file_to_small)
     {
-#ifndef NDEBUG
-      Logging::Log(log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - RECREATE");
-#endif
       // estimate size of memory file
       const size_t memfile_size = sizeof(SMemFileHeader) + size_ + static_cast<size_t>((static_cast<float>(m_attr.reserve) / 100.0f) * static_cast<float>(size_));
 
+      // grow the file in place, the name does not change
+      // so there is no need to inform the subscribers
+      if (Grow(memfile_size))
+      {
+#ifndef NDEBUG
+        Logging::Log(log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - GROW");
+#endif
+        return false;
+      }
+
+#ifndef NDEBUG
+      Logging::Log(log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - RECREATE");
+#endif
       // recreate the file
       if (!Recreate(memfile_size)) return false;
 
@@ -322,10 +333,24 @@ namespace eCAL
     return true;
   }
 
+  bool CSyncMemoryFile::Grow(size_t size_)
+  {
+    // subscribers may still read the current content, so we need write access
+    if (!m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms))) return false;
+
+    const bool grown = m_memfile.Grow(size_);
+
+    m_memfile.ReleaseWriteAccess();
+
+    return grown;
+  }
+
   void CSyncMemoryFile::SyncContent()
   {
     if (!m_created) return;
 
+    ECAL_TRACE_SCOPE(trace_sync, stage_shm_sync, 0, 0);
+
     // fire the publisher events
     // connected subscribers will read the content from the memory file
 
@@ -350,6 +375,8 @@ namespace eCAL
     // wait for acknowledgment event from receiver side
     if (m_attr.timeout_ack_ms != 0)
     {
+      ECAL_TRACE_SCOPE(trace_ack_wait, stage_shm_ack_wait, 0, 0);
+
       // take start time for all acknowledge timeouts
       const auto start_time = std::chrono::steady_clock::now();
 
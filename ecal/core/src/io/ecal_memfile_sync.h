@@ -62,6 +62,7 @@ namespace eCAL
     bool Create(const std::string& base_name_, size_t size_);
     bool Destroy();
     bool Recreate(size_t size_);
+    bool Grow(size_t size_);
 
     void SyncContent();
     void DisconnectAll();
@@ -175,6 +175,37 @@ namespace eCAL
 
         return(true);
       }
+
+      bool GrowFile(const size_t len_, SMemFileInfo& mem_file_info_)
+      {
+        if (mem_file_info_.memfile == 0) return(false);
+
+        size_t len = len_;
+        if (len < (size_t)sysconf(_SC_PAGE_SIZE))
+        {
+          len = sysconf(_SC_PAGE_SIZE);
+        }
+        if (len <= mem_file_info_.size) return(true);
+
+        // growing the file keeps its content and all existing mappings
+        if (::ftruncate(mem_file_info_.memfile, len) != 0)
+        {
+          std::cout << "ftruncate failed : " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+          return(false);
+        }
+
+        void* mem_address = ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED, mem_file_info_.memfile, 0);
+        if (mem_address == MAP_FAILED)
+        {
+          std::cout << "mmap failed : " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+          return(false);
+        }
+
+        mem_file_info_.mem_address = mem_address;
+        mem_file_info_.size        = len;
+
+        return(true);
+      }
     }
   }
 }
@@ -129,6 +129,12 @@ namespace eCAL
 
         return(mem_file_info_.mem_address != nullptr);
       }
+
+      bool GrowFile(const size_t /*len_*/, SMemFileInfo& /*mem_file_info_*/)
+      {
+        // the size of a file mapping object is fixed on creation
+        return(false);
+      }
     }
   }
 }
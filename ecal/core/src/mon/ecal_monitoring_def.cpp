@@ -73,6 +73,11 @@ namespace eCAL
     m_monitoring_impl->GetMonitoringStructs(monitoring_, entities_);
   }
 
+  void CMonitoring::GetMonitoring(eCAL::Monitoring::SMonitoring& monitoring_, const Monitoring::SMonitoringQuery& query_)
+  {
+    m_monitoring_impl->GetMonitoringStructs(monitoring_, query_);
+  }
+
   void CMonitoring::GetLogging(eCAL::pb::Logging& logging_)
   {
     m_monitoring_impl->GetLogging(logging_);
@@ -145,6 +150,16 @@ namespace eCAL
       return(0);
     }
 
+    int GetMonitoring(eCAL::Monitoring::SMonitoring& mon_, const SMonitoringQuery& query_)
+    {
+      if (g_monitoring() != nullptr)
+      {
+        g_monitoring()->GetMonitoring(mon_, query_);
+        return(static_cast<int>(mon_.process.size() + mon_.publisher.size() + mon_.subscriber.size() + mon_.server.size() + mon_.clients.size()));
+      }
+      return(0);
+    }
+
     int GetLogging(std::string& log_)
     {
       eCAL::pb::Logging logging;
@@ -57,6 +57,7 @@ namespace eCAL
 
     void GetMonitoring(eCAL::pb::Monitoring& monitoring_, unsigned int entities_ = Monitoring::Entity::All);
     void GetMonitoring(eCAL::Monitoring::SMonitoring& monitoring_, unsigned int entities_ = Monitoring::Entity::All);
+    void GetMonitoring(eCAL::Monitoring::SMonitoring& monitoring_, const Monitoring::SMonitoringQuery& query_);
     void GetLogging(eCAL::pb::Logging& logging_);
 
     int PubMonitoring(bool state_, std::string& name_);
@@ -26,10 +26,12 @@
 
 #include "ecal_config_reader_hlp.h"
 #include "ecal_monitoring_impl.h"
+#include "ecal_monitoring_query.h"
 
 #include <regex>
 
 #include "../ecal_registration_receiver.h"
+#include "../readwrite/ecal_latency_histogram.h"
 
 namespace
 {
@@ -266,6 +268,7 @@ namespace eCAL
     const long long    dclock          = sample_topic.dclock();
     const long long    message_drops   = sample_topic.message_drops();
     const long         dfreq           = sample_topic.dfreq();
+    const long long    drate           = sample_topic.drate();
 
     // check blacklist topic filter
     {
@@ -357,6 +360,9 @@ namespace eCAL
       TopicInfo.dclock             = dclock;
       TopicInfo.message_drops      = message_drops;
       TopicInfo.dfreq              = dfreq;
+      TopicInfo.drate              = drate;
+      PbToLatencyStatistics(sample_topic.latency(),           TopicInfo.latency);
+      PbToLatencyStatistics(sample_topic.callback_duration(), TopicInfo.callback_duration);
     }
 
     return(true);
@@ -438,6 +444,18 @@ namespace eCAL
     ProcessInfo.component_init_info  = component_init_info;
     ProcessInfo.ecal_runtime_version = ecal_runtime_version;
 
+    ProcessInfo.threads.clear();
+    for (const auto& thread : sample_process.threads())
+    {
+      Monitoring::SThreadMon thread_mon;
+      thread_mon.name     = thread.name();
+      thread_mon.tid      = thread.tid();
+      thread_mon.affinity = thread.affinity();
+      thread_mon.priority = thread.priority();
+      thread_mon.cpu_time = thread.cpu_time();
+      ProcessInfo.threads.push_back(thread_mon);
+    }
+
     return(true);
   }
 
@@ -632,99 +650,57 @@ namespace eCAL
 
   void CMonitoringImpl::GetMonitoringStructs(eCAL::Monitoring::SMonitoring& monitoring_, unsigned int entities_)
   {
-    if ((entities_ & Monitoring::Entity::Process) != 0u)
-    {
-      // clear target
-      monitoring_.process.clear();
-
-      // lock map
-      const std::lock_guard<std::mutex> lock(m_process_map.sync);
-
-      // reserve target
-      monitoring_.process.reserve(m_process_map.map->size());
+    Monitoring::SMonitoringQuery query;
+    query.entities = entities_;
+    GetMonitoringStructs(monitoring_, query);
+  }
 
-      // iterate map
-      m_process_map.map->remove_deprecated();
-      for (const auto& process : (*m_process_map.map))
-      {
-        monitoring_.process.emplace_back(process.second);
-      }
+  void CMonitoringImpl::GetMonitoringStructs(eCAL::Monitoring::SMonitoring& monitoring_, const eCAL::Monitoring::SMonitoringQuery& query_)
+  {
+    if ((query_.entities & Monitoring::Entity::Process) != 0u)
+    {
+      QueryMap(m_process_map, monitoring_.process, query_);
     }
 
-    if ((entities_ & Monitoring::Entity::Publisher) != 0u)
+    if ((query_.entities & Monitoring::Entity::Publisher) != 0u)
     {
-      // clear target
-      monitoring_.publisher.clear();
-
-      // lock map
-      const std::lock_guard<std::mutex> lock(m_publisher_map.sync);
-
-      // reserve target
-      monitoring_.publisher.reserve(m_publisher_map.map->size());
-
-      // iterate map
-      m_publisher_map.map->remove_deprecated();
-      for (const auto& publisher : (*m_publisher_map.map))
-      {
-        monitoring_.publisher.emplace_back(publisher.second);
-      }
+      QueryMap(m_publisher_map, monitoring_.publisher, query_);
     }
 
-    if ((entities_ & Monitoring::Entity::Subscriber) != 0u)
+    if ((query_.entities & Monitoring::Entity::Subscriber) != 0u)
     {
-      // clear target
-      monitoring_.subscriber.clear();
-
-      // lock map
-      const std::lock_guard<std::mutex> lock(m_subscriber_map.sync);
-
-      // reserve target
-      monitoring_.subscriber.reserve(m_subscriber_map.map->size());
-
-      // iterate map
-      m_subscriber_map.map->remove_deprecated();
-      for (const auto& subscriber : (*m_subscriber_map.map))
-      {
-        monitoring_.subscriber.emplace_back(subscriber.second);
-      }
+      QueryMap(m_subscriber_map, monitoring_.subscriber, query_);
     }
 
-    if ((entities_ & Monitoring::Entity::Server) != 0u)
+    if ((query_.entities & Monitoring::Entity::Server) != 0u)
     {
-      // clear target
-      monitoring_.server.clear();
-
-      // lock map
-      const std::lock_guard<std::mutex> lock(m_server_map.sync);
-
-      // reserve target
-      monitoring_.server.reserve(m_server_map.map->size());
-
-      // iterate map
-      m_server_map.map->remove_deprecated();
-      for (const auto& server : (*m_server_map.map))
-      {
-        monitoring_.server.emplace_back(server.second);
-      }
+      QueryMap(m_server_map, monitoring_.server, query_);
     }
 
-    if ((entities_ & Monitoring::Entity::Client) != 0u)
+    if ((query_.entities & Monitoring::Entity::Client) != 0u)
     {
-      // clear target
-      monitoring_.clients.clear();
+      QueryMap(m_clients_map, monitoring_.clients, query_);
+    }
+  }
+
+  template <typename MapT, typename T>
+  void CMonitoringImpl::QueryMap(MapT& map_, std::vector<T>& target_, const eCAL::Monitoring::SMonitoringQuery& query_)
+  {
+    // clear target
+    target_.clear();
 
-      // lock map
-      const std::lock_guard<std::mutex> lock(m_clients_map.sync);
+    // lock map
+    const std::lock_guard<std::mutex> lock(map_.sync);
 
-      // reserve target
-      monitoring_.clients.reserve(m_clients_map.map->size());
+    // iterate map, the entities are accessed in place and only the matching ones are copied
+    map_.map->remove_deprecated();
+    for (auto iter = map_.map->begin(); iter != map_.map->end(); ++iter)
+    {
+      T& entity = iter.value();
+      if (!Monitoring::MatchQuery(entity, query_)) continue;
 
-      // iterate map
-      m_clients_map.map->remove_deprecated();
-      for (const auto& client : (*m_clients_map.map))
-      {
-        monitoring_.clients.emplace_back(client.second);
-      }
+      target_.emplace_back();
+      Monitoring::CopyMasked(entity, target_.back(), query_.fields);
     }
   }
 
@@ -837,6 +813,17 @@ namespace eCAL
 
       // eCAL component runtime version
       pMonProcs->set_ecal_runtime_version(process.second.ecal_runtime_version);
+
+      // eCAL internal threads
+      for (const auto& thread : process.second.threads)
+      {
+        auto* pThread = pMonProcs->add_threads();
+        pThread->set_name(thread.name);
+        pThread->set_tid(thread.tid);
+        pThread->set_affinity(thread.affinity);
+        pThread->set_priority(thread.priority);
+        pThread->set_cpu_time(thread.cpu_time);
+      }
     }
   }
 
@@ -1026,6 +1013,13 @@ namespace eCAL
 
       // data frequency
       pMonTopic->set_dfreq(topic.second.dfreq);
+
+      // data rate
+      pMonTopic->set_drate(topic.second.drate);
+
+      // latency statistics
+      if (topic.second.latency.count > 0)           LatencyStatisticsToPb(topic.second.latency,           *pMonTopic->mutable_latency());
+      if (topic.second.callback_duration.count > 0) LatencyStatisticsToPb(topic.second.callback_duration, *pMonTopic->mutable_callback_duration());
     }
   }
 
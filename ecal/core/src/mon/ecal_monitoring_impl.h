@@ -54,6 +54,7 @@ namespace eCAL
 
     void GetMonitoringPb(eCAL::pb::Monitoring& monitoring_, unsigned int entities_);
     void GetMonitoringStructs(eCAL::Monitoring::SMonitoring& monitoring_, unsigned int entities_);
+    void GetMonitoringStructs(eCAL::Monitoring::SMonitoring& monitoring_, const eCAL::Monitoring::SMonitoringQuery& query_);
     void GetLogging(eCAL::pb::Logging& logging_);
 
     int PubMonitoring(bool state_, std::string& name_);
@@ -144,6 +145,9 @@ namespace eCAL
 
     STopicMonMap* GetMap(enum ePubSub pubsub_type_);
 
+    template <typename MapT, typename T>
+    void QueryMap(MapT& map_, std::vector<T>& target_, const eCAL::Monitoring::SMonitoringQuery& query_);
+
     void MonitorProcs(eCAL::pb::Monitoring& monitoring_);
     void MonitorServer(eCAL::pb::Monitoring& monitoring_);
     void MonitorClients(eCAL::pb::Monitoring& monitoring_);
@@ -0,0 +1,104 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Monitoring query filters and field masks
+**/
+
+#include "ecal_monitoring_query.h"
+
+#include <utility>
+
+namespace
+{
+  bool MatchProcess(const std::string& hname_, int pid_, const std::string& pname_, const std::string& uname_, const eCAL::Monitoring::SMonitoringQuery& query_)
+  {
+    if (!query_.host_name.empty()    && (query_.host_name    != hname_)) return(false);
+    if ((query_.process_id != 0)     && (query_.process_id   != pid_))   return(false);
+    if (!query_.process_name.empty() && (query_.process_name != pname_)) return(false);
+    if (!query_.unit_name.empty()    && (query_.unit_name    != uname_)) return(false);
+    return(true);
+  }
+
+  bool MatchName(const std::string& name_, const eCAL::Monitoring::SMonitoringQuery& query_)
+  {
+    return(query_.topic_name.empty() || (query_.topic_name == name_));
+  }
+}
+
+namespace eCAL
+{
+  namespace Monitoring
+  {
+    bool MatchQuery(const SProcessMon& process_, const SMonitoringQuery& query_)
+    {
+      return(MatchProcess(process_.hname, process_.pid, process_.pname, process_.uname, query_));
+    }
+
+    bool MatchQuery(const STopicMon& topic_, const SMonitoringQuery& query_)
+    {
+      return(MatchProcess(topic_.hname, topic_.pid, topic_.pname, topic_.uname, query_) && MatchName(topic_.tname, query_));
+    }
+
+    bool MatchQuery(const SServerMon& server_, const SMonitoringQuery& query_)
+    {
+      return(MatchProcess(server_.hname, server_.pid, server_.pname, server_.uname, query_) && MatchName(server_.sname, query_));
+    }
+
+    bool MatchQuery(const SClientMon& client_, const SMonitoringQuery& query_)
+    {
+      return(MatchProcess(client_.hname, client_.pid, client_.pname, client_.uname, query_) && MatchName(client_.sname, query_));
+    }
+
+    void SwapMaskedFields(SProcessMon& a_, SProcessMon& b_, unsigned int fields_)
+    {
+      if ((fields_ & Field::ProcessThreads) == 0u) std::swap(a_.threads, b_.threads);
+    }
+
+    void SwapMaskedFields(STopicMon& a_, STopicMon& b_, unsigned int fields_)
+    {
+      if ((fields_ & Field::TopicDescriptor) == 0u) std::swap(a_.tinfo.descriptor, b_.tinfo.descriptor);
+      if ((fields_ & Field::TopicAttributes) == 0u) std::swap(a_.attr, b_.attr);
+      if ((fields_ & Field::TopicStatistics) == 0u)
+      {
+        std::swap(a_.latency,           b_.latency);
+        std::swap(a_.callback_duration, b_.callback_duration);
+      }
+    }
+
+    void SwapMaskedFields(SServerMon& a_, SServerMon& b_, unsigned int fields_)
+    {
+      if ((fields_ & Field::MethodDescriptors) == 0u)
+      {
+        // the method list itself is kept, only the descriptors are swapped
+        b_.methods.resize(a_.methods.size());
+        for (size_t i = 0; i < a_.methods.size(); ++i)
+        {
+          std::swap(a_.methods[i].req_desc,  b_.methods[i].req_desc);
+          std::swap(a_.methods[i].resp_desc, b_.methods[i].resp_desc);
+        }
+      }
+    }
+
+    void SwapMaskedFields(SClientMon& /*a_*/, SClientMon& /*b_*/, unsigned int /*fields_*/)
+    {
+      // clients have no optional members
+    }
+  }
+}
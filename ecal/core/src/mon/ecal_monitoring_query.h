@@ -0,0 +1,69 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Monitoring query filters and field masks
+**/
+
+#pragma once
+
+#include <ecal/ecal_monitoring_struct.h>
+
+namespace eCAL
+{
+  namespace Monitoring
+  {
+    /**
+     * @brief Checks the host, process and topic / service name filters of a query.
+    **/
+    bool MatchQuery(const SProcessMon& process_, const SMonitoringQuery& query_);
+    bool MatchQuery(const STopicMon&   topic_,   const SMonitoringQuery& query_);
+    bool MatchQuery(const SServerMon&  server_,  const SMonitoringQuery& query_);
+    bool MatchQuery(const SClientMon&  client_,  const SMonitoringQuery& query_);
+
+    /**
+     * @brief Swaps the members that are not part of the field mask between the two structs.
+     *
+     * Swapping them into an empty struct before copying an entity and back afterwards
+     * copies the entity without its masked members and without modifying it.
+    **/
+    void SwapMaskedFields(SProcessMon& a_, SProcessMon& b_, unsigned int fields_);
+    void SwapMaskedFields(STopicMon&   a_, STopicMon&   b_, unsigned int fields_);
+    void SwapMaskedFields(SServerMon&  a_, SServerMon&  b_, unsigned int fields_);
+    void SwapMaskedFields(SClientMon&  a_, SClientMon&  b_, unsigned int fields_);
+
+    /**
+     * @brief Copies an entity without the members that are not part of the field mask.
+    **/
+    template <typename T>
+    void CopyMasked(T& source_, T& target_, unsigned int fields_)
+    {
+      if (fields_ == Field::All)
+      {
+        target_ = source_;
+        return;
+      }
+
+      T masked;
+      SwapMaskedFields(source_, masked, fields_);
+      target_ = source_;
+      SwapMaskedFields(source_, masked, fields_);
+    }
+  }
+}
@@ -62,7 +62,7 @@ namespace eCAL
     attr.rcvbuf   = Config::GetUdpMulticastRcvBufSizeBytes();
 
     m_log_rcv.Create(attr);
-    m_log_rcv_thread.Start(0, std::bind(&CLoggingReceiveThread::ThreadFun, this));
+    m_log_rcv_thread.Start(0, std::bind(&CLoggingReceiveThread::ThreadFun, this), thread_class_monitoring);
     m_msg_buffer.resize(MSG_BUFFER_SIZE);
   }
 
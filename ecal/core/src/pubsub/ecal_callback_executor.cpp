@@ -0,0 +1,252 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL subscriber callback executor
+**/
+
+#include "ecal_callback_executor_impl.h"
+#include "ecal_thread_registry.h"
+#include "readwrite/ecal_reader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace eCAL
+{
+  ////////////////////////////////////////
+  // CCallbackExecutor
+  ////////////////////////////////////////
+  CCallbackExecutor::CCallbackExecutor(const SCallbackExecutorConfig& config_) :
+    m_impl(std::make_shared<CCallbackExecutorImpl>(config_))
+  {
+  }
+
+  CCallbackExecutor::~CCallbackExecutor() = default;
+
+  SCallbackExecutorConfig CCallbackExecutor::GetConfig() const
+  {
+    return(m_impl->GetConfig());
+  }
+
+  SCallbackExecutorStatistics CCallbackExecutor::GetStatistics() const
+  {
+    return(m_impl->GetStatistics());
+  }
+
+  ////////////////////////////////////////
+  // CCallbackExecutorImpl
+  ////////////////////////////////////////
+  namespace
+  {
+    SCallbackExecutorConfig ValidateConfig(SCallbackExecutorConfig config_)
+    {
+      config_.thread_count = std::max(config_.thread_count, 1);
+      config_.queue_size   = std::max(config_.queue_size, size_t(1));
+      return(config_);
+    }
+  }
+
+  CCallbackExecutorImpl::SWorker::SWorker(const SCallbackExecutorConfig& config_) :
+    config(config_),
+    queue(config_.queue_size),
+    head(0),
+    count(0),
+    running(nullptr),
+    stop(false),
+    depth_max(0),
+    executed(0),
+    dropped(0),
+    blocked(0)
+  {
+  }
+
+  CCallbackExecutorImpl::CCallbackExecutorImpl(const SCallbackExecutorConfig& config_) :
+    m_config(ValidateConfig(config_)),
+    m_next_worker(0)
+  {
+    for (int i = 0; i < m_config.thread_count; ++i)
+    {
+      auto worker = std::make_shared<SWorker>(m_config);
+      m_workers.push_back(worker);
+      m_threads.emplace_back(&CCallbackExecutorImpl::Run, worker);
+    }
+  }
+
+  CCallbackExecutorImpl::~CCallbackExecutorImpl()
+  {
+    for (auto& worker : m_workers)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(worker->sync);
+        worker->stop = true;
+      }
+      worker->not_empty_cv.notify_all();
+      worker->not_full_cv.notify_all();
+    }
+
+    for (auto& thread : m_threads)
+    {
+      // the last reference may be released by a callback running on this worker
+      if (thread.get_id() == std::this_thread::get_id()) thread.detach();
+      else                                               thread.join();
+    }
+  }
+
+  size_t CCallbackExecutorImpl::Attach()
+  {
+    const std::lock_guard<std::mutex> lock(m_attach_sync);
+    const size_t worker = m_next_worker;
+    m_next_worker = (m_next_worker + 1) % m_workers.size();
+    return(worker);
+  }
+
+  bool CCallbackExecutorImpl::Post(size_t worker_, CDataReader* reader_, const std::atomic<bool>& cancel_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_)
+  {
+    SWorker& worker = *m_workers[worker_ % m_workers.size()];
+
+    std::unique_lock<std::mutex> lock(worker.sync);
+    if (worker.stop) return(false);
+
+    const size_t queue_size = worker.queue.size();
+    if (worker.count == queue_size)
+    {
+      switch (worker.config.overflow_policy)
+      {
+      case callback_overflow_drop_oldest:
+        worker.head = (worker.head + 1) % queue_size;
+        worker.count--;
+        worker.dropped++;
+        break;
+      case callback_overflow_block:
+        // a callback publishing to a subscriber of its own worker would wait forever
+        if (std::this_thread::get_id() != worker.thread_id)
+        {
+          worker.blocked++;
+          // the reader may be destroyed meanwhile by a callback of this worker, so check for cancellation from time to time
+          while ((worker.count == queue_size) && !worker.stop && !cancel_)
+          {
+            worker.not_full_cv.wait_for(lock, std::chrono::milliseconds(10));
+          }
+          if (worker.stop || cancel_) return(false);
+          break;
+        }
+        worker.dropped++;
+        return(false);
+      case callback_overflow_drop_newest:
+      default:
+        worker.dropped++;
+        return(false);
+      }
+    }
+
+    SSample& sample = worker.queue[(worker.head + worker.count) % queue_size];
+    sample.reader = reader_;
+    sample.payload.assign(payload_, size_);
+    sample.id     = id_;
+    sample.clock  = clock_;
+    sample.time   = time_;
+    sample.hash   = hash_;
+
+    worker.count++;
+    worker.depth_max = std::max(worker.depth_max, worker.count);
+
+    lock.unlock();
+    worker.not_empty_cv.notify_one();
+
+    return(true);
+  }
+
+  void CCallbackExecutorImpl::Remove(CDataReader* reader_)
+  {
+    for (auto& worker : m_workers)
+    {
+      std::unique_lock<std::mutex> lock(worker->sync);
+
+      // compact the queue, the order of the remaining samples is kept
+      const size_t queue_size = worker->queue.size();
+      size_t kept(0);
+      for (size_t i = 0; i < worker->count; ++i)
+      {
+        SSample& sample = worker->queue[(worker->head + i) % queue_size];
+        if (sample.reader == reader_) continue;
+        if (kept != i) std::swap(sample, worker->queue[(worker->head + kept) % queue_size]);
+        kept++;
+      }
+      const bool removed = (kept != worker->count);
+      worker->count = kept;
+
+      if (removed) worker->not_full_cv.notify_all();
+
+      // the reader may be removed by its own callback
+      if (std::this_thread::get_id() != worker->thread_id)
+      {
+        worker->idle_cv.wait(lock, [&worker, reader_]() { return worker->running != reader_; });
+      }
+    }
+  }
+
+  SCallbackExecutorStatistics CCallbackExecutorImpl::GetStatistics() const
+  {
+    SCallbackExecutorStatistics statistics;
+    for (const auto& worker : m_workers)
+    {
+      const std::lock_guard<std::mutex> lock(worker->sync);
+      statistics.queue_depth    += worker->count;
+      statistics.queue_depth_max = std::max(statistics.queue_depth_max, worker->depth_max);
+      statistics.executed       += worker->executed;
+      statistics.dropped        += worker->dropped;
+      statistics.blocked        += worker->blocked;
+    }
+    return(statistics);
+  }
+
+  void CCallbackExecutorImpl::Run(std::shared_ptr<SWorker> worker_)
+  {
+    const CThreadScope thread_scope(thread_class_callback);
+
+    SWorker& worker = *worker_;
+    SSample  sample;
+
+    std::unique_lock<std::mutex> lock(worker.sync);
+    worker.thread_id = std::this_thread::get_id();
+
+    for (;;)
+    {
+      worker.not_empty_cv.wait(lock, [&worker]() { return (worker.count > 0) || worker.stop; });
+      if (worker.stop) break;
+
+      // take the sample and leave the previous payload buffer in the queue for reuse
+      std::swap(sample, worker.queue[worker.head]);
+      worker.head = (worker.head + 1) % worker.queue.size();
+      worker.count--;
+      worker.running = sample.reader;
+      lock.unlock();
+      worker.not_full_cv.notify_one();
+
+      sample.reader->ExecuteReceiveCallback(sample.payload, sample.id, sample.clock, sample.time, sample.hash);
+
+      lock.lock();
+      worker.running = nullptr;
+      worker.executed++;
+      worker.idle_cv.notify_all();
+    }
+  }
+}
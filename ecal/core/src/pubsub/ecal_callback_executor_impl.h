@@ -0,0 +1,112 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL subscriber callback executor
+**/
+
+#pragma once
+
+#include <ecal/ecal_callback_executor.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  class CDataReader;
+
+  class CCallbackExecutorImpl
+  {
+  public:
+    explicit CCallbackExecutorImpl(const SCallbackExecutorConfig& config_);
+    ~CCallbackExecutorImpl();
+
+    CCallbackExecutorImpl(const CCallbackExecutorImpl&) = delete;
+    CCallbackExecutorImpl& operator=(const CCallbackExecutorImpl&) = delete;
+
+    // assigns a worker to a new reader, all samples of the reader are posted to this worker
+    size_t Attach();
+
+    // queues a copy of the sample, returns false if it was dropped
+    // (a blocking post returns as soon as cancel_ is set)
+    bool Post(size_t worker_, CDataReader* reader_, const std::atomic<bool>& cancel_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_);
+
+    // discards the queued samples of the reader and waits until its running callback returned
+    void Remove(CDataReader* reader_);
+
+    SCallbackExecutorConfig GetConfig() const { return(m_config); }
+    SCallbackExecutorStatistics GetStatistics() const;
+
+    struct SSample
+    {
+      SSample() : reader(nullptr), id(0), clock(0), time(0), hash(0) {}
+
+      CDataReader*  reader;
+      std::string   payload;
+      long long     id;
+      long long     clock;
+      long long     time;
+      size_t        hash;
+    };
+
+  private:
+    struct SWorker
+    {
+      explicit SWorker(const SCallbackExecutorConfig& config_);
+
+      const SCallbackExecutorConfig  config;
+
+      mutable std::mutex             sync;
+      std::condition_variable        not_empty_cv;
+      std::condition_variable        not_full_cv;
+      std::condition_variable        idle_cv;
+
+      // ring buffer, the payload buffers of the slots are reused
+      std::vector<SSample>           queue;
+      size_t                         head;
+      size_t                         count;
+      CDataReader*                   running;
+      bool                           stop;
+
+      size_t                         depth_max;
+      unsigned long long             executed;
+      unsigned long long             dropped;
+      unsigned long long             blocked;
+
+      std::thread::id                thread_id;
+    };
+
+    // the workers are shared with their threads, which may outlive the executor
+    // if it is released by one of its own callbacks
+    static void Run(std::shared_ptr<SWorker> worker_);
+
+    const SCallbackExecutorConfig          m_config;
+    std::vector<std::shared_ptr<SWorker>>  m_workers;
+    std::vector<std::thread>               m_threads;
+
+    std::mutex                             m_attach_sync;
+    size_t                                 m_next_worker;
+  };
+}
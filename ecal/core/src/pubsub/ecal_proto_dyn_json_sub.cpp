@@ -57,13 +57,11 @@ namespace eCAL
     public:
       CDynamicJSONSubscriberImpl() :
         created(false),
-        msg_decoder(nullptr),
         msg_string()
       {}
 
       CDynamicJSONSubscriberImpl(const std::string& topic_name_) :
         created(false),
-        msg_decoder(nullptr),
         msg_string()
       {
         Create(topic_name_);
@@ -78,9 +76,6 @@ namespace eCAL
       {
         if (created) return;
 
-        // create message decoder
-        msg_decoder = new eCAL::protobuf::CProtoDynDecoder();
-
         // create subscriber
         msg_sub.Create(topic_name_);
 
@@ -100,8 +95,9 @@ namespace eCAL
         // destroy subscriber
         msg_sub.Destroy();
 
-        // delete message decoder
-        delete msg_decoder;
+        // release the type resolver before the descriptors
+        resolver_     = nullptr;
+        msg_prototype = nullptr;
 
         created = false;
       }
@@ -143,11 +139,15 @@ namespace eCAL
             return;
           }
 
+          // the descriptor is built only once for all dynamic subscribers of the process
           std::string error_s;
-          google::protobuf::FileDescriptorSet proto_desc;
-          proto_desc.ParseFromString(topic_desc);
-          const std::shared_ptr<google::protobuf::Message> msg(msg_decoder->GetProtoMessageFromDescriptorSet(proto_desc, topic_type, error_s));
-          resolver_.reset(google::protobuf::util::NewTypeResolverForDescriptorPool("", msg_decoder->GetDescriptorPool()));
+          msg_prototype = GetCachedPrototype(topic_desc, topic_type, error_s);
+          if (msg_prototype == nullptr)
+          {
+            std::cout << "could not build type for topic " << topic_name_ << ": " << error_s << std::endl;
+            return;
+          }
+          resolver_.reset(google::protobuf::util::NewTypeResolverForDescriptorPool("", msg_prototype->GetDescriptor()->file()->pool()));
         }
 
         // decode message and execute callback
@@ -173,11 +173,11 @@ namespace eCAL
         }
       }
 
-      bool                              created;
-      eCAL::protobuf::CProtoDynDecoder* msg_decoder;
-      std::string                       msg_string;
-      eCAL::CSubscriber                 msg_sub;
-      ReceiveCallbackT                  msg_callback;
+      bool                                              created;
+      std::shared_ptr<const google::protobuf::Message>  msg_prototype;
+      std::string                                       msg_string;
+      eCAL::CSubscriber                                 msg_sub;
+      ReceiveCallbackT                                  msg_callback;
 
       std::string topic_type;
       std::string topic_type_full;
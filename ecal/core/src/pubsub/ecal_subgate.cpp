@@ -30,6 +30,7 @@
 
 #include "ecal_def.h"
 #include "ecal_descgate.h"
+#include "ecal_trace.h"
 
 #include "pubsub/ecal_subgate.h"
 #include "ecal_sample_to_topicinfo.h"
@@ -194,6 +195,8 @@ namespace eCAL
   {
     if(!m_created) return false;
 
+    ECAL_TRACE_SCOPE(trace_apply, stage_apply_sample, hash_, clock_);
+
     // update globals
     g_process_rclock++;
     g_process_rbytes_sum += len_;
@@ -28,6 +28,7 @@
 
 #include <sstream>
 #include <iostream>
+#include <utility>
 
 
 namespace eCAL
@@ -63,6 +64,7 @@ namespace eCAL
 
   CSubscriber::CSubscriber(CSubscriber&& rhs) noexcept :
                  m_datareader(rhs.m_datareader),
+                 m_callback_executor(rhs.m_callback_executor),
                  m_qos(rhs.m_qos),
                  m_created(rhs.m_created),
                  m_initialized(rhs.m_initialized)
@@ -75,7 +77,8 @@ namespace eCAL
 
   CSubscriber& CSubscriber::operator=(CSubscriber&& rhs) noexcept
   {
-    m_datareader      = std::move(rhs.m_datareader);
+    m_datareader        = std::move(rhs.m_datareader);
+    m_callback_executor = std::move(rhs.m_callback_executor);
 
     m_qos             = rhs.m_qos;
     m_created         = rhs.m_created;
@@ -115,6 +118,8 @@ namespace eCAL
     m_datareader = std::make_shared<CDataReader>();
     // set qos
     m_datareader->SetQOS(m_qos);
+    // set callback executor
+    if (m_callback_executor) m_datareader->SetCallbackExecutor(m_callback_executor->m_impl);
     // create it
     if (!m_datareader->Create(topic_name_, topic_info_))
     {
@@ -129,7 +134,7 @@ namespace eCAL
     if (g_log() != nullptr) g_log()->Log(log_level_debug1, std::string(topic_name_ + "::CSubscriber::Create - SUCCESS"));
 #endif
     // register to subscriber gateway for publisher memory file receive thread
-    g_subgate()->Register(topic_name_, m_datareader);
+    if (g_ensure_subgate() != nullptr) g_ensure_subgate()->Register(topic_name_, m_datareader);
 
     // register to description gateway for type / description checking
     ApplyTopicToDescGate(topic_name_, topic_info_);
@@ -235,6 +240,14 @@ namespace eCAL
     return(m_datareader->RemReceiveCallback());
   }
 
+  bool CSubscriber::SetCallbackExecutor(std::shared_ptr<CCallbackExecutor> executor_)
+  {
+    m_callback_executor = std::move(executor_);
+    if (m_datareader == nullptr) return(true);
+    m_datareader->SetCallbackExecutor(m_callback_executor ? m_callback_executor->m_impl : nullptr);
+    return(true);
+  }
+
   bool CSubscriber::AddEventCallback(eCAL_Subscriber_Event type_, SubEventCallbackT callback_)
   {
     if (m_datareader == nullptr) return(false);
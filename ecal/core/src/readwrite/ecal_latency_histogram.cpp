@@ -0,0 +1,147 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL lock free latency histogram
+**/
+
+#include "ecal_latency_histogram.h"
+
+#include <limits>
+
+namespace eCAL
+{
+  CLatencyHistogram::CLatencyHistogram() :
+    m_sum(0),
+    m_min(std::numeric_limits<std::uint64_t>::max()),
+    m_max(0)
+  {
+    for (auto& bucket : m_buckets) bucket = 0;
+  }
+
+  void CLatencyHistogram::Record(long long value_us_)
+  {
+    const std::uint64_t value = (value_us_ > 0) ? static_cast<std::uint64_t>(value_us_) : 0;
+
+    m_buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    std::uint64_t min = m_min.load(std::memory_order_relaxed);
+    while ((value < min) && !m_min.compare_exchange_weak(min, value, std::memory_order_relaxed)) {}
+    std::uint64_t max = m_max.load(std::memory_order_relaxed);
+    while ((value > max) && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+  }
+
+  void CLatencyHistogram::GetStatistics(Monitoring::SLatencyStatistics& stats_, bool reset_)
+  {
+    stats_ = Monitoring::SLatencyStatistics();
+
+    // copy the buckets first, values recorded meanwhile are counted in the next period
+    std::array<std::uint64_t, kBucketCount> buckets;
+    std::uint64_t count(0);
+    for (int i = 0; i < kBucketCount; ++i)
+    {
+      buckets[i] = reset_ ? m_buckets[i].exchange(0, std::memory_order_relaxed) : m_buckets[i].load(std::memory_order_relaxed);
+      count += buckets[i];
+    }
+    const std::uint64_t sum = reset_ ? m_sum.exchange(0, std::memory_order_relaxed)                                      : m_sum.load(std::memory_order_relaxed);
+    const std::uint64_t min = reset_ ? m_min.exchange(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed) : m_min.load(std::memory_order_relaxed);
+    const std::uint64_t max = reset_ ? m_max.exchange(0, std::memory_order_relaxed)                                      : m_max.load(std::memory_order_relaxed);
+
+    if (count == 0) return;
+
+    stats_.count = static_cast<long long>(count);
+    stats_.min   = (min == std::numeric_limits<std::uint64_t>::max()) ? 0 : static_cast<long long>(min);
+    stats_.max   = static_cast<long long>(max);
+    stats_.mean  = static_cast<double>(sum) / static_cast<double>(count);
+
+    // percentiles are reported as upper bound of their bucket, but never above the maximum
+    const std::uint64_t p50_rank  = (count * 500  + 999)  / 1000;
+    const std::uint64_t p90_rank  = (count * 900  + 999)  / 1000;
+    const std::uint64_t p99_rank  = (count * 990  + 999)  / 1000;
+    const std::uint64_t p999_rank = (count * 9990 + 9999) / 10000;
+
+    std::uint64_t cumulated(0);
+    for (int i = 0; i < kBucketCount; ++i)
+    {
+      if (buckets[i] == 0) continue;
+
+      const std::uint64_t previous = cumulated;
+      cumulated += buckets[i];
+
+      long long upper_bound = BucketUpperBound(i);
+      if ((upper_bound > stats_.max) || (i == kBucketCount - 1)) upper_bound = stats_.max;
+      stats_.histogram[BucketUpperBound(i)] = static_cast<long long>(buckets[i]);
+
+      if ((previous < p50_rank)  && (cumulated >= p50_rank))  stats_.p50  = upper_bound;
+      if ((previous < p90_rank)  && (cumulated >= p90_rank))  stats_.p90  = upper_bound;
+      if ((previous < p99_rank)  && (cumulated >= p99_rank))  stats_.p99  = upper_bound;
+      if ((previous < p999_rank) && (cumulated >= p999_rank)) stats_.p999 = upper_bound;
+    }
+  }
+
+  int CLatencyHistogram::BucketIndex(std::uint64_t value_)
+  {
+    if (value_ < static_cast<std::uint64_t>(kLinearLimit)) return(static_cast<int>(value_));
+
+    // position of the highest bit
+    int exponent(0);
+    for (std::uint64_t v = value_; v > 1; v >>= 1) ++exponent;
+    if (exponent >= kMaxExponent) return(kBucketCount - 1);
+
+    const int sub_bucket = static_cast<int>((value_ >> (exponent - kSubBucketBits)) & (kSubBuckets - 1));
+    return(kLinearLimit + (exponent - kSubBucketBits - 1) * kSubBuckets + sub_bucket);
+  }
+
+  long long CLatencyHistogram::BucketUpperBound(int index_)
+  {
+    if (index_ < kLinearLimit) return(index_);
+
+    const int exponent   = (index_ - kLinearLimit) / kSubBuckets + kSubBucketBits + 1;
+    const int sub_bucket = (index_ - kLinearLimit) % kSubBuckets;
+    const long long lower_bound = static_cast<long long>(kSubBuckets + sub_bucket) << (exponent - kSubBucketBits);
+    return(lower_bound + (1LL << (exponent - kSubBucketBits)) - 1);
+  }
+
+  void LatencyStatisticsToPb(const Monitoring::SLatencyStatistics& stats_, eCAL::pb::LatencyStatistics& pb_stats_)
+  {
+    pb_stats_.set_count(stats_.count);
+    pb_stats_.set_min(stats_.min);
+    pb_stats_.set_max(stats_.max);
+    pb_stats_.set_mean(stats_.mean);
+    pb_stats_.set_p50(stats_.p50);
+    pb_stats_.set_p90(stats_.p90);
+    pb_stats_.set_p99(stats_.p99);
+    pb_stats_.set_p999(stats_.p999);
+    *pb_stats_.mutable_histogram() = google::protobuf::Map<google::protobuf::int64, google::protobuf::int64>{ stats_.histogram.begin(), stats_.histogram.end() };
+  }
+
+  void PbToLatencyStatistics(const eCAL::pb::LatencyStatistics& pb_stats_, Monitoring::SLatencyStatistics& stats_)
+  {
+    stats_.count     = pb_stats_.count();
+    stats_.min       = pb_stats_.min();
+    stats_.max       = pb_stats_.max();
+    stats_.mean      = pb_stats_.mean();
+    stats_.p50       = pb_stats_.p50();
+    stats_.p90       = pb_stats_.p90();
+    stats_.p99       = pb_stats_.p99();
+    stats_.p999      = pb_stats_.p999();
+    stats_.histogram = std::map<long long, long long>{ pb_stats_.histogram().begin(), pb_stats_.histogram().end() };
+  }
+}
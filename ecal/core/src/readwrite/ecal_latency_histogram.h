@@ -0,0 +1,88 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL lock free latency histogram
+**/
+
+#pragma once
+
+#include <ecal/ecal_monitoring_struct.h>
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <ecal/core/pb/topic.pb.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace eCAL
+{
+  /**
+   * @brief Histogram with logarithmic buckets (like HDR histograms), values can
+   *        be recorded from any thread without locking.
+   *
+   * Values below 16 us have their own bucket, above every power of two is split
+   * into 8 buckets, so a percentile is precise up to 12.5 %. Values beyond
+   * 2^40 us are counted in the last bucket.
+  **/
+  class CLatencyHistogram
+  {
+  public:
+    CLatencyHistogram();
+
+    /**
+     * @brief Record a latency value.
+     *
+     * @param value_us_  The latency in us, negative values are counted as 0.
+    **/
+    void Record(long long value_us_);
+
+    /**
+     * @brief Get the statistics of all values recorded since the last reset.
+     *
+     * @param stats_  The statistics.
+     * @param reset_  Reset the histogram afterwards.
+    **/
+    void GetStatistics(Monitoring::SLatencyStatistics& stats_, bool reset_);
+
+  private:
+    static const int kSubBucketBits = 3;
+    static const int kSubBuckets    = 1 << kSubBucketBits;
+    static const int kLinearLimit   = 2 * kSubBuckets;
+    static const int kMaxExponent   = 40;
+    static const int kBucketCount   = kLinearLimit + (kMaxExponent - kSubBucketBits - 1) * kSubBuckets;
+
+    static int       BucketIndex(std::uint64_t value_);
+    static long long BucketUpperBound(int index_);
+
+    std::array<std::atomic<std::uint64_t>, kBucketCount> m_buckets;
+    std::atomic<std::uint64_t>                           m_sum;
+    std::atomic<std::uint64_t>                           m_min;
+    std::atomic<std::uint64_t>                           m_max;
+  };
+
+  void LatencyStatisticsToPb(const Monitoring::SLatencyStatistics& stats_, eCAL::pb::LatencyStatistics& pb_stats_);
+  void PbToLatencyStatistics(const eCAL::pb::LatencyStatistics& pb_stats_, Monitoring::SLatencyStatistics& stats_);
+}
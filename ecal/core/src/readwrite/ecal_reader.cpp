@@ -29,6 +29,7 @@
 #include "ecal_descgate.h"
 #include "ecal_reader.h"
 #include "ecal_process.h"
+#include "ecal_trace.h"
 
 #include "readwrite/ecal_reader_udp_mc.h"
 #include "readwrite/ecal_reader_shm.h"
@@ -55,14 +56,21 @@ namespace eCAL
                  m_read_time(0),
                  m_receive_timeout(0),
                  m_receive_time(0),
+                 m_callback_executor_worker(0),
+                 m_callback_executor_cancel(false),
                  m_clock(0),
                  m_clock_old(0),
                  m_freq(0),
+                 m_topic_statistics(false),
+                 m_bytes(0),
+                 m_bytes_old(0),
+                 m_drate(0),
                  m_message_drops(0),
                  m_loc_published(false),
                  m_ext_published(false),
                  m_use_ttype(true),
                  m_use_tdesc(true),
+                 m_fast_discovery(false),
                  m_use_udp_mc_confirmed(false),
                  m_use_shm_confirmed(false),
                  m_use_tcp_confirmed(false),
@@ -88,6 +96,9 @@ namespace eCAL
     m_clock_old     = 0;
     m_message_drops = 0;
     m_rec_time      = std::chrono::steady_clock::time_point();
+    m_bytes         = 0;
+    m_bytes_old     = 0;
+    m_drate         = 0;
     m_created       = false;
 #ifndef NDEBUG
     // log it
@@ -109,11 +120,17 @@ namespace eCAL
     // allow to share topic description
     m_use_tdesc = Config::IsTopicDescriptionSharingEnabled();
 
+    // announce immediately and answer new publishers at once
+    m_fast_discovery = Config::IsRegistrationFastDiscoveryEnabled();
+
+    // collect latency histograms and data rate
+    m_topic_statistics = Config::IsTopicStatisticsEnabled();
+
     // start transport layers
     SubscribeToLayers();
 
     // register
-    Register(false);
+    Register(m_fast_discovery);
 
     // mark as created
     m_created = true;
@@ -133,11 +150,20 @@ namespace eCAL
     // stop transport layers
     UnsubscribeFromLayers();
 
-    // reset receive callback
+    // reset receive callback and detach from the callback executor
+    std::shared_ptr<CCallbackExecutorImpl> callback_executor;
+    m_callback_executor_cancel = true;
     {
       const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
       m_receive_callback = nullptr;
+      callback_executor = std::move(m_callback_executor);
     }
+    {
+      const std::lock_guard<std::recursive_mutex> lock(m_executed_callback_sync);
+      m_executed_callback = nullptr;
+    }
+    if (callback_executor) callback_executor->Remove(this);
+    m_callback_executor_cancel = false;
 
     // reset event callback map
     {
@@ -273,6 +299,13 @@ namespace eCAL
     ecal_reg_sample_mutable_topic->set_dclock(m_clock);
     ecal_reg_sample_mutable_topic->set_dfreq(m_freq);
     ecal_reg_sample_mutable_topic->set_message_drops(google::protobuf::int32(m_message_drops));
+    if (m_topic_statistics)
+    {
+      const std::lock_guard<std::mutex> lock(m_statistics_sync);
+      ecal_reg_sample_mutable_topic->set_drate(m_drate);
+      LatencyStatisticsToPb(m_latency_statistics,  *ecal_reg_sample_mutable_topic->mutable_latency());
+      LatencyStatisticsToPb(m_callback_statistics, *ecal_reg_sample_mutable_topic->mutable_callback_duration());
+    }
 
     size_t loc_connections(0);
     size_t ext_connections(0);
@@ -485,6 +518,22 @@ namespace eCAL
     // store size
     m_topic_size = size_;
 
+    const bool topic_statistics = m_topic_statistics;
+    if (topic_statistics) m_bytes += static_cast<long long>(size_);
+
+    // hand over to the callback executor, the latency is measured when its worker calls the callback
+    if (m_receive_callback && m_callback_executor)
+    {
+      m_callback_executor->Post(m_callback_executor_worker, this, m_callback_executor_cancel, payload_, size_, id_, clock_, time_, hash_);
+      return(size_);
+    }
+
+    // measure latency from sending to callback entry (or to buffering)
+    if (topic_statistics)
+    {
+      m_latency_histogram.Record(eCAL::Time::GetMicroSeconds() - time_);
+    }
+
     // execute callback
     bool processed = false;
     {
@@ -495,15 +544,7 @@ namespace eCAL
         // log it
         Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::ReceiveCallback");
 #endif
-        // prepare data struct
-        SReceiveCallbackData cb_data;
-        cb_data.buf   = const_cast<char*>(payload_);
-        cb_data.size  = long(size_);
-        cb_data.id    = id_;
-        cb_data.time  = time_;
-        cb_data.clock = clock_;
-        // execute it
-        (m_receive_callback)(m_topic_name.c_str(), &cb_data);
+        CallReceiveCallback(m_receive_callback, payload_, size_, id_, clock_, time_, hash_);
         processed = true;
       }
     }
@@ -529,6 +570,30 @@ namespace eCAL
     return(size_);
   }
 
+  void CDataReader::CallReceiveCallback(const ReceiveCallbackT& callback_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_)
+  {
+    // prepare data struct
+    SReceiveCallbackData cb_data;
+    cb_data.buf   = const_cast<char*>(payload_);
+    cb_data.size  = long(size_);
+    cb_data.id    = id_;
+    cb_data.time  = time_;
+    cb_data.clock = clock_;
+    // execute it
+    (void)hash_; // used by the trace point only
+    ECAL_TRACE_SCOPE(trace_callback, stage_user_callback, hash_, clock_);
+    if (m_topic_statistics)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      (callback_)(m_topic_name.c_str(), &cb_data);
+      m_callback_histogram.Record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+    else
+    {
+      (callback_)(m_topic_name.c_str(), &cb_data);
+    }
+  }
+
   bool CDataReader::AddReceiveCallback(ReceiveCallbackT callback_)
   {
     if (!m_created) return(false);
@@ -540,7 +605,10 @@ namespace eCAL
       // log it
       Logging::Log(log_level_debug2, m_topic_name + "::CDataReader::AddReceiveCallback");
 #endif
-      m_receive_callback = std::move(callback_);
+      m_receive_callback = callback_;
+
+      const std::lock_guard<std::recursive_mutex> executed_lock(m_executed_callback_sync);
+      m_executed_callback = std::move(callback_);
     }
 
     return(true);
@@ -550,7 +618,8 @@ namespace eCAL
   {
     if (!m_created) return(false);
 
-    // reset receive callback
+    // reset receive callback (a post waiting for a full executor queue gives up)
+    m_callback_executor_cancel = true;
     {
       const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
 #ifndef NDEBUG
@@ -558,11 +627,45 @@ namespace eCAL
       Logging::Log(log_level_debug2, m_topic_name + "::CDataReader::RemReceiveCallback");
 #endif
       m_receive_callback = nullptr;
+
+      // wait for a callback running on the executor, queued samples are skipped
+      const std::lock_guard<std::recursive_mutex> executed_lock(m_executed_callback_sync);
+      m_executed_callback = nullptr;
     }
+    m_callback_executor_cancel = false;
 
     return(true);
   }
 
+  void CDataReader::SetCallbackExecutor(std::shared_ptr<CCallbackExecutorImpl> executor_)
+  {
+    std::shared_ptr<CCallbackExecutorImpl> old_executor;
+    {
+      const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
+      if (executor_ == m_callback_executor) return;
+      old_executor = std::move(m_callback_executor);
+      m_callback_executor_worker = executor_ ? executor_->Attach() : 0;
+      m_callback_executor        = std::move(executor_);
+    }
+
+    // samples still queued by the previous executor are discarded
+    if (old_executor) old_executor->Remove(this);
+  }
+
+  void CDataReader::ExecuteReceiveCallback(const std::string& payload_, long long id_, long long clock_, long long time_, size_t hash_)
+  {
+    const std::lock_guard<std::recursive_mutex> lock(m_executed_callback_sync);
+    if (!m_executed_callback) return;
+
+    // measure latency from sending to callback entry, including the time in the executor queue
+    if (m_topic_statistics)
+    {
+      m_latency_histogram.Record(eCAL::Time::GetMicroSeconds() - time_);
+    }
+
+    CallReceiveCallback(m_executed_callback, payload_.data(), payload_.size(), id_, clock_, time_, hash_);
+  }
+
   bool CDataReader::AddEventCallback(eCAL_Subscriber_Event type_, SubEventCallbackT callback_)
   {
     if (!m_created) return(false);
@@ -614,12 +717,17 @@ namespace eCAL
 
     // add key to local publisher map
     const std::string topic_key = process_id_ + tid_;
+    bool new_publisher(false);
     {
       const std::lock_guard<std::mutex> lock(m_pub_map_sync);
+      new_publisher = m_loc_pub_map.find(topic_key) == m_loc_pub_map.end();
       m_loc_pub_map[topic_key] = true;
     }
 
     m_loc_published = true;
+
+    // answer a new publisher at once, so it does not wait for the next registration cycle
+    if (m_fast_discovery && new_publisher) Register(true);
   }
 
   void CDataReader::RemoveLocPublication(const std::string& process_id_, const std::string& tid_)
@@ -638,12 +746,17 @@ namespace eCAL
 
     // add key to external publisher map
     const std::string topic_key = host_name_ + process_id_ + tid_;
+    bool new_publisher(false);
     {
       const std::lock_guard<std::mutex> lock(m_pub_map_sync);
+      new_publisher = m_ext_pub_map.find(topic_key) == m_ext_pub_map.end();
       m_ext_pub_map[topic_key] = true;
     }
 
     m_ext_published = true;
+
+    // answer a new publisher at once, so it does not wait for the next registration cycle
+    if (m_fast_discovery && new_publisher) Register(true);
   }
 
   void CDataReader::RemoveExtPublication(const std::string& host_name_, const std::string& process_id_, const std::string& tid_)
@@ -896,24 +1009,38 @@ namespace eCAL
       if (m_clock_old == 0)
       {
         m_clock_old = m_clock;
+        m_bytes_old = m_bytes;
         m_rec_time  = curr_time;
       }
 
       // check for clock difference
       else if ((m_clock - m_clock_old) > 0)
       {
+        const auto delta_ms = std::chrono::duration_cast<std::chrono::milliseconds>(curr_time - m_rec_time).count();
         // calculate frequency in mHz
-        m_freq = static_cast<long>((1000 * 1000 * (m_clock - m_clock_old)) / std::chrono::duration_cast<std::chrono::milliseconds>(curr_time - m_rec_time).count());
+        m_freq = static_cast<long>((1000 * 1000 * (m_clock - m_clock_old)) / delta_ms);
+        // calculate data rate in bytes per second
+        m_drate = (1000 * (m_bytes - m_bytes_old)) / delta_ms;
         // reset clock and time
         m_clock_old = m_clock;
+        m_bytes_old = m_bytes;
         m_rec_time  = curr_time;
       }
       else
       {
-        m_freq = 0;
+        m_freq  = 0;
+        m_drate = 0;
       }
     }
 
+    // take the latency statistics of the last registration cycle
+    if (m_topic_statistics)
+    {
+      const std::lock_guard<std::mutex> lock(m_statistics_sync);
+      m_latency_histogram.GetStatistics(m_latency_statistics, true);
+      m_callback_histogram.GetStatistics(m_callback_statistics, true);
+    }
+
     // register without send
     Register(false);
 
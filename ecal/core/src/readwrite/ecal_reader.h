@@ -36,6 +36,8 @@
 #endif
 
 #include "ecal_expmap.h"
+#include "ecal_latency_histogram.h"
+#include "pubsub/ecal_callback_executor_impl.h"
 
 #include <condition_variable>
 #include <mutex>
@@ -66,6 +68,9 @@ namespace eCAL
     bool AddReceiveCallback(ReceiveCallbackT callback_);
     bool RemReceiveCallback();
 
+    void SetCallbackExecutor(std::shared_ptr<CCallbackExecutorImpl> executor_);
+    void ExecuteReceiveCallback(const std::string& payload_, long long id_, long long clock_, long long time_, size_t hash_);
+
     bool AddEventCallback(eCAL_Subscriber_Event type_, SubEventCallbackT callback_);
     bool RemEventCallback(eCAL_Subscriber_Event type_);
 
@@ -114,6 +119,7 @@ namespace eCAL
     void Connect(const std::string& tid_, const STopicInformation& topic_info_);
     void Disconnect();
     bool CheckMessageClock(const std::string& tid_, long long current_clock_);
+    void CallReceiveCallback(const ReceiveCallbackT& callback_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_);
 
     std::string                               m_host_name;
     int                                       m_host_id;
@@ -144,6 +150,14 @@ namespace eCAL
     std::atomic<int>                          m_receive_timeout;
     std::atomic<int>                          m_receive_time;
 
+    // samples are posted under m_receive_callback_sync, the executor calls the
+    // callback under m_executed_callback_sync only, so a blocking post never waits for itself
+    std::shared_ptr<CCallbackExecutorImpl>    m_callback_executor;
+    size_t                                    m_callback_executor_worker;
+    std::atomic<bool>                         m_callback_executor_cancel;
+    std::recursive_mutex                      m_executed_callback_sync;
+    ReceiveCallbackT                          m_executed_callback;
+
     std::deque<size_t>                        m_sample_hash_queue;
 
     std::mutex                                m_event_callback_map_sync;
@@ -155,6 +169,16 @@ namespace eCAL
     std::chrono::steady_clock::time_point     m_rec_time;
     long                                      m_freq;
 
+    std::atomic<bool>                         m_topic_statistics;
+    std::atomic<long long>                    m_bytes;
+    long long                                 m_bytes_old;
+    CLatencyHistogram                         m_latency_histogram;
+    CLatencyHistogram                         m_callback_histogram;
+    std::mutex                                m_statistics_sync;
+    std::atomic<long long>                    m_drate;
+    Monitoring::SLatencyStatistics            m_latency_statistics;
+    Monitoring::SLatencyStatistics            m_callback_statistics;
+
     std::set<long long>                       m_id_set;
     
     using WriterCounterMapT = std::unordered_map<std::string, long long>;
@@ -166,6 +190,7 @@ namespace eCAL
 
     bool                                      m_use_ttype;
     bool                                      m_use_tdesc;
+    bool                                      m_fast_discovery;
 
     bool                                      m_use_udp_mc_confirmed;
     bool                                      m_use_shm_confirmed;
@@ -90,13 +90,13 @@ namespace eCAL
     for (const auto& memfile_name : memfile_names)
     {
       // start memory file receive thread if topic is subscribed in this process
-      if (g_memfile_pool() != nullptr)
+      if (g_ensure_memfile_pool() != nullptr)
       {
         const std::string process_id = std::to_string(Process::GetProcessID());
         const std::string memfile_event = memfile_name + "_" + process_id;
         const MemFileDataCallbackT memfile_data_callback = std::bind(&CSHMReaderLayer::OnNewShmFileContent, this,
           std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8);
-        g_memfile_pool()->ObserveFile(memfile_name, memfile_event, par_.topic_name, par_.topic_id, Config::GetRegistrationTimeoutMs(), memfile_data_callback);
+        g_ensure_memfile_pool()->ObserveFile(memfile_name, memfile_event, par_.topic_name, par_.topic_id, Config::GetRegistrationTimeoutMs(), memfile_data_callback);
       }
     }
   }
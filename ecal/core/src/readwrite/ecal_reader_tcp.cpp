@@ -22,6 +22,7 @@
 **/
 
 #include "ecal_global_accessors.h"
+#include "ecal_thread_registry.h"
 
 #include <ecal/ecal_config.h>
 
@@ -132,6 +133,9 @@ namespace eCAL
   void CTCPReaderLayer::Initialize()
   {
     const tcp_pubsub::logger::logger_t tcp_pubsub_logger = std::bind(TcpPubsubLogger, std::placeholders::_1, std::placeholders::_2);
+
+    // the executor threads inherit name, affinity and priority of the tcp thread class
+    const CThreadInheritScope thread_scope(thread_class_tcp);
     m_executor = std::make_shared<tcp_pubsub::Executor>(Config::GetTcpPubsubReaderThreadpoolSize(), tcp_pubsub_logger);
   }
 
@@ -72,7 +72,7 @@ namespace eCAL
   {
     if (!started)
     {
-      thread.Start(0, std::bind(&CDataReaderUDP::Receive, &reader, &rcv));
+      thread.Start(0, std::bind(&CDataReaderUDP::Receive, &reader, &rcv), thread_class_udp_receive);
       started = true;
     }
     // add topic name based multicast address
@@ -34,6 +34,7 @@
 #include "ecal_writer.h"
 #include "ecal_writer_base.h"
 #include "ecal_process.h"
+#include "ecal_trace.h"
 
 #include "pubsub/ecal_pubgate.h"
 
@@ -85,6 +86,7 @@ namespace eCAL
     m_use_tdesc(true),
     m_share_ttype(-1),
     m_share_tdesc(-1),
+    m_fast_discovery(false),
     m_created(false)
   {
     // initialize layer modes with configuration settings
@@ -136,6 +138,9 @@ namespace eCAL
     // allow to share topic description
     m_use_tdesc = Config::IsTopicDescriptionSharingEnabled();
 
+    // announce immediately and answer new subscribers at once
+    m_fast_discovery = Config::IsRegistrationFastDiscoveryEnabled();
+
     // register
     Register(false);
 
@@ -162,6 +167,9 @@ namespace eCAL
     // adapt number of used memory file
     ShmSetBufferCount(m_buffering_shm);
 
+    // announce the publisher with its layer parameters
+    if (m_fast_discovery) Register(true);
+
     return(true);
   }
 
@@ -407,6 +415,8 @@ namespace eCAL
 
   size_t CDataWriter::Write(CPayloadWriter& payload_, long long time_, long long id_)
   {
+    ECAL_TRACE_SCOPE(trace_write, stage_write, 0, 0);
+
     // check writer modes
     if (!CheckWriterModes())
     {
@@ -434,6 +444,7 @@ namespace eCAL
 
     // prepare counter and internal states
     const size_t snd_hash = PrepareWrite(id_, payload_buf_size);
+    ECAL_TRACE_SAMPLE(trace_write, snd_hash, m_clock);
 
     // did we write anything
     bool written(false);
@@ -659,8 +670,10 @@ namespace eCAL
 
     // add key to local subscriber map
     const std::string topic_key = process_id_ + tid_;
+    bool new_subscriber(false);
     {
       const std::lock_guard<std::mutex> lock(m_sub_map_sync);
+      new_subscriber = m_loc_sub_map.find(topic_key) == m_loc_sub_map.end();
       m_loc_sub_map[topic_key] = true;
     }
 
@@ -670,6 +683,9 @@ namespace eCAL
     m_writer.udp_mc.AddLocConnection (process_id_, reader_par_);
     m_writer.shm.AddLocConnection    (process_id_, reader_par_);
 
+    // answer a new subscriber at once, so it does not wait for the next registration cycle
+    if (m_fast_discovery && new_subscriber) Register(true);
+
 #ifndef NDEBUG
     // log it
     Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::ApplyLocSubscription");
@@ -701,8 +717,10 @@ namespace eCAL
 
     // add key to external subscriber map
     const std::string topic_key = host_name_ + process_id_ + tid_;
+    bool new_subscriber(false);
     {
       const std::lock_guard<std::mutex> lock(m_sub_map_sync);
+      new_subscriber = m_ext_sub_map.find(topic_key) == m_ext_sub_map.end();
       m_ext_sub_map[topic_key] = true;
     }
 
@@ -712,6 +730,9 @@ namespace eCAL
     m_writer.udp_mc.AddExtConnection (host_name_, process_id_, reader_par_);
     m_writer.shm.AddExtConnection    (host_name_, process_id_, reader_par_);
 
+    // answer a new subscriber at once, so it does not wait for the next registration cycle
+    if (m_fast_discovery && new_subscriber) Register(true);
+
 #ifndef NDEBUG
     // log it
     Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::ApplyExtSubscription");
@@ -183,6 +183,7 @@ namespace eCAL
     bool               m_use_tdesc;
     int                m_share_ttype;
     int                m_share_tdesc;
+    bool               m_fast_discovery;
     bool               m_created;
   };
 }
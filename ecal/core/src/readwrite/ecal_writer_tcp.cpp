@@ -30,6 +30,7 @@
 #endif
 
 #include "ecal_config_reader_hlp.h"
+#include "ecal_thread_registry.h"
 
 #include <ecal/ecal_config.h>
 
@@ -76,6 +77,8 @@ namespace eCAL
       const std::lock_guard<std::mutex> lock(g_tcp_writer_executor_mtx);
       if (!g_tcp_writer_executor)
       {
+        // the executor threads inherit name, affinity and priority of the tcp thread class
+        const CThreadInheritScope thread_scope(thread_class_tcp);
         g_tcp_writer_executor = std::make_shared<tcp_pubsub::Executor>(Config::GetTcpPubsubWriterThreadpoolSize(), TcpPubsubLogger);
       }
     }
@@ -76,7 +76,7 @@ namespace eCAL
     m_service_server_impl = new CServiceServerImpl(service_name_);
 
     // register this service
-    if (g_servicegate() != nullptr) g_servicegate()->Register(m_service_server_impl);
+    if (g_ensure_servicegate() != nullptr) g_ensure_servicegate()->Register(m_service_server_impl);
 
     m_created = true;
     return(true);
@@ -24,6 +24,7 @@
 #include "ecal_process.h"
 #include "ecal_tcpclient.h"
 #include "ecal_tcpheader.h"
+#include "ecal_thread_registry.h"
 
 #include <chrono>
 #include <iostream>
@@ -66,6 +67,7 @@ namespace eCAL
       m_async_worker = std::thread(
         [this]
         {
+          const CThreadScope thread_scope(thread_class_service);
           m_io_service->run();
         });
 
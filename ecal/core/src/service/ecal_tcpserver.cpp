@@ -22,6 +22,7 @@
 **/
 
 #include "ecal_tcpserver.h"
+#include "ecal_thread_registry.h"
 
 namespace eCAL
 {
@@ -78,6 +79,8 @@ namespace eCAL
   
   void CTcpServer::ServerThread(std::uint32_t port_, RequestCallbackT request_callback_, EventCallbackT event_callback_)
   {
+    const CThreadScope thread_scope(thread_class_service);
+
     m_io_service = std::make_shared<asio::io_service>();
     m_server     = std::make_shared<CAsioServer>(*m_io_service, static_cast<unsigned short>(port_));
     
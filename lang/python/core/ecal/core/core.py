@@ -254,8 +254,8 @@ def pub_send(topic_handle, msg_payload, msg_time=-1):
   """ send publisher content
 
   :param topic_handle: the topic handle
-  :param msg_payload:  message python string (can contain zeros)
-  :type msg_payload:   bytes
+  :param msg_payload:  message content, any bytes-like object (bytes, bytearray, memoryview, numpy array ..) is passed to eCAL without an intermediate copy
+  :type msg_payload:   bytes-like
   :param msg_time:     optional message time in us (default -1 == eCAL system time)
   :type msg_time:      int
 
@@ -267,8 +267,8 @@ def pub_send_sync(topic_handle, msg_payload, msg_time, ack_timeout_ms):
   """ send publisher content synchronized to connected local subscribers with acknowledge timeout
 
   :param topic_handle:    the topic handle
-  :param msg_payload:     message python string (can contain zeros)
-  :type msg_payload:      bytes
+  :param msg_payload:     message content, any bytes-like object (bytes, bytearray, memoryview, numpy array ..) is passed to eCAL without an intermediate copy
+  :type msg_payload:      bytes-like
   :param msg_time:        message time in us (-1 == eCAL system time)
   :type msg_time:         int
   :param ack_timeout_ms:  Maximum time to wait for all subscribers acknowledge feedback in ms (message received and processed)
@@ -335,14 +335,17 @@ def sub_receive(topic_handle, timeout=0):
   return _ecal.sub_receive(topic_handle, timeout)
 
 
-def sub_set_callback(topic_handle, callback):
+def sub_set_callback(topic_handle, callback, zero_copy=False):
   """ set callback function for incoming messages
 
   :param topic_handle: the topic handle
   :param callback:     python callback function (f(topic_name, msg, time))
+  :param zero_copy:    pass the message as read-only memoryview of the receive buffer instead of a bytearray copy,
+                       the memoryview and views derived from it must not be used after the callback returned, copy it (bytes(msg)) to keep the content
+  :type zero_copy:     bool
 
   """
-  return _ecal.sub_set_callback(topic_handle, callback)
+  return _ecal.sub_set_callback(topic_handle, callback, zero_copy)
 
 
 def sub_rem_callback(topic_handle, callback):
@@ -355,6 +358,32 @@ def sub_rem_callback(topic_handle, callback):
   return _ecal.sub_rem_callback(topic_handle, callback)
 
 
+def sub_enable_batch_receive(topic_handle, queue_size=1024):
+  """ buffer incoming messages in a bounded queue for sub_receive_batch (replaces the callback)
+
+  :param topic_handle: the topic handle
+  :param queue_size:   maximum number of buffered messages, the oldest message is dropped if the queue is full
+  :type queue_size:    int
+
+  """
+  return _ecal.sub_enable_batch_receive(topic_handle, queue_size)
+
+
+def sub_receive_batch(topic_handle, max_num=0, timeout=0):
+  """ receive all buffered messages at once, waits for the first message up to timeout
+
+  :param topic_handle: the topic handle
+  :param max_num:      maximum number of returned messages (0 == all buffered)
+  :type max_num:       int
+  :param timeout:      receive timeout in ms (-1 == infinite)
+  :type timeout:       int
+
+  :return: list of (msg, time) tuples
+
+  """
+  return _ecal.sub_receive_batch(topic_handle, max_num, timeout)
+
+
 def dyn_json_sub_create(topic_name):
   """ create subscriber
 
@@ -668,8 +697,8 @@ class publisher(object):
   def send(self, msg_payload, msg_time=-1):
     """ send publisher content
 
-    :param msg_payload: message python string (can contain zeros)
-    :type msg_payload:  bytes
+    :param msg_payload: message content, any bytes-like object (bytes, bytearray, memoryview, numpy array ..) is passed to eCAL without an intermediate copy
+    :type msg_payload:  bytes-like
     :param msg_time:    optional message time in us (default -1 == eCAL system time)
     :type msg_time:     int
 
@@ -679,8 +708,8 @@ class publisher(object):
   def send_sync(self, msg_payload, msg_time, ack_timeout_ms):
     """ send publisher content synchronized to connected local subscribers with acknowledge timeout
 
-    :param msg_payload:     message python string (can contain zeros)
-    :type msg_payload:      bytes
+    :param msg_payload:     message content, any bytes-like object (bytes, bytearray, memoryview, numpy array ..) is passed to eCAL without an intermediate copy
+    :type msg_payload:      bytes-like
     :param msg_time:        message time in us (-1 == eCAL system time)
     :type msg_time:         int
     :param ack_timeout_ms:  Maximum time to wait for subscriber receive and process acknowledge feedback in ms
@@ -746,13 +775,19 @@ class subscriber(object):
     """
     return sub_receive(self.thandle, timeout)
 
-  def set_callback(self, callback):
+  def set_callback(self, callback, zero_copy=False):
     """ set callback function for incoming messages
 
-    :param callback: python callback function (f(topic_name, msg, time))
+    :param callback:  python callback function (f(topic_name, msg, time))
+    :param zero_copy: pass the message as read-only memoryview of the receive buffer instead of a bytearray copy,
+                      the memoryview is released when the callback returns, copy it (bytes(msg)) to keep the content.
+                      Objects that export the buffer (slices of the memoryview, numpy.frombuffer(msg), ..) must not outlive
+                      the callback, they would still point into the receive buffer that is reused for the next messages.
+                      Such objects are detected when the callback returns and reported as BufferError.
+    :type zero_copy:  bool
 
     """
-    return sub_set_callback(self.thandle, callback)
+    return sub_set_callback(self.thandle, callback, zero_copy)
 
   def rem_callback(self, callback):
     """ remove callback function for incoming messages
@@ -762,6 +797,32 @@ class subscriber(object):
     """
     return sub_rem_callback(self.thandle, callback)
 
+  def enable_batch_receive(self, queue_size=1024):
+    """ buffer incoming messages in a bounded queue for receive_batch (replaces the callback),
+        receive_batch enables it with the default queue size on its first call
+
+    :param queue_size: maximum number of buffered messages, the oldest message is dropped if the queue is full
+    :type queue_size:  int
+
+    """
+    return sub_enable_batch_receive(self.thandle, queue_size)
+
+  def receive_batch(self, max_num=0, timeout=0):
+    """ receive all buffered messages at once, waits for the first message up to timeout
+
+        the messages are buffered by the eCAL receive thread without the GIL,
+        so high frequency topics are received without a python callback per message
+
+    :param max_num: maximum number of returned messages (0 == all buffered)
+    :type max_num:  int
+    :param timeout: receive timeout in ms (-1 == infinite)
+    :type timeout:  int
+
+    :return: list of (msg, time) tuples
+
+    """
+    return sub_receive_batch(self.thandle, max_num, timeout)
+
 
 class subscriberDynJSON(object):
   """ eCAL Protobuf dynamic JSON subscriber
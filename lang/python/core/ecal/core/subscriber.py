@@ -59,6 +59,17 @@ class MessageSubscriber(object):
     """
     raise NotImplementedError("Please Implement this method")
 
+  def receive_batch(self, max_num=0, timeout=0):
+    """ receive all buffered messages at once, waits for the first message up to timeout
+
+    :param max_num: maximum number of returned messages (0 == all buffered)
+    :type max_num:  int
+    :param timeout: receive timeout in ms (-1 == infinite)
+    :type timeout:  int
+
+    """
+    raise NotImplementedError("Please Implement this method")
+
   def set_callback(self, callback):
     """ set callback function for incoming messages
 
@@ -108,6 +119,24 @@ class ProtoSubscriber(MessageSubscriber):
       proto_message.ParseFromString(msg)
     return ret, proto_message, time
 
+  def receive_batch(self, max_num=0, timeout=0):
+    """ receive all buffered messages at once, waits for the first message up to timeout
+
+    :param max_num: maximum number of returned messages (0 == all buffered)
+    :type max_num:  int
+    :param timeout: receive timeout in ms (-1 == infinite)
+    :type timeout:  int
+
+    :return: list of (protobuf message, time) tuples
+
+    """
+    batch = []
+    for msg, time in self.c_subscriber.receive_batch(max_num, timeout):
+      proto_message = self.protobuf_type()
+      proto_message.ParseFromString(msg)
+      batch.append((proto_message, time))
+    return batch
+
   def set_callback(self, callback):
     """ set callback function for incoming messages
 
@@ -115,7 +144,8 @@ class ProtoSubscriber(MessageSubscriber):
 
     """
     self.callback = callback
-    self.c_subscriber.set_callback(self._on_receive)
+    # the message is parsed inside of the callback, so there is no need to copy the receive buffer
+    self.c_subscriber.set_callback(self._on_receive, zero_copy=True)
 
   def rem_callback(self, callback):
     """ remove callback function for incoming messages
@@ -153,6 +183,17 @@ class StringSubscriber(MessageSubscriber):
       msg = ""
     return ret, msg, time
 
+  def receive_batch(self, max_num=0, timeout=0):
+    """ receive all buffered messages at once, waits for the first message up to timeout
+
+    :param max_num: maximum number of returned messages (0 == all buffered)
+    :param timeout: receive timeout in ms (-1 == infinite)
+
+    :return: list of (string, time) tuples
+
+    """
+    return [(msg.decode(), time) for msg, time in self.c_subscriber.receive_batch(max_num, timeout)]
+
   def set_callback(self, callback):
     """ set callback function for incoming messages
 
@@ -160,7 +201,8 @@ class StringSubscriber(MessageSubscriber):
 
     """
     self.callback = callback
-    self.c_subscriber.set_callback(self._on_receive)
+    # the message is parsed inside of the callback, so there is no need to copy the receive buffer
+    self.c_subscriber.set_callback(self._on_receive, zero_copy=True)
 
   def rem_callback(self, callback):
     """ remove callback function for incoming messages
@@ -172,7 +214,7 @@ class StringSubscriber(MessageSubscriber):
     self.callback = None
 
   def _on_receive(self, topic_name, msg, time):
-    self.callback(topic_name, msg.decode(), time)    
+    self.callback(topic_name, str(msg, "utf-8"), time)
 
 
 if __name__ == '__main__':
@@ -30,8 +30,14 @@
 
 #include <ecal/msg/protobuf/dynamic_json_subscriber.h>
 
+#include <algorithm>
 #include <unordered_map>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 
 #ifdef _MSC_VER
@@ -51,6 +57,38 @@ typedef std::unordered_map<ECAL_HANDLE, PyObject*> PySubscriberCallbackMapT;
 typedef std::unordered_map<std::string, PyObject*> PyServerMethodCallbackMapT;
 typedef std::unordered_map<ECAL_HANDLE, PyObject*> PyClientCallbackMapT;
 
+// bounded queue that is filled by the eCAL receive thread without the GIL
+// and drained in batches by sub_receive_batch
+struct SSubscriberBatchQueue
+{
+  explicit SSubscriberBatchQueue(size_t size_) : samples(size_), head(0), count(0), closed(false) {}
+
+  struct SSample
+  {
+    SSample() : time(0) {}
+    std::string payload;
+    long long   time;
+  };
+
+  std::mutex                sync;
+  std::condition_variable   cv;
+  std::vector<SSample>      samples;
+  size_t                    head;
+  size_t                    count;
+  bool                      closed;
+};
+typedef std::unordered_map<ECAL_HANDLE, std::shared_ptr<SSubscriberBatchQueue>> PySubscriberBatchQueueMapT;
+
+// exports the receive buffer of a zero copy subscriber callback, the exports are
+// counted to detect buffers that the callback keeps beyond its return
+struct PyReceiveBuffer
+{
+  PyObject_HEAD
+  const char* buf;      // nullptr after the callback, no new exports are handed out then
+  Py_ssize_t  len;
+  Py_ssize_t  exports;
+};
+
 
 /****************************************/
 /*      globals                         */
@@ -72,9 +110,12 @@ typedef std::unordered_map<ECAL_HANDLE, PyObject*> PyClientCallbackMapT;
 #endif
 
 PySubscriberCallbackMapT    g_subscriber_pycallback_map;
+PySubscriberBatchQueueMapT  g_subscriber_batch_queue_map;
 PyServerMethodCallbackMapT  g_server_method_pycallback_map;
 PyClientCallbackMapT        g_client_pycallback_map;
 
+static PyTypeObject         g_receive_buffer_type = { PyVarObject_HEAD_INIT(nullptr, 0) };
+
 
 /****************************************/
 /*      help                            */
@@ -431,17 +472,20 @@ PyObject* pub_set_max_bandwidth_udp(PyObject* /*self*/, PyObject* args)
 PyObject* pub_send(PyObject* /*self*/, PyObject* args)
 {
   ECAL_HANDLE  topic_handle = nullptr;
-  char*        payload      = nullptr;
-  Py_ssize_t   length       = 0;
+  Py_buffer    payload;
   PY_LONG_LONG time         = 0;
 
-  if (!PyArg_ParseTuple(args, "ny#L", &topic_handle, &payload, &length, &time))
+  // any contiguous buffer (bytes, bytearray, memoryview, numpy array ..) is passed without an intermediate copy
+  if (!PyArg_ParseTuple(args, "ny*L", &topic_handle, &payload, &time))
     return nullptr;
 
+  // the buffer stays locked until it is released, so the interpreter may run meanwhile
   int sent{ 0 };
-  //Py_BEGIN_ALLOW_THREADS
-    sent = pub_send(topic_handle, payload, (int)length, time);
-  //Py_END_ALLOW_THREADS
+  Py_BEGIN_ALLOW_THREADS
+    sent = pub_send(topic_handle, static_cast<const char*>(payload.buf), (int)payload.len, time);
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&payload);
 
   return(Py_BuildValue("i", sent));
 }
@@ -452,20 +496,40 @@ PyObject* pub_send(PyObject* /*self*/, PyObject* args)
 PyObject* pub_send_sync(PyObject* /*self*/, PyObject* args)
 {
   ECAL_HANDLE  topic_handle = nullptr;
-  char* payload = nullptr;
-  Py_ssize_t   length      = 0;
+  Py_buffer    payload;
   PY_LONG_LONG time        = 0;
   PY_LONG_LONG ack_timeout = 0;
 
-  if (!PyArg_ParseTuple(args, "ny#LL", &topic_handle, &payload, &length, &time, &ack_timeout))
+  if (!PyArg_ParseTuple(args, "ny*LL", &topic_handle, &payload, &time, &ack_timeout))
     return nullptr;
 
   int sent{ 0 };
-  sent = pub_send_sync(topic_handle, payload, (int)length, time, ack_timeout);
+  Py_BEGIN_ALLOW_THREADS
+    sent = pub_send_sync(topic_handle, static_cast<const char*>(payload.buf), (int)payload.len, time, ack_timeout);
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&payload);
 
   return(Py_BuildValue("i", sent));
 }
 
+/****************************************/
+/*      sub batch queue helper          */
+/****************************************/
+static void close_subscriber_batch_queue(ECAL_HANDLE handle_)
+{
+  PySubscriberBatchQueueMapT::iterator iter = g_subscriber_batch_queue_map.find(handle_);
+  if (iter == g_subscriber_batch_queue_map.end()) return;
+
+  // wake up a waiting sub_receive_batch, it still owns a reference to the queue
+  {
+    const std::lock_guard<std::mutex> lock(iter->second->sync);
+    iter->second->closed = true;
+  }
+  iter->second->cv.notify_all();
+  g_subscriber_batch_queue_map.erase(iter);
+}
+
 /****************************************/
 /*      sub_create                      */
 /****************************************/
@@ -498,6 +562,7 @@ PyObject* sub_destroy(PyObject* /*self*/, PyObject* args)
   Py_BEGIN_ALLOW_THREADS
     destroyed = sub_destroy(topic_handle);
   Py_END_ALLOW_THREADS
+  close_subscriber_batch_queue(topic_handle);
   return(Py_BuildValue("i", destroyed));
 }
 
@@ -573,10 +638,45 @@ PyObject* sub_receive(PyObject* /*self*/, PyObject* args)
   return(ret_obj);
 }
 
+/****************************************/
+/*      receive buffer                  */
+/****************************************/
+static int receive_buffer_getbuffer(PyObject* self_, Py_buffer* view_, int flags_)
+{
+  PyReceiveBuffer* self = reinterpret_cast<PyReceiveBuffer*>(self_);
+  if (self->buf == nullptr)
+  {
+    PyErr_SetString(PyExc_BufferError, "the received message is only valid during the subscriber callback");
+    view_->obj = nullptr;
+    return -1;
+  }
+
+  if (PyBuffer_FillInfo(view_, self_, const_cast<char*>(self->buf), self->len, 1, flags_) != 0) return -1;
+  self->exports++;
+  return 0;
+}
+
+static void receive_buffer_releasebuffer(PyObject* self_, Py_buffer* /*view_*/)
+{
+  reinterpret_cast<PyReceiveBuffer*>(self_)->exports--;
+}
+
+static PyBufferProcs g_receive_buffer_procs = { receive_buffer_getbuffer, receive_buffer_releasebuffer };
+
+static int init_receive_buffer_type()
+{
+  g_receive_buffer_type.tp_name      = "_ecal_core_py.ReceiveBuffer";
+  g_receive_buffer_type.tp_basicsize = sizeof(PyReceiveBuffer);
+  g_receive_buffer_type.tp_flags     = Py_TPFLAGS_DEFAULT;
+  g_receive_buffer_type.tp_doc       = "read-only receive buffer of a zero copy subscriber callback";
+  g_receive_buffer_type.tp_as_buffer = &g_receive_buffer_procs;
+  return(PyType_Ready(&g_receive_buffer_type));
+}
+
 /****************************************/
 /*      sub_set_callback                */
 /****************************************/
-static void c_subscriber_callback(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_, ECAL_HANDLE handle_, const std::string& python_formatter)
+static void c_subscriber_callback(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_, ECAL_HANDLE handle_, bool zero_copy_)
 {
 #if ECAL_PY_INIT_THREADS_NEEDED
   if (!g_pygil_init)
@@ -589,9 +689,28 @@ static void c_subscriber_callback(const char* topic_name_, const struct eCAL::SR
   PyGILState_STATE state = PyGILState_Ensure();
 
   PyObject* topic_name = Py_BuildValue("s",  topic_name_);
-  PyObject* content    = PyByteArray_FromStringAndSize((char*)data_->buf, (Py_ssize_t)data_->size);
   PyObject* time       = Py_BuildValue("L",  data_->time);
 
+  // a zero copy callback gets a read-only memoryview of the receive buffer, which is released after the callback
+  PyObject*        content(nullptr);
+  PyReceiveBuffer* buffer(nullptr);
+  if (zero_copy_)
+  {
+    buffer = PyObject_New(PyReceiveBuffer, &g_receive_buffer_type);
+    if (buffer != nullptr)
+    {
+      buffer->buf     = static_cast<const char*>(data_->buf);
+      buffer->len     = (Py_ssize_t)data_->size;
+      buffer->exports = 0;
+      content = PyMemoryView_FromObject(reinterpret_cast<PyObject*>(buffer));
+    }
+  }
+  else
+  {
+    content = PyByteArray_FromStringAndSize((char*)data_->buf, (Py_ssize_t)data_->size);
+  }
+  Py_XINCREF(content);
+
   PyObject* args = PyTuple_New(3);
   PyTuple_SetItem(args, 0, topic_name);
   PyTuple_SetItem(args, 1, content);
@@ -601,12 +720,36 @@ static void c_subscriber_callback(const char* topic_name_, const struct eCAL::SR
   if (iter != g_subscriber_pycallback_map.end())
   {
     PyObject* py_callback = iter->second;
-    PyObject_CallObject(py_callback, args);
+    PyObject* result = PyObject_CallObject(py_callback, args);
+    Py_XDECREF(result);
     if (PyErr_Occurred()) { PyErr_Print(); }
   }
 
   Py_DECREF(args);
 
+  if (zero_copy_ && (content != nullptr))
+  {
+    // invalidates all references to the view that the callback kept, release fails if buffers exported from the view are still alive
+    PyObject* released = PyObject_CallMethod(content, "release", nullptr);
+    if (released == nullptr) PyErr_Clear();
+    Py_XDECREF(released);
+  }
+  Py_XDECREF(content);
+
+  if (buffer != nullptr)
+  {
+    // every export that is still alive (e.g. numpy.frombuffer) points into the receive buffer, which is reused after the return
+    const Py_ssize_t kept_exports = buffer->exports;
+    buffer->buf = nullptr;
+    buffer->len = 0;
+    if (kept_exports > 0)
+    {
+      PyErr_Format(PyExc_BufferError, "zero copy subscriber callback of topic '%s' kept %zd buffer(s) of the received message, they are invalid after the callback, copy the message (bytes(msg)) to keep it", topic_name_, kept_exports);
+      PyErr_Print();
+    }
+    Py_DECREF(buffer);
+  }
+
   PyGILState_Release(state);
 }
 
@@ -614,8 +757,9 @@ PyObject* sub_set_callback(PyObject* /*self*/, PyObject* args)
 {
   ECAL_HANDLE topic_handle = nullptr;
   PyObject*   cb_func      = nullptr;
+  int         zero_copy    = 0;
 
-  if (!PyArg_ParseTuple(args, "nO", &topic_handle, &cb_func))
+  if (!PyArg_ParseTuple(args, "nO|p", &topic_handle, &cb_func, &zero_copy))
     return nullptr;
 
   eCAL::CSubscriber* sub = (eCAL::CSubscriber*)topic_handle;
@@ -645,11 +789,13 @@ PyObject* sub_set_callback(PyObject* /*self*/, PyObject* args)
     Py_XINCREF(cb_func);                        /* Add a reference to new callback */
     g_subscriber_pycallback_map[sub] = cb_func;            /* Add new callback */
 
+    // the callback replaces the batch receive callback
+    close_subscriber_batch_queue(sub);
+
     bool added_callback{ false };
 
-    std::string python_formatter{ "y#" };
     Py_BEGIN_ALLOW_THREADS
-    added_callback = sub->AddReceiveCallback(std::bind(c_subscriber_callback, std::placeholders::_1, std::placeholders::_2, sub, python_formatter));
+    added_callback = sub->AddReceiveCallback(std::bind(c_subscriber_callback, std::placeholders::_1, std::placeholders::_2, sub, zero_copy != 0));
     Py_END_ALLOW_THREADS
 
     if (added_callback)
@@ -684,6 +830,7 @@ PyObject* sub_rem_callback(PyObject* /*self*/, PyObject* args)
     Py_XDECREF(py_callback);                    /* Dispose of previous callback */
     g_subscriber_pycallback_map.erase(iter);               /* Delete previous callback */
   }
+  close_subscriber_batch_queue(sub);
 
   bool removed_callback{ false };
   Py_BEGIN_ALLOW_THREADS
@@ -699,6 +846,140 @@ PyObject* sub_rem_callback(PyObject* /*self*/, PyObject* args)
   }
 };
 
+/****************************************/
+/*      sub_enable_batch_receive        */
+/****************************************/
+static std::shared_ptr<SSubscriberBatchQueue> enable_subscriber_batch_queue(eCAL::CSubscriber* sub_, size_t queue_size_)
+{
+  // the batch queue replaces the python callback
+  PySubscriberCallbackMapT::const_iterator iter = g_subscriber_pycallback_map.find(sub_);
+  if (iter != g_subscriber_pycallback_map.end())
+  {
+    Py_XDECREF(iter->second);
+    g_subscriber_pycallback_map.erase(iter);
+  }
+  close_subscriber_batch_queue(sub_);
+
+  auto queue = std::make_shared<SSubscriberBatchQueue>(std::max(queue_size_, size_t(1)));
+
+  // runs on the eCAL receive thread, the oldest sample is dropped if the queue is full
+  auto on_receive = [queue](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(queue->sync);
+      const size_t queue_size = queue->samples.size();
+      if (queue->count == queue_size)
+      {
+        queue->head = (queue->head + 1) % queue_size;
+        queue->count--;
+      }
+      SSubscriberBatchQueue::SSample& sample = queue->samples[(queue->head + queue->count) % queue_size];
+      sample.payload.assign(static_cast<const char*>(data_->buf), static_cast<size_t>(data_->size));
+      sample.time = data_->time;
+      queue->count++;
+    }
+    queue->cv.notify_one();
+  };
+
+  bool added_callback{ false };
+  Py_BEGIN_ALLOW_THREADS
+    added_callback = sub_->AddReceiveCallback(on_receive);
+  Py_END_ALLOW_THREADS
+  if (!added_callback) return(nullptr);
+
+  g_subscriber_batch_queue_map[sub_] = queue;
+  return(queue);
+}
+
+PyObject* sub_enable_batch_receive(PyObject* /*self*/, PyObject* args)
+{
+  ECAL_HANDLE topic_handle = nullptr;
+  Py_ssize_t  queue_size   = 0;
+
+  if (!PyArg_ParseTuple(args, "nn", &topic_handle, &queue_size))
+    return nullptr;
+
+  eCAL::CSubscriber* sub = (eCAL::CSubscriber*)topic_handle;
+  if (!sub)
+  {
+    return(Py_BuildValue("is", -1, "subscriber invalid"));
+  }
+
+  if (enable_subscriber_batch_queue(sub, queue_size > 0 ? static_cast<size_t>(queue_size) : 0))
+  {
+    return Py_BuildValue("is", 1, "batch receive enabled");
+  }
+  return Py_BuildValue("is", 0, "error: could not enable batch receive");
+}
+
+/****************************************/
+/*      sub_receive_batch               */
+/****************************************/
+PyObject* sub_receive_batch(PyObject* /*self*/, PyObject* args)
+{
+  ECAL_HANDLE topic_handle = nullptr;
+  Py_ssize_t  max_num      = 0;
+  int         timeout      = 0;
+
+  if (!PyArg_ParseTuple(args, "nni", &topic_handle, &max_num, &timeout))
+    return nullptr;
+
+  eCAL::CSubscriber* sub = (eCAL::CSubscriber*)topic_handle;
+  if (!sub)
+  {
+    PyErr_SetString(PyExc_ValueError, "subscriber invalid");
+    return nullptr;
+  }
+
+  // the first call enables the batch queue with its default size
+  std::shared_ptr<SSubscriberBatchQueue> queue;
+  PySubscriberBatchQueueMapT::const_iterator iter = g_subscriber_batch_queue_map.find(sub);
+  if (iter != g_subscriber_batch_queue_map.end()) queue = iter->second;
+  else                                            queue = enable_subscriber_batch_queue(sub, 1024);
+  if (!queue)
+  {
+    PyErr_SetString(PyExc_RuntimeError, "could not enable batch receive");
+    return nullptr;
+  }
+
+  // wait for the first sample and take up to max_num samples without the GIL,
+  // the payloads are swapped out of the queue, so the lock is held only shortly
+  std::vector<SSubscriberBatchQueue::SSample> batch;
+  Py_BEGIN_ALLOW_THREADS
+  {
+    std::unique_lock<std::mutex> lock(queue->sync);
+    auto ready = [&queue]() { return (queue->count > 0) || queue->closed; };
+    if (timeout < 0) queue->cv.wait(lock, ready);
+    else             queue->cv.wait_for(lock, std::chrono::milliseconds(timeout), ready);
+
+    const size_t num = (max_num > 0) ? std::min(queue->count, static_cast<size_t>(max_num)) : queue->count;
+    batch.resize(num);
+    for (auto& sample : batch)
+    {
+      std::swap(sample, queue->samples[queue->head]);
+      queue->head = (queue->head + 1) % queue->samples.size();
+      queue->count--;
+    }
+  }
+  Py_END_ALLOW_THREADS
+
+  // one GIL acquisition for the whole batch, a list of (content, time) tuples
+  PyObject* list = PyList_New(static_cast<Py_ssize_t>(batch.size()));
+  if (list == nullptr) return nullptr;
+  for (size_t i = 0; i < batch.size(); ++i)
+  {
+    PyObject* item = Py_BuildValue("y#L", batch[i].payload.data(), (Py_ssize_t)batch[i].payload.size(), batch[i].time);
+    if (item == nullptr)
+    {
+      Py_DECREF(list);
+      return nullptr;
+    }
+    PyList_SET_ITEM(list, static_cast<Py_ssize_t>(i), item);
+  }
+
+  return(list);
+}
+
 /****************************************/
 /*      dyn_json_sub_create             */
 /****************************************/
@@ -773,8 +1054,7 @@ PyObject* dyn_json_sub_set_callback(PyObject* /*self*/, PyObject* args)
     g_subscriber_pycallback_map[sub] = cb_func;            /* Add new callback */
     bool added_callback{ false };
     Py_BEGIN_ALLOW_THREADS
-      std::string python_formatter{ "s#" };
-      added_callback = sub->AddReceiveCallback(std::bind(c_subscriber_callback, std::placeholders::_1, std::placeholders::_2, sub, python_formatter));
+      added_callback = sub->AddReceiveCallback(std::bind(c_subscriber_callback, std::placeholders::_1, std::placeholders::_2, sub, false));
     Py_END_ALLOW_THREADS
 
     if (added_callback)
@@ -902,18 +1182,21 @@ static int c_server_method_callback(const std::string& method_name_, const std::
     PyObject* result = PyObject_CallObject(py_callback, args);
     if (PyErr_Occurred()) { PyErr_Print(); }
 
+    // the response can be any buffer object
     int         cb_ret_state    = 0;
-    const char* cb_response     = nullptr;
-    Py_ssize_t  cb_response_len = 0;
-    if (PyArg_ParseTuple(result, "iy#", &cb_ret_state, &cb_response, &cb_response_len))
+    Py_buffer   cb_response;
+    if ((result != nullptr) && PyArg_ParseTuple(result, "iy*", &cb_ret_state, &cb_response))
     {
       ret_state = cb_ret_state;
-      response_ = std::string(cb_response, (int)cb_response_len);
+      response_.assign(static_cast<const char*>(cb_response.buf), static_cast<size_t>(cb_response.len));
+      PyBuffer_Release(&cb_response);
     }
     else
     {
       // parse error !!
+      if (PyErr_Occurred()) { PyErr_Print(); }
     }
+    Py_XDECREF(result);
   }
 
   Py_DECREF(args);
@@ -1080,14 +1363,19 @@ PyObject* client_call_method(PyObject* /*self*/, PyObject* args)   // (client_ha
 {
   ECAL_HANDLE client_handle = nullptr;
   const char* method_name   = nullptr;
-  const char* request       = nullptr;
-  Py_ssize_t  request_len   = 0;
+  Py_buffer   request;
   int         timeout       = -1;
 
-  PyArg_ParseTuple(args, "nsy#i", &client_handle, &method_name, &request, &request_len, &timeout);
+  if (!PyArg_ParseTuple(args, "nsy*i", &client_handle, &method_name, &request, &timeout))
+    return nullptr;
 
+  // the buffer stays locked until it is released, so the interpreter may run meanwhile
   bool called_method{ false };
-  called_method = client_call_method(client_handle, method_name, request, (int)request_len, timeout);
+  Py_BEGIN_ALLOW_THREADS
+    called_method = client_call_method(client_handle, method_name, static_cast<const char*>(request.buf), (int)request.len, timeout);
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&request);
 
   return(Py_BuildValue("i", called_method));
 }
@@ -1613,9 +1901,12 @@ static PyMethodDef _ecal_methods[] =
 
   {"sub_receive",                   sub_receive,                   METH_VARARGS,  "sub_receive(topic_handle, timeout)"},
 
-  {"sub_set_callback",              sub_set_callback,              METH_VARARGS,  "sub_set_callback(topic_handle, callback)"},
+  {"sub_set_callback",              sub_set_callback,              METH_VARARGS,  "sub_set_callback(topic_handle, callback, zero_copy)"},
   {"sub_rem_callback",              sub_rem_callback,              METH_VARARGS,  "sub_rem_callback(topic_handle, callback)"},
 
+  {"sub_enable_batch_receive",      sub_enable_batch_receive,      METH_VARARGS,  "sub_enable_batch_receive(topic_handle, queue_size)"},
+  {"sub_receive_batch",             sub_receive_batch,             METH_VARARGS,  "sub_receive_batch(topic_handle, max_num, timeout)"},
+
   {"dyn_json_sub_create",           dyn_json_sub_create,           METH_VARARGS,  "dyn_json_sub_create(topic_name)"},
   {"dyn_json_sub_destroy",          dyn_json_sub_destroy,          METH_VARARGS,  "dyn_json_sub_destroy(topic_handle)"},
   {"dyn_json_sub_set_callback",     dyn_json_sub_set_callback,     METH_VARARGS,  "dyn_json_sub_set_callback(topic_handle, callback)"},
@@ -1691,6 +1982,12 @@ PyMODINIT_FUNC PyInit__ecal_core_py(void)
 
   if (module == nullptr)
     return nullptr;
+
+  if (init_receive_buffer_type() < 0) {
+    Py_DECREF(module);
+    return nullptr;
+  }
+
   struct module_state *st = GETSTATE(module);
   
   char err_msg[] = "_ecal_core_py.Error";
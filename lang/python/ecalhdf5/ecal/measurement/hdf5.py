@@ -70,6 +70,9 @@ class Meas():
   def set_channel_type(self, channel_name, type):
     return(self.meas.set_channel_type(channel_name, type))
 
+  def set_channel_compression(self, channel_name, level):
+    return(self.meas.set_channel_compression(channel_name, level))
+
   def get_min_timestamp(self, channel_name):
     return(self.meas.get_min_timestamp(channel_name))
 
@@ -243,6 +243,24 @@ static PyObject* Meas_SetChannelType(Meas *self, PyObject *args)
   Py_RETURN_NONE;
 }
 
+/****************************************/
+/*      SetChannelCompression           */
+/****************************************/
+static PyObject* Meas_SetChannelCompression(Meas *self, PyObject *args)
+{
+  char* channel_name = nullptr;
+  int   level        = 0;
+
+  if (!PyArg_ParseTuple(args, "si", &channel_name, &level))
+    return nullptr;
+
+  if (level > 0)
+    self->hdf5_meas->SetChannelCompression(channel_name, eCAL::eh5::Compression(eCAL::eh5::CompressionCodec::Deflate, level));
+  else
+    self->hdf5_meas->SetChannelCompression(channel_name, eCAL::eh5::Compression());
+  Py_RETURN_NONE;
+}
+
 /****************************************/
 /*      GetMinTimestamp                 */
 /****************************************/
@@ -463,6 +481,7 @@ static PyMethodDef Meas_Methods[] =
 
   {"get_channel_type",        (PyCFunction)Meas_GetChannelType,         METH_VARARGS, "get_channel_type(channel_name)"},
   {"set_channel_type",        (PyCFunction)Meas_SetChannelType,         METH_VARARGS, "set_channel_type(channel_name, type)"},
+  {"set_channel_compression", (PyCFunction)Meas_SetChannelCompression,  METH_VARARGS, "set_channel_compression(channel_name, level)"},
   
   {"get_min_timestamp",       (PyCFunction)Meas_GetMinTimestamp,        METH_VARARGS, "get_min_timestamp(channel_name)"},
   {"get_max_timestamp",       (PyCFunction)Meas_GetMaxTimestamp,        METH_VARARGS, "get_max_timestamp(channel_name)"},
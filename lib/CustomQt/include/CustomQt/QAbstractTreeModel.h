@@ -186,6 +186,19 @@ protected:
 
 public slots:
   void updateItem(const QAbstractTreeItem* item, const QVector<int>& roles = QVector<int>());
+
+  /**
+   * @brief Notifies the views about changed data of the given items
+   *
+   * Items with the same parent in adjacent rows are combined to a single
+   * dataChanged() signal. Use this instead of updateAll(), if only some items
+   * of a large model have changed.
+   *
+   * @param items   The changed items
+   * @param roles   The changed roles. By default, all roles have changed.
+   */
+  void updateItems(const QList<QAbstractTreeItem*>& items, const QVector<int>& roles = QVector<int>());
+
   void updateAll(const QVector<int>& roles = QVector<int>());
 
 private:
@@ -20,6 +20,7 @@
 #include "CustomQt/QAbstractTreeItem.h"
 #include "CustomQt/QAbstractTreeModel.h"
 
+#include <QSet>
 #include <QStringList>
 
 #include <algorithm>
@@ -314,6 +315,48 @@ void QAbstractTreeModel::updateItem(const QAbstractTreeItem* item, const QVector
   emit dataChanged(top_left, bottom_right, roles);
 }
 
+void QAbstractTreeModel::updateItems(const QList<QAbstractTreeItem*>& items, const QVector<int>& roles /*= QVector<int>()*/)
+{
+  // Looking up the row of a single item is linear, so we iterate over the
+  // children of each affected parent once instead.
+  QSet<const QAbstractTreeItem*>  item_set;
+  QSet<const QAbstractTreeItem*>  parent_set;
+  QList<const QAbstractTreeItem*> parent_list;
+  for (const QAbstractTreeItem* item : items)
+  {
+    const QAbstractTreeItem* parent = item->parentItem();
+    if (!parent)
+      continue;
+
+    item_set.insert(item);
+    if (!parent_set.contains(parent))
+    {
+      parent_set.insert(parent);
+      parent_list.push_back(parent);
+    }
+  }
+
+  const int last_column = columnCount() - 1;
+  for (const QAbstractTreeItem* parent : parent_list)
+  {
+    const int child_count = parent->childCount();
+    int first_row = -1;
+    for (int row = 0; row <= child_count; row++)
+    {
+      const bool changed = (row < child_count) && item_set.contains(parent->child(row));
+      if (changed && (first_row < 0))
+      {
+        first_row = row;
+      }
+      else if (!changed && (first_row >= 0))
+      {
+        emit dataChanged(createIndex(first_row, 0, parent->child(first_row)), createIndex(row - 1, last_column, parent->child(row - 1)), roles);
+        first_row = -1;
+      }
+    }
+  }
+}
+
 void QAbstractTreeModel::updateChildrenRecursive(const QAbstractTreeItem* parent, const QVector<int>& roles /*= QVector<int>()*/)
 {
   if (parent->childCount() != 0) {
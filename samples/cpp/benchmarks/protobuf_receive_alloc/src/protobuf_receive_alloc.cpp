@@ -0,0 +1,252 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Protobuf receive allocation benchmark
+ *
+ * Publishes a protobuf scene with repeated nested objects and measures the heap
+ * allocations on the receive thread and the latency per message for every
+ * message allocation of the protobuf subscriber. The "raw" case uses a binary
+ * subscriber and shows the allocations of the transport layer alone.
+**/
+
+#include <ecal/ecal.h>
+#include <ecal/msg/protobuf/publisher.h>
+#include <ecal/msg/protobuf/subscriber.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+
+#include <tclap/CmdLine.h>
+
+#include "scene.pb.h"
+
+// count the heap allocations per thread
+namespace
+{
+  thread_local unsigned long long g_thread_allocations = 0;
+}
+
+void* operator new(std::size_t size_)
+{
+  g_thread_allocations++;
+  void* ptr = std::malloc(size_ != 0 ? size_ : 1);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void* ptr_) noexcept
+{
+  std::free(ptr_);
+}
+
+void operator delete(void* ptr_, std::size_t) noexcept
+{
+  std::free(ptr_);
+}
+
+namespace
+{
+  struct SCase
+  {
+    const char*                         name;
+    bool                                raw;
+    eCAL::protobuf::eMessageAllocation  allocation;
+  };
+
+  const SCase g_cases[] =
+  {
+    { "raw",   true,  eCAL::protobuf::message_allocation_new   },
+    { "new",   false, eCAL::protobuf::message_allocation_new   },
+    { "reuse", false, eCAL::protobuf::message_allocation_reuse },
+    { "arena", false, eCAL::protobuf::message_allocation_arena },
+  };
+
+  // allocations on the receive thread between two callbacks, this includes
+  // the reading and the deserialization of the message
+  struct SMeasurement
+  {
+    SMeasurement() : received(0), allocations(0), latency_us(0), last_allocations(0) {}
+
+    void Measure(long long send_time_)
+    {
+      const unsigned long long allocations_now = g_thread_allocations;
+      if (received > 0)
+      {
+        allocations += allocations_now - last_allocations;
+        latency_us  += eCAL::Time::GetMicroSeconds() - send_time_;
+      }
+      last_allocations = g_thread_allocations;
+      received++;
+    }
+
+    std::atomic<size_t>  received;
+    unsigned long long   allocations;
+    long long            latency_us;
+    unsigned long long   last_allocations;
+  };
+
+  void fill_scene(pb::Benchmark::Scene& scene_, long long seq_, int objects_, int points_)
+  {
+    scene_.Clear();
+    scene_.set_seq(seq_);
+    scene_.set_frame("benchmark_frame_with_a_name_longer_than_the_small_string_buffer");
+    for (int o = 0; o < objects_; ++o)
+    {
+      auto* object = scene_.add_objects();
+      object->set_id(o);
+      object->set_label("object_label_with_a_name_longer_than_the_small_string_buffer");
+      for (int p = 0; p < points_; ++p)
+      {
+        auto* point = object->add_points();
+        point->set_x(p);
+        point->set_y(p + 1);
+        point->set_z(p + 2);
+      }
+    }
+  }
+
+  bool wait_for_receive(const SMeasurement& measurement_, size_t count_)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (measurement_.received < count_)
+    {
+      if (std::chrono::steady_clock::now() > deadline) return(false);
+      std::this_thread::yield();
+    }
+    return(true);
+  }
+
+  void run_case(const SCase& case_, size_t messages_, int objects_, int points_)
+  {
+    const std::string topic_name = std::string("protobuf_receive_alloc_") + case_.name;
+
+    SMeasurement measurement;
+
+    eCAL::CSubscriber                                  raw_sub;
+    eCAL::protobuf::CSubscriber<pb::Benchmark::Scene>  proto_sub;
+    if (case_.raw)
+    {
+      raw_sub.Create(topic_name);
+      raw_sub.AddReceiveCallback([&measurement](const char*, const eCAL::SReceiveCallbackData* data_)
+        {
+          measurement.Measure(data_->time);
+        });
+    }
+    else
+    {
+      proto_sub.Create(topic_name);
+      proto_sub.SetMessageAllocation(case_.allocation);
+      proto_sub.AddReceiveCallback([&measurement](const char*, const pb::Benchmark::Scene&, long long time_, long long, long long)
+        {
+          measurement.Measure(time_);
+        });
+    }
+
+    eCAL::protobuf::CPublisher<pb::Benchmark::Scene> pub(topic_name);
+    pb::Benchmark::Scene scene;
+
+    // wait for the match, the first message also warms up the receive buffers
+    size_t sent(0);
+    for (int i = 0; i < 5000 && measurement.received == 0; ++i)
+    {
+      fill_scene(scene, static_cast<long long>(sent++), objects_, points_);
+      pub.Send(scene);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (measurement.received == 0)
+    {
+      std::cerr << "error: no connection for case " << case_.name << std::endl;
+      return;
+    }
+    // let the pending samples of the matching phase drain
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // paced publishing, every message is received before the next one is sent
+    size_t lost(0);
+    for (size_t i = 0; i < messages_; ++i)
+    {
+      const size_t received = measurement.received;
+      fill_scene(scene, static_cast<long long>(sent++), objects_, points_);
+      pub.Send(scene);
+      if (!wait_for_receive(measurement, received + 1)) lost++;
+    }
+
+    if (case_.raw) raw_sub.RemReceiveCallback();
+    else           proto_sub.RemReceiveCallback();
+
+    const size_t measured = measurement.received - 1;
+    const double allocations_per_msg = measured > 0 ? static_cast<double>(measurement.allocations) / static_cast<double>(measured) : 0.0;
+    const double latency_us          = measured > 0 ? static_cast<double>(measurement.latency_us) / static_cast<double>(measured) : 0.0;
+
+    printf("%-8s %10zu %10zu %10zu %16.2f %12.2f\n", case_.name, scene.ByteSizeLong(), measured, lost, allocations_per_msg, latency_us);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  size_t messages(0);
+  int    objects(0);
+  int    points(0);
+
+  try
+  {
+    // parse command line
+    TCLAP::CmdLine cmd("protobuf_receive_alloc");
+    TCLAP::ValueArg<size_t> messages_arg("n", "messages", "Number of measured messages per case.", false, 1000, "int");
+    TCLAP::ValueArg<int>    objects_arg ("o", "objects",  "Number of objects per scene.",          false, 32,   "int");
+    TCLAP::ValueArg<int>    points_arg  ("p", "points",   "Number of points per object.",          false, 16,   "int");
+    cmd.add(messages_arg);
+    cmd.add(objects_arg);
+    cmd.add(points_arg);
+    cmd.parse(argc, argv);
+
+    messages = messages_arg.getValue();
+    objects  = objects_arg.getValue();
+    points   = points_arg.getValue();
+  }
+  catch (TCLAP::ArgException &e)  // catch any exceptions
+  {
+    std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // initialize eCAL API
+  eCAL::Initialize({ "--ecal-set-config-key", "common/registration_fast_discovery:true" }, "protobuf_receive_alloc");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  printf("%-8s %10s %10s %10s %16s %12s\n", "case", "bytes", "messages", "lost", "allocations/msg", "latency us");
+  for (const auto& c : g_cases)
+  {
+    run_case(c, messages, objects, points);
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+
+  return(0);
+}
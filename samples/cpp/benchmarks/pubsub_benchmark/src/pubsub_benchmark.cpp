@@ -0,0 +1,395 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Unified publish / subscribe benchmark
+ *
+ * Runs publisher and subscribers in a single process for every combination of
+ * transport layer, payload size and subscriber fan-out and writes latency
+ * percentiles, throughput and cpu time per message as JSON.
+**/
+
+#include <ecal/ecal.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+namespace
+{
+  struct SLayer
+  {
+    std::string                    name;
+    eCAL::TLayer::eTransportLayer  layer;
+    bool                           zero_copy;
+  };
+
+  const std::vector<SLayer> g_layers =
+  {
+    { "shm",    eCAL::TLayer::tlayer_shm,    false },
+    { "shm_zc", eCAL::TLayer::tlayer_shm,    true  },
+    { "udp",    eCAL::TLayer::tlayer_udp_mc, false },
+    { "tcp",    eCAL::TLayer::tlayer_tcp,    false },
+    { "inproc", eCAL::TLayer::tlayer_inproc, false },
+  };
+
+  struct SResult
+  {
+    SResult() : sent(0), expected(0), received(0), elapsed_s(0.0), cpu_s(0.0), lat_min(0), lat_mean(0.0), lat_p50(0), lat_p90(0), lat_p99(0), lat_p999(0), lat_max(0) {}
+
+    std::string  error;
+    size_t       sent;
+    size_t       expected;
+    size_t       received;
+    double       elapsed_s;
+    double       cpu_s;
+    long long    lat_min;
+    double       lat_mean;
+    long long    lat_p50;
+    long long    lat_p90;
+    long long    lat_p99;
+    long long    lat_p999;
+    long long    lat_max;
+  };
+
+  // state of a single subscriber, the latencies are written by its callback only
+  struct SSubscriber
+  {
+    explicit SSubscriber(const std::string& topic_name_) : sub(topic_name_), received(0) {}
+
+    eCAL::CSubscriber       sub;
+    std::atomic<size_t>     received;
+    std::vector<long long>  latencies;
+  };
+
+  std::vector<std::string> split(const std::string& list_)
+  {
+    std::vector<std::string> items;
+    std::stringstream ss(list_);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+      if (!item.empty()) items.push_back(item);
+    }
+    return(items);
+  }
+
+  // parses sizes like "8", "64k", "16M"
+  size_t parse_size(const std::string& size_)
+  {
+    size_t pos(0);
+    size_t size = std::stoull(size_, &pos);
+    if (pos < size_.size())
+    {
+      switch (size_[pos])
+      {
+      case 'k':
+      case 'K':
+        size *= 1024;
+        break;
+      case 'm':
+      case 'M':
+        size *= 1024 * 1024;
+        break;
+      default:
+        throw std::invalid_argument("invalid size suffix in \"" + size_ + "\"");
+      }
+    }
+    return(size);
+  }
+
+  long long percentile(const std::vector<long long>& sorted_, double p_)
+  {
+    if (sorted_.empty()) return(0);
+    size_t rank = static_cast<size_t>(p_ * static_cast<double>(sorted_.size()));
+    return(sorted_[std::min(rank, sorted_.size() - 1)]);
+  }
+
+  // waits until every subscriber has received at least count_ messages
+  bool wait_for_receive(const std::vector<std::unique_ptr<SSubscriber>>& subs_, size_t count_, std::chrono::milliseconds timeout_)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + timeout_;
+    for (;;)
+    {
+      bool all_received(true);
+      for (const auto& sub : subs_)
+      {
+        if (sub->received < count_) { all_received = false; break; }
+      }
+      if (all_received) return(true);
+      if (std::chrono::steady_clock::now() > deadline) return(false);
+      std::this_thread::yield();
+    }
+  }
+
+  SResult run_case(const SLayer& layer_, size_t size_, size_t fanout_, size_t messages_, size_t warmups_, std::chrono::milliseconds timeout_)
+  {
+    SResult result;
+
+    // every case gets its own topic, so late samples of the last case can not interfere
+    static int case_id(0);
+    const std::string topic_name = "pubsub_benchmark_" + std::to_string(case_id++);
+
+    eCAL::CPublisher pub(topic_name);
+    pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+    pub.SetLayerMode(layer_.layer, eCAL::TLayer::smode_on);
+    pub.ShmEnableZeroCopy(layer_.zero_copy);
+
+    // only measured samples add their latency
+    std::atomic<bool> measuring(false);
+
+    std::vector<std::unique_ptr<SSubscriber>> subs;
+    for (size_t i = 0; i < fanout_; ++i)
+    {
+      subs.emplace_back(new SSubscriber(topic_name));
+      SSubscriber* state = subs.back().get();
+      state->latencies.reserve(messages_);
+      state->sub.AddReceiveCallback([state, &measuring](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+        {
+          if (measuring) state->latencies.push_back(eCAL::Time::GetMicroSeconds() - data_->time);
+          state->received++;
+        });
+    }
+
+    std::string payload(size_, 'x');
+
+    // let them match, send until every subscriber got a first sample
+    const auto match_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    for (;;)
+    {
+      pub.Send(payload.data(), payload.size(), eCAL::Time::GetMicroSeconds());
+      if (wait_for_receive(subs, 1, std::chrono::milliseconds(10))) break;
+      if (std::chrono::steady_clock::now() > match_deadline)
+      {
+        result.error = "subscribers did not match";
+        return(result);
+      }
+    }
+
+    // warmup, wait for the pending samples of the matching phase to drain
+    for (size_t i = 0; i < warmups_; ++i)
+    {
+      pub.Send(payload.data(), payload.size(), eCAL::Time::GetMicroSeconds());
+      wait_for_receive(subs, i + 2, timeout_);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    std::vector<size_t> base;
+    for (const auto& sub : subs) base.push_back(sub->received);
+    const size_t base_min = *std::min_element(base.begin(), base.end());
+
+    // measure, every sample is sent when the last one has been received by all subscribers
+    measuring = true;
+    const std::clock_t cpu_start  = std::clock();
+    const auto         wall_start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < messages_; ++i)
+    {
+      pub.Send(payload.data(), payload.size(), eCAL::Time::GetMicroSeconds());
+      wait_for_receive(subs, base_min + i + 1, timeout_);
+    }
+    const auto         wall_end = std::chrono::steady_clock::now();
+    const std::clock_t cpu_end  = std::clock();
+
+    // unsubscribe before evaluating the latencies written by the callbacks
+    for (auto& sub : subs) sub->sub.Destroy();
+
+    std::vector<long long> latencies;
+    for (size_t i = 0; i < subs.size(); ++i)
+    {
+      result.received += subs[i]->received - base[i];
+      latencies.insert(latencies.end(), subs[i]->latencies.begin(), subs[i]->latencies.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    result.sent      = messages_;
+    result.expected  = messages_ * fanout_;
+    result.elapsed_s = std::chrono::duration<double>(wall_end - wall_start).count();
+    result.cpu_s     = static_cast<double>(cpu_end - cpu_start) / CLOCKS_PER_SEC;
+    if (!latencies.empty())
+    {
+      long long sum(0);
+      for (auto latency : latencies) sum += latency;
+      result.lat_min  = latencies.front();
+      result.lat_mean = static_cast<double>(sum) / static_cast<double>(latencies.size());
+      result.lat_p50  = percentile(latencies, 0.5);
+      result.lat_p90  = percentile(latencies, 0.9);
+      result.lat_p99  = percentile(latencies, 0.99);
+      result.lat_p999 = percentile(latencies, 0.999);
+      result.lat_max  = latencies.back();
+    }
+
+    return(result);
+  }
+
+  void write_json(std::ostream& out_, const SLayer& layer_, size_t size_, size_t fanout_, const SResult& result_, bool first_)
+  {
+    const double delivered_bytes = static_cast<double>(result_.received) * static_cast<double>(size_);
+    const double elapsed_s       = (result_.elapsed_s > 0.0) ? result_.elapsed_s : 1.0;
+
+    out_ << (first_ ? "\n" : ",\n");
+    out_ << "    {";
+    out_ << "\"layer\": \""        << layer_.name << "\", ";
+    out_ << "\"payload_bytes\": "  << size_       << ", ";
+    out_ << "\"subscribers\": "    << fanout_     << ", ";
+    if (!result_.error.empty())
+    {
+      out_ << "\"error\": \"" << result_.error << "\"}";
+      return;
+    }
+    out_ << "\"messages_sent\": "      << result_.sent                                  << ", ";
+    out_ << "\"messages_received\": "  << result_.received                              << ", ";
+    out_ << "\"messages_lost\": "      << result_.expected - std::min(result_.expected, result_.received) << ", ";
+    out_ << "\"elapsed_s\": "          << result_.elapsed_s                             << ", ";
+    out_ << "\"messages_per_s\": "     << static_cast<double>(result_.received) / elapsed_s << ", ";
+    out_ << "\"throughput_mb_per_s\": " << delivered_bytes / (1024.0 * 1024.0) / elapsed_s << ", ";
+    out_ << "\"cpu_us_per_message\": " << ((result_.received > 0) ? result_.cpu_s * 1e6 / static_cast<double>(result_.received) : 0.0) << ", ";
+    out_ << "\"latency_us\": {";
+    out_ << "\"min\": "  << result_.lat_min  << ", ";
+    out_ << "\"mean\": " << result_.lat_mean << ", ";
+    out_ << "\"p50\": "  << result_.lat_p50  << ", ";
+    out_ << "\"p90\": "  << result_.lat_p90  << ", ";
+    out_ << "\"p99\": "  << result_.lat_p99  << ", ";
+    out_ << "\"p999\": " << result_.lat_p999 << ", ";
+    out_ << "\"max\": "  << result_.lat_max  << "}}";
+  }
+}
+
+// main entry
+int main(int argc, char **argv)
+{
+  std::vector<SLayer> layers;
+  std::vector<size_t> sizes;
+  std::vector<size_t> fanouts;
+  size_t              messages(0);
+  size_t              max_bytes(0);
+  size_t              warmups(0);
+  int                 timeout_ms(0);
+  std::string         output;
+
+  try
+  {
+    // parse command line
+    TCLAP::CmdLine cmd("pubsub_benchmark");
+    TCLAP::ValueArg<std::string> layers_arg   ("l", "layers",    "Comma separated transport layers (shm, shm_zc, udp, tcp, inproc).",        false, "shm,shm_zc,udp,tcp,inproc",             "string");
+    TCLAP::ValueArg<std::string> sizes_arg    ("s", "sizes",     "Comma separated payload sizes in bytes, k and M suffixes are supported.", false, "8,64,512,4k,32k,256k,2M,16M,64M",       "string");
+    TCLAP::ValueArg<std::string> fanouts_arg  ("f", "fanout",    "Comma separated numbers of subscribers.",                                 false, "1,4,16,64",                             "string");
+    TCLAP::ValueArg<size_t>      messages_arg ("n", "messages",  "Number of measured messages per case.",                                   false, 1000,                                    "int");
+    TCLAP::ValueArg<size_t>      max_mb_arg   ("m", "max_mb",    "Limits the measured messages per case to this amount of payload in MB.",  false, 1024,                                    "int");
+    TCLAP::ValueArg<size_t>      warmups_arg  ("w", "warmups",   "Number of warmup messages per case.",                                     false, 10,                                      "int");
+    TCLAP::ValueArg<int>         timeout_arg  ("t", "timeout",   "Time in ms to wait for a message, before it is counted as lost.",         false, 1000,                                    "int");
+    TCLAP::ValueArg<std::string> output_arg   ("o", "output",    "JSON output file, stdout if not set.",                                    false, "",                                      "string");
+    cmd.add(layers_arg);
+    cmd.add(sizes_arg);
+    cmd.add(fanouts_arg);
+    cmd.add(messages_arg);
+    cmd.add(max_mb_arg);
+    cmd.add(warmups_arg);
+    cmd.add(timeout_arg);
+    cmd.add(output_arg);
+    cmd.parse(argc, argv);
+
+    for (const auto& name : split(layers_arg.getValue()))
+    {
+      auto iter = std::find_if(g_layers.begin(), g_layers.end(), [&name](const SLayer& layer_) { return layer_.name == name; });
+      if (iter == g_layers.end())
+      {
+        std::cerr << "error: unknown layer \"" << name << "\"" << std::endl;
+        return EXIT_FAILURE;
+      }
+      layers.push_back(*iter);
+    }
+    for (const auto& size   : split(sizes_arg.getValue()))   sizes.push_back(parse_size(size));
+    for (const auto& fanout : split(fanouts_arg.getValue())) fanouts.push_back(std::stoull(fanout));
+    messages   = messages_arg.getValue();
+    max_bytes  = max_mb_arg.getValue() * 1024 * 1024;
+    warmups    = warmups_arg.getValue();
+    timeout_ms = timeout_arg.getValue();
+    output     = output_arg.getValue();
+  }
+  catch (TCLAP::ArgException &e)  // catch any exceptions
+  {
+    std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+    return EXIT_FAILURE;
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::ofstream output_file;
+  if (!output.empty())
+  {
+    output_file.open(output);
+    if (!output_file.is_open())
+    {
+      std::cerr << "error: could not open \"" << output << "\"" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  std::ostream& out = output.empty() ? std::cout : output_file;
+
+  // initialize eCAL API, every case matches new subscribers, so use the fast discovery
+  eCAL::Initialize({ "--ecal-set-config-key", "common/registration_fast_discovery:true" }, "pubsub_benchmark");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  out << "{\n";
+  out << "  \"benchmark\": \"pubsub_benchmark\",\n";
+  out << "  \"ecal_version\": \"" << eCAL::GetVersionString() << "\",\n";
+  out << "  \"host\": \"" << eCAL::Process::GetHostName() << "\",\n";
+  out << "  \"cases\": [";
+
+  bool first(true);
+  for (const auto& layer : layers)
+  {
+    for (auto size : sizes)
+    {
+      for (auto fanout : fanouts)
+      {
+        const size_t case_messages = std::max<size_t>(10, std::min(messages, max_bytes / std::max<size_t>(size, 1)));
+
+        std::cerr << "running " << layer.name << ", " << size << " bytes, " << fanout << " subscriber(s) .." << std::endl;
+        const SResult result = run_case(layer, size, fanout, case_messages, warmups, std::chrono::milliseconds(timeout_ms));
+
+        write_json(out, layer, size, fanout, result, first);
+        out.flush();
+        first = false;
+      }
+    }
+  }
+
+  out << "\n  ]\n}\n";
+
+  // finalize eCAL API
+  eCAL::Finalize();
+
+  return(0);
+}
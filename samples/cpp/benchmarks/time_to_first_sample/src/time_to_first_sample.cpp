@@ -0,0 +1,105 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+#include <ecal/ecal.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+const auto g_rounds    (20);
+const auto g_timeout_ms(5000);
+
+// measure the time from creating a publisher until a matching subscriber receives the first sample
+long long time_to_first_sample(const std::string& topic_name_)
+{
+  // create subscriber
+  eCAL::CSubscriber sub(topic_name_);
+  std::atomic<bool> received(false);
+  auto on_receive = [&](const struct eCAL::SReceiveCallbackData* /*data_*/) {
+    received = true;
+  };
+  sub.AddReceiveCallback(std::bind(on_receive, std::placeholders::_2));
+
+  // start time
+  auto start = std::chrono::steady_clock::now();
+
+  // create publisher
+  eCAL::CPublisher pub(topic_name_);
+
+  // send until the first sample arrives
+  const std::string payload("first sample");
+  while (!received)
+  {
+    if (std::chrono::steady_clock::now() - start > std::chrono::milliseconds(g_timeout_ms)) return(-1);
+    pub.Send(payload);
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  // end time
+  auto finish = std::chrono::steady_clock::now();
+  return(std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count());
+}
+
+// main entry
+int main(int argc, char **argv)
+{
+  // initialize eCAL API
+  // (pass --ecal-set-config-key common/registration_fast_discovery:true to measure the fast discovery mode)
+  eCAL::Initialize(argc, argv, "time_to_first_sample");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  std::cout << "Fast discovery : " << (eCAL::Config::IsRegistrationFastDiscoveryEnabled() ? "on" : "off") << std::endl;
+
+  std::vector<long long> times;
+  for (auto i = 0; i < g_rounds; ++i)
+  {
+    // use a new topic in every round, so no registration is known in advance
+    const long long time_us = time_to_first_sample("time_to_first_sample_" + std::to_string(i));
+    if (time_us < 0)
+    {
+      std::cout << "Round " << i << " : no sample received within " << g_timeout_ms << " ms" << std::endl;
+      continue;
+    }
+    std::cout << "Round " << i << " : " << time_us / 1000.0 << " ms" << std::endl;
+    times.push_back(time_us);
+  }
+
+  if (!times.empty())
+  {
+    std::sort(times.begin(), times.end());
+    long long sum(0);
+    for (auto time_us : times) sum += time_us;
+    std::cout << std::endl;
+    std::cout << "Min            : " << times.front() / 1000.0                              << " ms" << std::endl;
+    std::cout << "Median         : " << times[times.size() / 2] / 1000.0                    << " ms" << std::endl;
+    std::cout << "Avg            : " << sum / static_cast<double>(times.size()) / 1000.0     << " ms" << std::endl;
+    std::cout << "Max            : " << times.back() / 1000.0                               << " ms" << std::endl;
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+
+  return(0);
+}
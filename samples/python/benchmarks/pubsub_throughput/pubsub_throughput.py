@@ -0,0 +1,148 @@
+# ========================= eCAL LICENSE =================================
+#
+# Copyright (C) 2016 - 2019 Continental Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+# 
+#      http://www.apache.org/licenses/LICENSE-2.0
+# 
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# ========================= eCAL LICENSE =================================
+
+
+import sys
+import argparse
+import threading
+import time
+
+# import ecal core
+import ecal.core.core as ecal_core
+
+# transport layer and send mode values of eCAL::TLayer
+TLAYER_SHM  = 4
+TLAYER_ALL  = 255
+SMODE_OFF   = 0
+SMODE_ON    = 1
+
+def parse_args(args):
+  """ Parse the arguments.
+  """
+  parser = argparse.ArgumentParser(description='Simple script to measure eCAL shared memory throughput in Python (compare with the C++ pubsub_throughput sample)')
+
+  parser.add_argument('--runs',
+    dest='runs',
+    help='number of messages to send',
+    default=1000,
+    type=int)
+
+  parser.add_argument('--size',
+    dest='size',
+    help='size of the raw buffer to be sent',
+    default=8 * 1024 * 1024,
+    type=int)
+
+  return parser.parse_args(args)
+
+def throughput_test(snd_size, snd_loops, payload_type, zero_copy):
+
+  # create payload, bytearrays and numpy arrays are sent without converting them into bytes
+  if payload_type == 'numpy':
+    import numpy
+    payload = numpy.full(snd_size, ord('7'), dtype=numpy.uint8)
+  elif payload_type == 'bytearray':
+    payload = bytearray(b'7' * snd_size)
+  else:
+    payload = b'7' * snd_size
+
+  # create publisher
+  pub = ecal_core.publisher('throughput')
+  # set transport layer
+  pub.set_layer_mode(TLAYER_ALL, SMODE_OFF)
+  pub.set_layer_mode(TLAYER_SHM, SMODE_ON)
+
+  # create subscriber
+  sub = ecal_core.subscriber('throughput')
+  # add callback, a zero copy callback gets a memoryview of the shared memory file
+  received = { 'bytes' : 0 }
+  lock = threading.Lock()
+  def on_receive(topic_name, msg, snd_time):
+    with lock:
+      received['bytes'] += len(msg)
+  sub.set_callback(on_receive, zero_copy=zero_copy)
+
+  # let's match them
+  time.sleep(2)
+
+  # initial call to allocate memory file
+  pub.send_sync(payload, -1, 100)
+
+  # reset received bytes counter
+  with lock:
+    received['bytes'] = 0
+
+  # start time
+  start = time.perf_counter()
+
+  # do some work, wait for the subscriber like the C++ sample does with its acknowledge timeout
+  for _ in range(snd_loops):
+    pub.send_sync(payload, -1, 100)
+
+  # end time
+  elapsed = time.perf_counter() - start
+  print("Elapsed time : {:.6f} s".format(elapsed))
+
+  sub.rem_callback(on_receive)
+
+  sum_snd_bytes = snd_size * snd_loops
+  with lock:
+    sum_rcv_bytes = received['bytes']
+  print("Sent         : {:d} MB".format(sum_snd_bytes // (1024 * 1024)))
+  print("Received     : {:d} MB".format(sum_rcv_bytes // (1024 * 1024)))
+  print("Lost         : {:d} bytes ({:d} MB, {:.2f} %)".format(sum_snd_bytes - sum_rcv_bytes, (sum_snd_bytes - sum_rcv_bytes) // (1024 * 1024), (sum_snd_bytes - sum_rcv_bytes) * 100.0 / sum_snd_bytes))
+  print("Throughput   : {:d} MB/s".format(int((sum_snd_bytes / (1024.0 * 1024.0)) / elapsed)))
+  print("Throughput   : {:d} GB/s".format(int((sum_snd_bytes / (1024.0 * 1024.0 * 1024.0)) / elapsed)))
+
+  pub.destroy()
+  sub.destroy()
+
+def do_run(msg_num, msg_size):
+
+  # publish / subscribe match in the same process
+  ecal_core.enable_loopback(True)
+
+  tests = [('SHM (bytes, bytearray callback)'           , 'bytes'    , False),
+           ('SHM (bytes, memoryview callback)'          , 'bytes'    , True),
+           ('SHM (bytearray, memoryview callback)'      , 'bytearray', True)]
+  try:
+    import numpy
+    tests.append(('SHM (numpy array, memoryview callback)', 'numpy', True))
+  except ImportError:
+    pass
+
+  for name, payload_type, zero_copy in tests:
+    print("---------------------------")
+    print("LAYER: {}".format(name))
+    print("---------------------------")
+    throughput_test(msg_size, msg_num, payload_type, zero_copy)
+    print("")
+    print("")
+
+  sys.stdout.flush()
+
+if __name__ == "__main__":
+
+  # initialize eCAL API
+  ecal_core.initialize([], "py_pubsub_throughput")
+
+  args = parse_args(sys.argv[1:])
+  do_run(msg_num=args.runs, msg_size=args.size)
+
+  # finalize eCAL API
+  ecal_core.finalize()
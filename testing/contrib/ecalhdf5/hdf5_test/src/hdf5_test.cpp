@@ -388,6 +388,233 @@ TEST(HDF5, Performance_4096kb)
 }
 #endif // TEST_SIZE_4
 
+TEST(HDF5, ChannelCompression)
+{
+  // Highly compressible data, large enough to be compressed
+  std::string compressible_data;
+  for (int i = 0; compressible_data.size() < 256 * 1024; i++)
+    compressible_data += "Lidar point " + std::to_string(i % 100) + ";";
+
+  const std::string compressed_name   = "compressed_topic";
+  const std::string uncompressed_name = "uncompressed_topic";
+  const std::string small_name        = "small_topic";
+  const std::string small_data        = "CAN";
+
+  std::string base_name     = "compression_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  // Write HDF5 files (one per channel, so we can compare the file sizes)
+  {
+    eCAL::eh5::HDF5Meas hdf5_writer;
+
+    if (hdf5_writer.Open(meas_root_dir, eCAL::eh5::eAccessType::CREATE))
+    {
+      hdf5_writer.SetFileBaseName(base_name);
+      hdf5_writer.SetMaxSizePerFile(max_size_per_file);
+      hdf5_writer.SetOneFilePerChannelEnabled(true);
+    }
+    else
+    {
+      FAIL() << "Failed to open HDF5 Writer";
+    }
+
+    hdf5_writer.SetChannelCompression(compressed_name, eCAL::eh5::Compression(eCAL::eh5::CompressionCodec::Deflate, 6));
+    hdf5_writer.SetChannelCompression(small_name,      eCAL::eh5::Compression(eCAL::eh5::CompressionCodec::Deflate, 6));
+
+    EXPECT_TRUE(hdf5_writer.AddEntryToFile(compressible_data.data(), compressible_data.size(), 1001LL, 2001LL, compressed_name,   1LL, 11LL));
+    EXPECT_TRUE(hdf5_writer.AddEntryToFile(compressible_data.data(), compressible_data.size(), 1002LL, 2002LL, uncompressed_name, 2LL, 12LL));
+    EXPECT_TRUE(hdf5_writer.AddEntryToFile(small_data.data(),        small_data.size(),        1003LL, 2003LL, small_name,        3LL, 13LL));
+
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  // The compressed file must be smaller than the uncompressed one
+  {
+    std::ifstream compressed_file  (meas_root_dir + "/" + base_name + "_" + compressed_name   + ".hdf5", std::ios::binary | std::ios::ate);
+    std::ifstream uncompressed_file(meas_root_dir + "/" + base_name + "_" + uncompressed_name + ".hdf5", std::ios::binary | std::ios::ate);
+
+    ASSERT_TRUE(compressed_file.is_open());
+    ASSERT_TRUE(uncompressed_file.is_open());
+
+    EXPECT_LT(compressed_file.tellg() * 4, uncompressed_file.tellg());
+  }
+
+  // Read entries with HDF5 dir API, the data is decompressed transparently
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+    for (const auto& channel : { std::make_pair(compressed_name, compressible_data), std::make_pair(uncompressed_name, compressible_data), std::make_pair(small_name, small_data) })
+    {
+      eCAL::eh5::EntryInfoSet entries_info_set;
+      EXPECT_TRUE(hdf5_reader.GetEntriesInfo(channel.first, entries_info_set));
+      ASSERT_EQ(entries_info_set.size(), 1);
+
+      size_t data_size = 0;
+      EXPECT_TRUE(hdf5_reader.GetEntryDataSize(entries_info_set.begin()->ID, data_size));
+      EXPECT_EQ(data_size, channel.second.size());
+
+      std::string data_read(data_size, ' ');
+      EXPECT_TRUE(hdf5_reader.GetEntryData(entries_info_set.begin()->ID, const_cast<char*>(data_read.data())));
+      EXPECT_EQ(data_read, channel.second);
+    }
+  }
+}
+
+TEST(HDF5, IndexFile)
+{
+  const std::string t1_name = "topic_1";
+  const std::string t2_name = "topic/,2";
+  const std::string t1_data = "Lorem ipsum";
+  const std::string t2_data = "dolor sit amet";
+
+  std::string base_name     = "index_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+  std::string index_path    = meas_root_dir + "/" + base_name + ".eh5index";
+
+  // Write HDF5 file, closing the writer also writes the index file
+  {
+    eCAL::eh5::HDF5Meas hdf5_writer;
+
+    if (hdf5_writer.Open(meas_root_dir, eCAL::eh5::eAccessType::CREATE))
+    {
+      hdf5_writer.SetFileBaseName(base_name);
+      hdf5_writer.SetMaxSizePerFile(max_size_per_file);
+    }
+    else
+    {
+      FAIL() << "Failed to open HDF5 Writer";
+    }
+
+    hdf5_writer.SetChannelType(t1_name, "type_1");
+    hdf5_writer.SetChannelDescription(t2_name, "description_2");
+
+    EXPECT_TRUE(hdf5_writer.AddEntryToFile(t1_data.data(), t1_data.size(), 1001LL, 2003LL, t1_name, 1LL, 11LL));
+    EXPECT_TRUE(hdf5_writer.AddEntryToFile(t1_data.data(), t1_data.size(), 1002LL, 2001LL, t1_name, 2LL, 12LL));
+    EXPECT_TRUE(hdf5_writer.AddEntryToFile(t2_data.data(), t2_data.size(), 1003LL, 2002LL, t2_name, 3LL, 13LL));
+
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  EXPECT_TRUE(std::ifstream(index_path).good());
+
+  auto check_measurement = [&]()
+  {
+    eCAL::eh5::HDF5Meas hdf5_reader;
+    ASSERT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+    EXPECT_EQ(hdf5_reader.GetChannelNames(), std::set<std::string>({ t1_name, t2_name }));
+    EXPECT_EQ(hdf5_reader.GetChannelType(t1_name), "type_1");
+    EXPECT_EQ(hdf5_reader.GetChannelDescription(t2_name), "description_2");
+
+    EXPECT_EQ(hdf5_reader.GetMinTimestamp(t1_name), 2001LL);
+    EXPECT_EQ(hdf5_reader.GetMaxTimestamp(t1_name), 2003LL);
+    EXPECT_EQ(hdf5_reader.GetMinTimestamp(t2_name), 2002LL);
+    EXPECT_EQ(hdf5_reader.GetMaxTimestamp(t2_name), 2002LL);
+
+    for (const auto& channel : { std::make_tuple(t1_name, t1_data, 2u), std::make_tuple(t2_name, t2_data, 1u) })
+    {
+      eCAL::eh5::EntryInfoSet entries_info_set;
+      EXPECT_TRUE(hdf5_reader.GetEntriesInfo(std::get<0>(channel), entries_info_set));
+      ASSERT_EQ(entries_info_set.size(), std::get<2>(channel));
+
+      for (const auto& entry : entries_info_set)
+      {
+        size_t data_size = 0;
+        EXPECT_TRUE(hdf5_reader.GetEntryDataSize(entry.ID, data_size));
+        EXPECT_EQ(data_size, std::get<1>(channel).size());
+
+        std::string data_read(data_size, ' ');
+        EXPECT_TRUE(hdf5_reader.GetEntryData(entry.ID, const_cast<char*>(data_read.data())));
+        EXPECT_EQ(data_read, std::get<1>(channel));
+      }
+    }
+  };
+
+  // Read with a valid index file
+  check_measurement();
+
+  // A broken index file must be ignored and all files are opened instead
+  {
+    std::ofstream index_file(index_path, std::ios::binary | std::ios::trunc);
+    index_file << "garbage";
+  }
+  check_measurement();
+}
+
+TEST(HDF5, GetEntriesInfoRange)
+{
+  const std::string channel_name = "range_topic";
+  const std::string empty_name   = "empty_topic";
+  const std::string data         = "Lorem ipsum";
+
+  std::string base_name     = "range_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  // Write HDF5 file with entries received at 1000 ... 5000 and a channel without entries
+  {
+    eCAL::eh5::HDF5Meas hdf5_writer;
+
+    if (hdf5_writer.Open(meas_root_dir, eCAL::eh5::eAccessType::CREATE))
+    {
+      hdf5_writer.SetFileBaseName(base_name);
+      hdf5_writer.SetMaxSizePerFile(max_size_per_file);
+    }
+    else
+    {
+      FAIL() << "Failed to open HDF5 Writer";
+    }
+
+    hdf5_writer.SetChannelType(empty_name, "type_empty");
+
+    for (long long i = 1; i <= 5; i++)
+      EXPECT_TRUE(hdf5_writer.AddEntryToFile(data.data(), data.size(), i * 100LL, i * 1000LL, channel_name, i, i));
+
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  eCAL::eh5::HDF5Meas hdf5_reader;
+  ASSERT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+  auto get_range = [&hdf5_reader, &channel_name](long long begin, long long end)
+  {
+    std::vector<long long> rcv_timestamps;
+    eCAL::eh5::EntryInfoSet entries_info_set;
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfoRange(channel_name, begin, end, entries_info_set));
+    for (const auto& entry : entries_info_set)
+      rcv_timestamps.push_back(entry.RcvTimestamp);
+    return rcv_timestamps;
+  };
+
+  // Closed range
+  EXPECT_EQ(get_range(2000LL, 4000LL), std::vector<long long>({ 2000LL, 3000LL, 4000LL }));
+  EXPECT_EQ(get_range(1500LL, 3500LL), std::vector<long long>({ 2000LL, 3000LL }));
+
+  // begin == 0 starts with the first entry, end == 0 stops with the last entry
+  EXPECT_EQ(get_range(0LL, 2000LL),    std::vector<long long>({ 1000LL, 2000LL }));
+  EXPECT_EQ(get_range(4000LL, 0LL),    std::vector<long long>({ 4000LL, 5000LL }));
+  EXPECT_EQ(get_range(0LL, 0LL),       std::vector<long long>({ 1000LL, 2000LL, 3000LL, 4000LL, 5000LL }));
+
+  // Range outside of the recorded entries
+  EXPECT_TRUE(get_range(6000LL, 0LL).empty());
+  EXPECT_TRUE(get_range(0LL, 500LL).empty());
+
+  // Channels without entries give an empty set, previously filled sets are cleared
+  for (const auto& name : { empty_name, std::string("unknown_topic") })
+  {
+    eCAL::eh5::EntryInfoSet entries_info_set;
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfoRange(channel_name, 0LL, 0LL, entries_info_set));
+    EXPECT_FALSE(entries_info_set.empty());
+
+    hdf5_reader.GetEntriesInfoRange(name, 0LL, 0LL, entries_info_set);
+    EXPECT_TRUE(entries_info_set.empty());
+
+    hdf5_reader.GetEntriesInfoRange(name, 1000LL, 0LL, entries_info_set);
+    EXPECT_TRUE(entries_info_set.empty());
+  }
+}
+
 TEST(HDF5, IsOneFilePerChannelEnabled)
 {
   eCAL::eh5::HDF5Meas hdf5_writer;
@@ -0,0 +1,137 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/protobuf/ecal_proto_descriptor_cache.h>
+#include <ecal/protobuf/ecal_proto_hlp.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "person.pb.h"
+#include "signals.pb.h"
+
+using namespace eCAL::protobuf;
+
+namespace
+{
+  pb::People::Person CreatePerson()
+  {
+    pb::People::Person person;
+    person.set_id(42);
+    person.set_name("Max");
+    person.set_email("max@mail.net");
+    person.mutable_dog()->set_name("Brandy");
+    person.mutable_house()->set_rooms(4);
+    return(person);
+  }
+}
+
+TEST(DescriptorCache, SharedPrototype)
+{
+  const std::string descriptor = GetProtoMessageDescription(pb::People::Person());
+
+  std::string error;
+  auto prototype = GetCachedPrototype(descriptor, "pb.People.Person", error);
+  ASSERT_NE(prototype, nullptr) << error;
+  EXPECT_EQ(prototype->GetDescriptor()->full_name(), "pb.People.Person");
+
+  // the same descriptor is built only once
+  auto prototype_again = GetCachedPrototype(descriptor, "pb.People.Person", error);
+  EXPECT_EQ(prototype_again.get(), prototype.get());
+
+  // type names without package are found as well
+  auto prototype_short = GetCachedPrototype(descriptor, "Person", error);
+  EXPECT_EQ(prototype_short.get(), prototype.get());
+
+  // types of the same descriptor share the pool
+  auto dog_prototype = GetCachedPrototype(descriptor, "pb.Animal.Dog", error);
+  ASSERT_NE(dog_prototype, nullptr) << error;
+  EXPECT_EQ(dog_prototype->GetDescriptor()->file()->pool(), prototype->GetDescriptor()->file()->pool());
+
+  // other descriptors get their own pool
+  auto frame_prototype = GetCachedPrototype(GetProtoMessageDescription(pb::Signals::Frame()), "pb.Signals.Frame", error);
+  ASSERT_NE(frame_prototype, nullptr) << error;
+  EXPECT_NE(frame_prototype->GetDescriptor()->file()->pool(), prototype->GetDescriptor()->file()->pool());
+}
+
+TEST(DescriptorCache, DynamicMessage)
+{
+  const pb::People::Person person = CreatePerson();
+
+  std::string error;
+  auto prototype = GetCachedPrototype(GetProtoMessageDescription(person), "pb.People.Person", error);
+  ASSERT_NE(prototype, nullptr) << error;
+
+  std::unique_ptr<google::protobuf::Message> message(prototype->New());
+  ASSERT_TRUE(message->ParseFromString(person.SerializeAsString()));
+  EXPECT_EQ(message->DebugString(), person.DebugString());
+}
+
+TEST(DescriptorCache, Release)
+{
+  const std::string descriptor = GetProtoMessageDescription(pb::People::Person());
+
+  std::string error;
+  auto prototype = GetCachedPrototype(descriptor, "pb.People.Person", error);
+  ASSERT_NE(prototype, nullptr) << error;
+
+  // the pool is released with its last prototype
+  std::weak_ptr<const google::protobuf::Message> weak_prototype(prototype);
+  prototype = nullptr;
+  EXPECT_TRUE(weak_prototype.expired());
+
+  prototype = GetCachedPrototype(descriptor, "pb.People.Person", error);
+  EXPECT_NE(prototype, nullptr) << error;
+}
+
+TEST(DescriptorCache, InvalidType)
+{
+  std::string error;
+  EXPECT_EQ(GetCachedPrototype(GetProtoMessageDescription(pb::People::Person()), "pb.People.Unknown", error), nullptr);
+  EXPECT_FALSE(error.empty());
+
+  error.clear();
+  EXPECT_EQ(GetCachedPrototype("\xff\xff", "pb.People.Person", error), nullptr);
+  EXPECT_FALSE(error.empty());
+}
+
+TEST(DescriptorCache, Concurrent)
+{
+  const std::string descriptor = GetProtoMessageDescription(pb::Signals::Frame());
+
+  const size_t thread_count(8);
+  std::vector<std::shared_ptr<const google::protobuf::Message>> prototypes(thread_count);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    threads.emplace_back([&descriptor, &prototypes, i]()
+    {
+      std::string error;
+      prototypes[i] = GetCachedPrototype(descriptor, "pb.Signals.Frame", error);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  ASSERT_NE(prototypes[0], nullptr);
+  for (const auto& prototype : prototypes) EXPECT_EQ(prototype.get(), prototypes[0].get());
+}
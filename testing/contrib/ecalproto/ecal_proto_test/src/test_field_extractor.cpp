@@ -0,0 +1,187 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/protobuf/ecal_proto_field_extractor.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "signals.pb.h"
+
+using namespace eCAL::protobuf;
+
+namespace
+{
+  pb::Signals::Frame CreateFrame()
+  {
+    pb::Signals::Frame frame;
+    frame.set_time(12.5);
+    frame.set_velocity(-3.25f);
+    frame.set_offset(-42);
+    frame.set_delta(-1234567);
+    frame.set_counter(4000000000u);
+    frame.set_checksum(0xDEADBEEF);
+    frame.set_position(-9876543210LL);
+    frame.set_valid(true);
+    frame.set_state(pb::Signals::Frame_State_STOPPED);
+    frame.set_comment("a comment that is skipped");
+    frame.set_payload(std::string(1024, 'x'));
+    for (int i = 0; i < 4; ++i) frame.add_samples(0.5 * i);
+    for (int i = 0; i < 3; ++i) frame.add_codes(-i);
+    frame.mutable_origin()->set_x(1.0);
+    frame.mutable_origin()->set_y(2.0);
+    for (int o = 0; o < 3; ++o)
+    {
+      auto* object = frame.add_objects();
+      object->set_id(10 + o);
+      object->set_label("object");
+      for (int p = 0; p < 2; ++p)
+      {
+        auto* point = object->add_points();
+        point->set_x(o * 100 + p);
+        point->set_y(-(o * 100 + p));
+      }
+    }
+    return frame;
+  }
+}
+
+TEST(ProtoFieldExtractor, ScalarFields)
+{
+  const std::vector<std::string> paths
+  {
+    "time", "velocity", "offset", "delta", "counter", "checksum", "position", "valid", "state", "origin.y"
+  };
+
+  CProtoFieldExtractor extractor;
+  std::string error;
+  ASSERT_TRUE(extractor.Compile(pb::Signals::Frame::descriptor(), paths, error)) << error;
+  ASSERT_EQ(paths.size(), extractor.GetFieldCount());
+
+  const std::string buffer = CreateFrame().SerializeAsString();
+  std::vector<double> values;
+  ASSERT_TRUE(extractor.Extract(buffer.data(), buffer.size(), values));
+
+  const std::vector<double> expected{ 12.5, -3.25, -42, -1234567, 4000000000.0, 0xDEADBEEF, -9876543210.0, 1, 2, 2.0 };
+  EXPECT_EQ(expected, values);
+}
+
+TEST(ProtoFieldExtractor, RepeatedFields)
+{
+  const std::vector<std::string> paths
+  {
+    "samples[0]", "samples[3]", "codes[2]", "objects[1].id", "objects[2].points[1].x", "objects[0].points[0].y", "objects[2].points[1].y", "samples[4]", "objects[5].id"
+  };
+
+  CProtoFieldExtractor extractor;
+  std::string error;
+  ASSERT_TRUE(extractor.Compile(pb::Signals::Frame::descriptor(), paths, error)) << error;
+
+  const std::string buffer = CreateFrame().SerializeAsString();
+  std::vector<double> values;
+  ASSERT_TRUE(extractor.Extract(buffer.data(), buffer.size(), values));
+  ASSERT_EQ(paths.size(), values.size());
+
+  EXPECT_EQ(0.0,    values[0]);
+  EXPECT_EQ(1.5,    values[1]);
+  EXPECT_EQ(-2.0,   values[2]);
+  EXPECT_EQ(11.0,   values[3]);
+  EXPECT_EQ(201.0,  values[4]);
+  EXPECT_EQ(0.0,    values[5]);
+  EXPECT_EQ(-201.0, values[6]);
+
+  // elements that are not present
+  EXPECT_TRUE(std::isnan(values[7]));
+  EXPECT_TRUE(std::isnan(values[8]));
+}
+
+TEST(ProtoFieldExtractor, DefaultValues)
+{
+  CProtoFieldExtractor extractor;
+  std::string error;
+  ASSERT_TRUE(extractor.Compile(pb::Signals::Frame::descriptor(), { "time", "origin.x", "objects[0].id" }, error)) << error;
+
+  // fields that are not present have their default values
+  const std::string buffer = pb::Signals::Frame().SerializeAsString();
+  std::vector<double> values;
+  ASSERT_TRUE(extractor.Extract(buffer.data(), buffer.size(), values));
+  ASSERT_EQ(3u, values.size());
+  EXPECT_EQ(0.0, values[0]);
+  EXPECT_EQ(0.0, values[1]);
+  EXPECT_TRUE(std::isnan(values[2]));
+
+  // the fields of a present element have their default values
+  pb::Signals::Frame frame;
+  frame.add_objects();
+  const std::string element_buffer = frame.SerializeAsString();
+  ASSERT_TRUE(extractor.Extract(element_buffer.data(), element_buffer.size(), values));
+  EXPECT_EQ(0.0, values[2]);
+}
+
+TEST(ProtoFieldExtractor, InvalidPaths)
+{
+  const std::vector<std::string> invalid_paths
+  {
+    "",                 // empty path
+    "unknown",          // unknown field
+    "samples",          // repeated field without index
+    "time[0]",          // single field with index
+    "comment",          // string field
+    "origin",           // message field
+    "time.x",           // scalar field with child
+    "objects[a].id",    // invalid index
+    "origin..x",        // empty item
+  };
+
+  for (const auto& path : invalid_paths)
+  {
+    CProtoFieldExtractor extractor;
+    std::string error;
+    EXPECT_FALSE(extractor.Compile(pb::Signals::Frame::descriptor(), { "time", path }, error)) << path;
+    EXPECT_FALSE(error.empty()) << path;
+    EXPECT_EQ(0u, extractor.GetFieldCount()) << path;
+  }
+}
+
+TEST(ProtoFieldExtractor, MalformedMessage)
+{
+  CProtoFieldExtractor extractor;
+  std::string error;
+  ASSERT_TRUE(extractor.Compile(pb::Signals::Frame::descriptor(), { "objects[2].points[1].x" }, error)) << error;
+
+  // a truncated message is detected
+  const std::string buffer = CreateFrame().SerializeAsString();
+  std::vector<double> values;
+  EXPECT_FALSE(extractor.Extract(buffer.data(), buffer.size() - 3, values));
+}
+
+TEST(ProtoFieldExtractor, MessageBehindBuffer)
+{
+  CProtoFieldExtractor extractor;
+  std::string error;
+  ASSERT_TRUE(extractor.Compile(pb::Signals::Frame::descriptor(), { "origin.x" }, error)) << error;
+
+  // the origin field announces 100 bytes, the buffer ends right after the length
+  const std::string buffer("\x72\x64", 2);
+  std::vector<double> values;
+  EXPECT_FALSE(extractor.Extract(buffer.data(), buffer.size(), values));
+}
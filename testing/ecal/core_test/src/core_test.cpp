@@ -22,6 +22,8 @@
 #include <ecal/msg/string/subscriber.h>
 #include <algorithm>
 #include <atomic>
+#include <sstream>
+#include <string>
 #include <thread>
 #include <vector>
 #include <gtest/gtest.h>
@@ -167,6 +169,119 @@ TEST(Core, CallbackDestruction)
   EXPECT_EQ(0, eCAL::Finalize());
 }
 
+TEST(Core, AsyncLogging)
+{
+  // initialize eCAL API with asynchronous logging and a tiny queue
+  std::vector<std::string> args = { "async logging",
+                                    "--ecal-set-config-key", "monitoring/log_async:true",
+                                    "--ecal-set-config-key", "monitoring/log_async_queue_size:16",
+                                    "--ecal-set-config-key", "monitoring/filter_log_con:info" };
+  EXPECT_EQ(0, eCAL::Initialize(args, "async logging"));
+
+  // capture the console sink
+  testing::internal::CaptureStdout();
+
+  // log from several threads at once, much faster than the queues are flushed
+  const int thread_num(4);
+  const int msg_num(10000);
+  std::vector<std::thread> log_threads;
+  for (auto t = 0; t < thread_num; ++t)
+  {
+    log_threads.emplace_back([t]() {
+      for (auto i = 0; i < msg_num; ++i)
+      {
+        eCAL::Logging::Log(log_level_info, "thread " + std::to_string(t) + " message " + std::to_string(i));
+      }
+      });
+  }
+  for (auto& log_thread : log_threads) log_thread.join();
+
+  const unsigned long long dropped = eCAL::Logging::GetDroppedMessages();
+
+  // finalize eCAL API, remaining messages are flushed
+  EXPECT_EQ(0, eCAL::Finalize());
+
+  // count the messages that arrived at the console
+  const std::string console_output = testing::internal::GetCapturedStdout();
+  unsigned long long delivered(0);
+  std::istringstream console_stream(console_output);
+  std::string line;
+  while (std::getline(console_stream, line))
+  {
+    if (line.compare(0, 7, "thread ") == 0) delivered++;
+  }
+
+  // the tiny queues must have overflowed
+  EXPECT_GT(dropped, 0ULL);
+
+  // every message is either delivered or counted as dropped
+  EXPECT_EQ(static_cast<unsigned long long>(thread_num * msg_num), delivered + dropped);
+}
+
+TEST(Core, TimerStatistics)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "timer statistics"));
+
+  std::atomic<int> callback_count(0);
+  eCAL::CTimer timer;
+
+  // no statistics for a stopped timer
+  eCAL::STimerStatistics stats;
+  EXPECT_FALSE(timer.GetStatistics(stats));
+
+  EXPECT_TRUE(timer.Start(10, [&callback_count]() { callback_count++; }));
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+  EXPECT_TRUE(timer.GetStatistics(stats));
+  EXPECT_GT(stats.call_count, 0);
+  EXPECT_LE(stats.jitter_min_us, stats.jitter_mean_us);
+  EXPECT_LE(stats.jitter_mean_us, stats.jitter_max_us);
+
+  // the callback must not be called after the timer has been stopped
+  EXPECT_TRUE(timer.Stop());
+  const int stopped_count = callback_count;
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(stopped_count, callback_count.load());
+
+  // a call is counted before its callback runs, so only compare after
+  // stopping the timer, when every counted callback has returned
+  EXPECT_LE(stats.call_count, stopped_count);
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(Core, LazyInitialization)
+{
+  auto is_started = [](const std::string& name_)
+  {
+    for (const auto& startup_time : eCAL::GetStartupTimes())
+    {
+      if (startup_time.first == name_) return true;
+    }
+    return false;
+  };
+
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "lazy initialization"));
+
+  // the subscriber gate is not started before the first subscriber is created
+  EXPECT_TRUE(is_started("registration_provider"));
+  EXPECT_TRUE(is_started("initialize"));
+  EXPECT_FALSE(is_started("subgate"));
+  EXPECT_EQ(1, eCAL::IsInitialized(eCAL::Init::Subscriber));
+
+  {
+    eCAL::string::CSubscriber<std::string> sub("foo");
+    EXPECT_TRUE(is_started("subgate"));
+  }
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+  EXPECT_TRUE(eCAL::GetStartupTimes().empty());
+}
+
 /* excluded for now, system timer jitter too high */
 #if 0
 TEST(Core, TimerCallback)
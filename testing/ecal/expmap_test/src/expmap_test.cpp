@@ -168,4 +168,17 @@ TEST(ExpMap, ExpMapRemove)
   EXPECT_TRUE(expmap.erase("A"));
   EXPECT_EQ(0, expmap.size());
   EXPECT_FALSE(expmap.erase("B"));
-}
\ No newline at end of file
+}
+
+TEST(ExpMap, ExpMapIteratorAccess)
+{
+  eCAL::Util::CExpMap<std::string, int> expmap(std::chrono::milliseconds(200));
+  expmap["A"] = 1;
+
+  // the value is accessed in place and can be modified
+  auto it = expmap.begin();
+  EXPECT_EQ(std::string("A"), it.key());
+  it.value() = 2;
+
+  EXPECT_EQ(2, expmap["A"]);
+}
@@ -0,0 +1,113 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/ecal_memfile.h"
+#include "io/ecal_memfile_broadcast.h"
+#include "io/ecal_memfile_broadcast_reader.h"
+#include "io/ecal_memfile_broadcast_writer.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace eCAL
+{
+  int g_process_id(0);
+}
+
+namespace
+{
+  std::string ToString(const eCAL::SMemfileBroadcastMessage& message_)
+  {
+    return std::string(static_cast<const char*>(message_.data), message_.size);
+  }
+}
+
+TEST(IO, MemfileBroadcastSkipUnchanged)
+{
+  const std::string broadcast_name = "memfile_broadcast_test";
+
+  eCAL::CMemoryFileBroadcast writer_broadcast;
+  ASSERT_TRUE(writer_broadcast.Create(broadcast_name, 64));
+  ASSERT_TRUE(writer_broadcast.FlushGlobalEventQueue());
+  eCAL::CMemoryFileBroadcastWriter writer;
+  ASSERT_TRUE(writer.Bind(&writer_broadcast));
+
+  eCAL::CMemoryFileBroadcast reader_broadcast;
+  ASSERT_TRUE(reader_broadcast.Create(broadcast_name, 64));
+  eCAL::CMemoryFileBroadcastReader reader;
+  ASSERT_TRUE(reader.Bind(&reader_broadcast));
+
+  eCAL::MemfileBroadcastMessageListT message_list;
+
+  // nothing written, nothing to confirm
+  EXPECT_FALSE(writer.Refresh());
+
+  // first payload
+  const std::string payload_1 = "first payload";
+  ASSERT_TRUE(writer.Write(payload_1.data(), payload_1.size()));
+  ASSERT_TRUE(reader.Read(message_list, 0));
+  ASSERT_EQ(message_list.size(), size_t(1));
+  EXPECT_EQ(message_list[0].type, eCAL::eMemfileBroadcastEventType::EVENT_UPDATED);
+  EXPECT_EQ(ToString(message_list[0]), payload_1);
+  const auto event_id = message_list[0].event_id;
+
+  // no new events
+  ASSERT_TRUE(reader.Read(message_list, 0));
+  EXPECT_TRUE(message_list.empty());
+
+  // confirmed payload, the reader keeps its copy
+  ASSERT_TRUE(writer.Refresh());
+  ASSERT_TRUE(reader.Read(message_list, 0));
+  ASSERT_EQ(message_list.size(), size_t(1));
+  EXPECT_EQ(message_list[0].type, eCAL::eMemfileBroadcastEventType::EVENT_HEARTBEAT);
+  EXPECT_EQ(message_list[0].event_id, event_id);
+  EXPECT_EQ(ToString(message_list[0]), payload_1);
+
+  // a late joining reader reads the confirmed payload
+  eCAL::CMemoryFileBroadcast late_reader_broadcast;
+  ASSERT_TRUE(late_reader_broadcast.Create(broadcast_name, 64));
+  eCAL::CMemoryFileBroadcastReader late_reader;
+  ASSERT_TRUE(late_reader.Bind(&late_reader_broadcast));
+  ASSERT_TRUE(late_reader.Read(message_list, 0));
+  ASSERT_EQ(message_list.size(), size_t(1));
+  EXPECT_EQ(message_list[0].type, eCAL::eMemfileBroadcastEventType::EVENT_UPDATED);
+  EXPECT_EQ(ToString(message_list[0]), payload_1);
+
+  // changed payload
+  const std::string payload_2 = "second payload";
+  ASSERT_TRUE(writer.Write(payload_2.data(), payload_2.size()));
+  ASSERT_TRUE(reader.Read(message_list, 0));
+  ASSERT_EQ(message_list.size(), size_t(1));
+  EXPECT_EQ(message_list[0].type, eCAL::eMemfileBroadcastEventType::EVENT_UPDATED);
+  EXPECT_EQ(ToString(message_list[0]), payload_2);
+
+  // removed payload
+  writer.Unbind();
+  ASSERT_TRUE(reader.Read(message_list, 0));
+  ASSERT_EQ(message_list.size(), size_t(1));
+  EXPECT_EQ(message_list[0].type, eCAL::eMemfileBroadcastEventType::EVENT_REMOVED);
+  EXPECT_EQ(message_list[0].event_id, event_id);
+
+  late_reader.Unbind();
+  late_reader_broadcast.Destroy();
+  reader.Unbind();
+  reader_broadcast.Destroy();
+  writer_broadcast.Destroy();
+}
@@ -25,16 +25,37 @@
 #include <chrono>
 #include <memory>
 #include <iostream>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+namespace
+{
+  class CTestMemFileMap : public eCAL::CMemFileMap
+  {
+  public:
+    size_t RetiredCount(const std::string& name_)
+    {
+      const std::lock_guard<std::mutex> lock(m_memfile_map_mtx);
+      auto iter = m_retired_map.find(name_);
+      return((iter == m_retired_map.end()) ? 0 : iter->second.size());
+    }
+  };
+
+  CTestMemFileMap* test_memfile_map()
+  {
+    static std::shared_ptr<CTestMemFileMap> m(new CTestMemFileMap);
+    return(m.get());
+  }
+}
+
 namespace eCAL
 {
   CMemFileMap* g_memfile_map()
   {
-    static std::shared_ptr<CMemFileMap> m(new CMemFileMap);
-    return(m.get());
+    return(test_memfile_map());
   }
 }
 
@@ -297,3 +318,60 @@ TEST(IO, MemfileConcurrency)
   // destroy memory file
   EXPECT_EQ(true, mem_file.Destroy(true));
 }
+
+TEST(IO, MemfileGrow)
+{
+  eCAL::CMemoryFile mem_file_writer;
+  eCAL::CMemoryFile mem_file_reader;
+
+  // global parameter
+  const std::string memfile_name = "my_growing_memory_file";
+
+  // create memory file for writing and open it for reading
+  EXPECT_EQ(true, mem_file_writer.Create(memfile_name.c_str(), true, 1024));
+  EXPECT_EQ(true, mem_file_reader.Create(memfile_name.c_str(), false));
+
+  // write something small
+  const std::string small_s(512, 's');
+  EXPECT_EQ(true, mem_file_writer.GetWriteAccess(10));
+  EXPECT_EQ(small_s.size(), mem_file_writer.WriteBuffer(small_s.data(), small_s.size(), 0));
+  EXPECT_EQ(true, mem_file_writer.ReleaseWriteAccess());
+
+  std::vector<char> read_buf(1024 * 1024);
+  EXPECT_EQ(true, mem_file_reader.GetReadAccess(10));
+  EXPECT_EQ(small_s.size(), mem_file_reader.Read(read_buf.data(), small_s.size(), 0));
+  EXPECT_EQ(true, mem_file_reader.ReleaseReadAccess());
+
+  // grow the file, this is not supported on all platforms
+  EXPECT_EQ(true, mem_file_writer.GetWriteAccess(10));
+  const bool grown = mem_file_writer.Grow(read_buf.size());
+  EXPECT_EQ(true, mem_file_writer.ReleaseWriteAccess());
+#ifdef ECAL_OS_LINUX
+  EXPECT_EQ(true, grown);
+#endif
+  if (grown)
+  {
+    // the reader still uses the old mapping
+    EXPECT_EQ(1U, test_memfile_map()->RetiredCount(memfile_name));
+
+    // write something large
+    const std::string large_s(read_buf.size(), 'l');
+    EXPECT_EQ(true, mem_file_writer.GetWriteAccess(10));
+    EXPECT_EQ(large_s.size(), mem_file_writer.WriteBuffer(large_s.data(), large_s.size(), 0));
+    EXPECT_EQ(true, mem_file_writer.ReleaseWriteAccess());
+
+    // the reader picks up the new size with the same name
+    EXPECT_EQ(true, mem_file_reader.GetReadAccess(10));
+    EXPECT_EQ(large_s.size(), mem_file_reader.MaxDataSize());
+    EXPECT_EQ(large_s.size(), mem_file_reader.Read(read_buf.data(), large_s.size(), 0));
+    EXPECT_EQ(true, mem_file_reader.ReleaseReadAccess());
+    EXPECT_EQ(large_s, std::string(read_buf.data(), read_buf.size()));
+
+    // no object uses the old mapping anymore, so it has been released
+    EXPECT_EQ(0U, test_memfile_map()->RetiredCount(memfile_name));
+  }
+
+  // destroy memory files
+  EXPECT_EQ(true, mem_file_reader.Destroy(false));
+  EXPECT_EQ(true, mem_file_writer.Destroy(true));
+}
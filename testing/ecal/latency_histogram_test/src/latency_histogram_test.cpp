@@ -0,0 +1,114 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "readwrite/ecal_latency_histogram.h"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(LatencyHistogram, Empty)
+{
+  eCAL::CLatencyHistogram histogram;
+
+  eCAL::Monitoring::SLatencyStatistics stats;
+  histogram.GetStatistics(stats, true);
+
+  EXPECT_EQ(0, stats.count);
+  EXPECT_EQ(0, stats.min);
+  EXPECT_EQ(0, stats.max);
+  EXPECT_EQ(0, stats.p99);
+  EXPECT_TRUE(stats.histogram.empty());
+}
+
+TEST(LatencyHistogram, Percentiles)
+{
+  eCAL::CLatencyHistogram histogram;
+
+  // record 1 .. 1000 us
+  for (long long value = 1; value <= 1000; ++value) histogram.Record(value);
+
+  eCAL::Monitoring::SLatencyStatistics stats;
+  histogram.GetStatistics(stats, false);
+
+  EXPECT_EQ(1000,  stats.count);
+  EXPECT_EQ(1,     stats.min);
+  EXPECT_EQ(1000,  stats.max);
+  EXPECT_DOUBLE_EQ(500.5, stats.mean);
+
+  // percentiles are precise up to 12.5 %
+  EXPECT_GE(stats.p50, 500);  EXPECT_LE(stats.p50, 500  * 1.125);
+  EXPECT_GE(stats.p90, 900);  EXPECT_LE(stats.p90, 900  * 1.125);
+  EXPECT_GE(stats.p99, 990);  EXPECT_LE(stats.p99, 1000);
+  EXPECT_EQ(1000, stats.p999);
+
+  // all values are in the histogram
+  long long histogram_count(0);
+  for (const auto& bucket : stats.histogram) histogram_count += bucket.second;
+  EXPECT_EQ(1000, histogram_count);
+
+  // nothing was reset
+  histogram.GetStatistics(stats, true);
+  EXPECT_EQ(1000, stats.count);
+
+  // but now it is
+  histogram.GetStatistics(stats, true);
+  EXPECT_EQ(0, stats.count);
+}
+
+TEST(LatencyHistogram, OutOfRange)
+{
+  eCAL::CLatencyHistogram histogram;
+
+  // negative values (clock differences) count as 0, huge ones go into the last bucket
+  histogram.Record(-10);
+  histogram.Record(1LL << 50);
+
+  eCAL::Monitoring::SLatencyStatistics stats;
+  histogram.GetStatistics(stats, true);
+
+  EXPECT_EQ(2,          stats.count);
+  EXPECT_EQ(0,          stats.min);
+  EXPECT_EQ(1LL << 50,  stats.max);
+  EXPECT_EQ(1LL << 50,  stats.p999);
+}
+
+TEST(LatencyHistogram, Concurrent)
+{
+  eCAL::CLatencyHistogram histogram;
+
+  const int thread_num(4);
+  const int value_num(100000);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thread_num; ++t)
+  {
+    threads.emplace_back([&histogram, value_num]() {
+      for (int i = 0; i < value_num; ++i) histogram.Record(i % 1000);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  eCAL::Monitoring::SLatencyStatistics stats;
+  histogram.GetStatistics(stats, true);
+
+  EXPECT_EQ(thread_num * value_num, stats.count);
+  EXPECT_EQ(0,   stats.min);
+  EXPECT_EQ(999, stats.max);
+}
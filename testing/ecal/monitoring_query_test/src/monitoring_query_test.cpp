@@ -0,0 +1,152 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "mon/ecal_monitoring_query.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  eCAL::Monitoring::STopicMon CreateTopic(const std::string& hname_, int pid_, const std::string& tname_)
+  {
+    eCAL::Monitoring::STopicMon topic;
+    topic.hname            = hname_;
+    topic.pid              = pid_;
+    topic.pname            = "/usr/bin/sender";
+    topic.uname            = "sender";
+    topic.tname            = tname_;
+    topic.tinfo.encoding   = "proto";
+    topic.tinfo.type       = "pb.People.Person";
+    topic.tinfo.descriptor = std::string(1024, 'd');
+    topic.attr["key"]      = "value";
+    topic.latency.count    = 42;
+    topic.latency.histogram[10] = 42;
+    return topic;
+  }
+}
+
+TEST(MonitoringQuery, EmptyQueryMatchesAll)
+{
+  const eCAL::Monitoring::SMonitoringQuery query;
+
+  EXPECT_TRUE(eCAL::Monitoring::MatchQuery(CreateTopic("host1", 1, "person"), query));
+  EXPECT_TRUE(eCAL::Monitoring::MatchQuery(eCAL::Monitoring::SProcessMon(), query));
+  EXPECT_TRUE(eCAL::Monitoring::MatchQuery(eCAL::Monitoring::SServerMon(), query));
+  EXPECT_TRUE(eCAL::Monitoring::MatchQuery(eCAL::Monitoring::SClientMon(), query));
+}
+
+TEST(MonitoringQuery, Filters)
+{
+  const eCAL::Monitoring::STopicMon topic = CreateTopic("host1", 1, "person");
+
+  eCAL::Monitoring::SMonitoringQuery query;
+  query.host_name = "host1";
+  EXPECT_TRUE(eCAL::Monitoring::MatchQuery(topic, query));
+  query.host_name = "host2";
+  EXPECT_FALSE(eCAL::Monitoring::MatchQuery(topic, query));
+
+  query = eCAL::Monitoring::SMonitoringQuery();
+  query.process_id = 1;
+  EXPECT_TRUE(eCAL::Monitoring::MatchQuery(topic, query));
+  query.process_id = 2;
+  EXPECT_FALSE(eCAL::Monitoring::MatchQuery(topic, query));
+
+  query = eCAL::Monitoring::SMonitoringQuery();
+  query.unit_name = "sender";
+  EXPECT_TRUE(eCAL::Monitoring::MatchQuery(topic, query));
+  query.process_name = "/usr/bin/receiver";
+  EXPECT_FALSE(eCAL::Monitoring::MatchQuery(topic, query));
+
+  query = eCAL::Monitoring::SMonitoringQuery();
+  query.topic_name = "person";
+  EXPECT_TRUE(eCAL::Monitoring::MatchQuery(topic, query));
+  query.topic_name = "animal";
+  EXPECT_FALSE(eCAL::Monitoring::MatchQuery(topic, query));
+
+  // the topic name filter does not apply to processes
+  EXPECT_TRUE(eCAL::Monitoring::MatchQuery(eCAL::Monitoring::SProcessMon(), query));
+
+  // but to the service name of servers and clients
+  eCAL::Monitoring::SServerMon server;
+  server.sname = "animal";
+  EXPECT_TRUE(eCAL::Monitoring::MatchQuery(server, query));
+  eCAL::Monitoring::SClientMon client;
+  client.sname = "person";
+  EXPECT_FALSE(eCAL::Monitoring::MatchQuery(client, query));
+}
+
+TEST(MonitoringQuery, CopyMaskedTopic)
+{
+  eCAL::Monitoring::STopicMon topic = CreateTopic("host1", 1, "person");
+
+  eCAL::Monitoring::STopicMon target;
+  eCAL::Monitoring::CopyMasked(topic, target, eCAL::Monitoring::Field::None);
+
+  // the masked members are empty in the copy
+  EXPECT_EQ("person",           target.tname);
+  EXPECT_EQ("pb.People.Person", target.tinfo.type);
+  EXPECT_TRUE(target.tinfo.descriptor.empty());
+  EXPECT_TRUE(target.attr.empty());
+  EXPECT_EQ(0, target.latency.count);
+  EXPECT_TRUE(target.latency.histogram.empty());
+
+  // and the source is unchanged
+  EXPECT_EQ(1024u, topic.tinfo.descriptor.size());
+  EXPECT_EQ(1u,    topic.attr.size());
+  EXPECT_EQ(42,    topic.latency.count);
+
+  eCAL::Monitoring::CopyMasked(topic, target, eCAL::Monitoring::Field::TopicDescriptor);
+  EXPECT_EQ(1024u, target.tinfo.descriptor.size());
+  EXPECT_TRUE(target.attr.empty());
+
+  eCAL::Monitoring::CopyMasked(topic, target, eCAL::Monitoring::Field::All);
+  EXPECT_EQ(1u, target.attr.size());
+  EXPECT_EQ(42, target.latency.count);
+}
+
+TEST(MonitoringQuery, CopyMaskedProcessAndServer)
+{
+  eCAL::Monitoring::SProcessMon process;
+  process.pid = 1;
+  process.threads.resize(3);
+
+  eCAL::Monitoring::SProcessMon process_target;
+  eCAL::Monitoring::CopyMasked(process, process_target, eCAL::Monitoring::Field::None);
+  EXPECT_EQ(1, process_target.pid);
+  EXPECT_TRUE(process_target.threads.empty());
+  EXPECT_EQ(3u, process.threads.size());
+
+  eCAL::Monitoring::SServerMon server;
+  server.sname = "service";
+  server.methods.resize(2);
+  server.methods[0].mname    = "add";
+  server.methods[0].req_desc = "request descriptor";
+  server.methods[1].resp_desc = "response descriptor";
+
+  eCAL::Monitoring::SServerMon server_target;
+  eCAL::Monitoring::CopyMasked(server, server_target, eCAL::Monitoring::Field::None);
+
+  // the methods are kept without their descriptors
+  ASSERT_EQ(2u, server_target.methods.size());
+  EXPECT_EQ("add", server_target.methods[0].mname);
+  EXPECT_TRUE(server_target.methods[0].req_desc.empty());
+  EXPECT_TRUE(server_target.methods[1].resp_desc.empty());
+  EXPECT_EQ("request descriptor",  server.methods[0].req_desc);
+  EXPECT_EQ("response descriptor", server.methods[1].resp_desc);
+}
@@ -143,3 +143,54 @@ TEST_F(ProtoSubscriberTest, MoveConstruction)
   ASSERT_EQ(1, received_callbacks);
 
 }
+
+TEST_F(ProtoSubscriberTest, MessageAllocation)
+{
+  const eCAL::protobuf::eMessageAllocation allocations[] =
+  {
+    eCAL::protobuf::message_allocation_new,
+    eCAL::protobuf::message_allocation_reuse,
+    eCAL::protobuf::message_allocation_arena
+  };
+
+  for (const auto allocation : allocations)
+  {
+    eCAL::protobuf::CSubscriber<pb::People::Person> person_rec("ProtoSubscriberTest");
+    ASSERT_TRUE(person_rec.SetMessageAllocation(allocation));
+    ASSERT_EQ(allocation, person_rec.GetMessageAllocation());
+
+    // every message must be complete, independent of the previous one
+    std::atomic<int> received(0);
+    std::atomic<int> errors(0);
+    person_rec.AddReceiveCallback([&received, &errors](const char*, const pb::People::Person& person_, long long, long long, long long)
+      {
+        const int id = received++;
+        const std::string name(static_cast<size_t>(id + 1) * 1000, 'x');
+        if (person_.id() != id)                   errors++;
+        if (person_.name() != name)               errors++;
+        if (person_.has_house() != (id % 2 == 0)) errors++;
+      });
+
+    // the allocation can not be changed while a callback is set
+    ASSERT_FALSE(person_rec.SetMessageAllocation(eCAL::protobuf::message_allocation_new));
+
+    eCAL::protobuf::CPublisher<pb::People::Person> person_pub("ProtoSubscriberTest");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+
+    for (int id = 0; id < 3; ++id)
+    {
+      pb::People::Person p;
+      p.set_id(id);
+      p.set_name(std::string(static_cast<size_t>(id + 1) * 1000, 'x'));
+      if (id % 2 == 0) p.mutable_house()->set_rooms(id);
+      person_pub.Send(p);
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+    person_rec.RemReceiveCallback();
+    EXPECT_EQ(3, received);
+    EXPECT_EQ(0, errors);
+  }
+}
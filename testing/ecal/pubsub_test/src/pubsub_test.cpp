@@ -20,7 +20,11 @@
 #include <ecal/ecal.h>
 
 #include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -876,4 +880,114 @@ TEST(IO, DestroyInCallback)
   // finalize eCAL API
   // without destroying any pub / sub
   eCAL::Finalize();
-}
\ No newline at end of file
+}
+
+TEST(IO, FastDiscovery)
+{
+  // default send / receive strings
+  std::string send_s = CreatePayLoad(PAYLOAD_SIZE);
+  std::string recv_s;
+
+  // initialize eCAL API with fast discovery mode
+  std::vector<std::string> args = { "pubsub_test",
+                                    "--ecal-set-config-key", "common/registration_fast_discovery:true" };
+  eCAL::Initialize(args, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "fast"
+  eCAL::CSubscriber sub("fast");
+
+  // create publisher for topic "fast"
+  eCAL::CPublisher pub("fast");
+
+  // they should match long before the next registration refresh
+  eCAL::Process::SleepMS(CMN_REGISTRATION_REFRESH / 4);
+
+  // send content
+  EXPECT_EQ(send_s.size(), pub.Send(send_s));
+
+  // receive content with DATA_FLOW_TIME ms timeout
+  recv_s.clear();
+  EXPECT_EQ(true, sub.ReceiveBuffer(recv_s, nullptr, DATA_FLOW_TIME));
+  EXPECT_EQ(send_s.size(), recv_s.size());
+
+  // destroy publisher
+  pub.Destroy();
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(IO, CallbackExecutor)
+{
+  // default send string
+  std::string send_s = CreatePayLoad(PAYLOAD_SIZE);
+
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // executor with a tiny queue, the oldest samples are dropped
+  eCAL::SCallbackExecutorConfig config;
+  config.queue_size      = 4;
+  config.overflow_policy = eCAL::callback_overflow_drop_oldest;
+  auto executor = std::make_shared<eCAL::CCallbackExecutor>(config);
+
+  // create subscriber for topic "A" with a slow callback
+  eCAL::CSubscriber sub("A");
+  EXPECT_EQ(true, sub.SetCallbackExecutor(executor));
+  std::atomic<long long> last_time(0);
+  EXPECT_EQ(true, sub.AddReceiveCallback([&last_time](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+    {
+      eCAL::Process::SleepMS(10);
+      last_time = data_->time;
+      g_callback_received_count++;
+    }));
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // sending is not slowed down by the callback (the send time is used as sample number)
+  g_callback_received_count = 0;
+  const int send_num(50);
+  const auto send_start = std::chrono::steady_clock::now();
+  for (auto i = 0; i < send_num; ++i)
+  {
+    EXPECT_EQ(send_s.size(), pub.Send(send_s, i + 1));
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - send_start, std::chrono::milliseconds(send_num * 10));
+
+  // let the callbacks work off the queue
+  eCAL::Process::SleepMS(DATA_FLOW_TIME + 10 * static_cast<int>(config.queue_size + 1));
+
+  // samples were dropped, but the last one was delivered
+  const eCAL::SCallbackExecutorStatistics stats = executor->GetStatistics();
+  EXPECT_EQ(0, stats.queue_depth);
+  EXPECT_EQ(config.queue_size, stats.queue_depth_max);
+  EXPECT_GT(stats.dropped, 0);
+  EXPECT_EQ(g_callback_received_count, stats.executed);
+  EXPECT_EQ(send_num, last_time);
+
+  // destroy subscriber, no callback is called afterwards
+  sub.Destroy();
+  g_callback_received_count = 0;
+  EXPECT_EQ(send_s.size(), pub.Send(send_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_EQ(0, g_callback_received_count);
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
@@ -0,0 +1,149 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+// std headers
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+// used libraries
+#include <gtest/gtest.h>
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif /*_MSC_VER*/
+#include <capnp/message.h>
+#include <capnp/serialize.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif /*_MSC_VER*/
+// own project
+#include <ecal/ecal.h>
+#include <ecal/msg/capnproto/view_subscriber.h>
+
+#include "view_sample.capnp.h"
+
+#define REGISTRATION_REFRESH_CYCLE 1000
+
+class CapnprotoViewSubscriberTest : public ::testing::Test {
+public:
+  CapnprotoViewSubscriberTest()
+  : received_callbacks(0)
+  , error_callbacks(0)
+  , received_id(0)
+  , received_values_sum(0)
+  {
+    // Initialize eCAL
+    eCAL::Initialize();
+    // publish / subscribe match in the same process
+    eCAL::Util::EnableLoopback(true);
+  }
+
+  virtual ~CapnprotoViewSubscriberTest() {
+    // Finalize eCAL
+    eCAL::Finalize();
+  }
+
+  static STopicInformation TopicInformation()
+  {
+    STopicInformation topic_info;
+    topic_info.encoding   = eCAL::capnproto::EncodingAsString();
+    topic_info.type       = eCAL::capnproto::TypeAsString<ViewSample>();
+    topic_info.descriptor = eCAL::capnproto::SchemaAsString<ViewSample>();
+    return topic_info;
+  }
+
+  void SendSample(eCAL::CPublisher& pub)
+  {
+    capnp::MallocMessageBuilder message;
+    ViewSample::Builder sample = message.initRoot<ViewSample>();
+    sample.setId(42);
+    sample.setName("view");
+    auto values = sample.initValues(4);
+    for (unsigned int i = 0; i < 4; ++i) values.set(i, static_cast<int32_t>(i + 1));
+
+    const kj::Array<capnp::word> words = capnp::messageToFlatArray(message);
+    pub.Send(words.begin(), words.size() * sizeof(capnp::word));
+  }
+
+  void OnSample(const char*, ViewSample::Reader msg_, long long, long long, long long)
+  {
+    received_id   = msg_.getId();
+    received_name = msg_.getName().cStr();
+    int sum = 0;
+    for (auto value : msg_.getValues()) sum += value;
+    received_values_sum = sum;
+    received_callbacks++;
+  }
+
+  void OnError(const std::string&)
+  {
+    error_callbacks++;
+  }
+
+  std::atomic<int> received_callbacks;
+  std::atomic<int> error_callbacks;
+  std::atomic<int> received_id;
+  std::string      received_name;
+  std::atomic<int> received_values_sum;
+};
+
+TEST_F(CapnprotoViewSubscriberTest, SendReceive)
+{
+  eCAL::capnproto::CViewSubscriber<ViewSample> sample_rec("CapnprotoViewSubscriberTest");
+  sample_rec.EnableVerification(true);
+  sample_rec.AddErrorCallback(std::bind(&CapnprotoViewSubscriberTest::OnError, this, std::placeholders::_1));
+  sample_rec.AddReceiveCallback(std::bind(&CapnprotoViewSubscriberTest::OnSample, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5));
+  ASSERT_TRUE(sample_rec.IsCreated());
+
+  eCAL::CPublisher sample_pub("CapnprotoViewSubscriberTest", TopicInformation());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(2 * REGISTRATION_REFRESH_CYCLE));
+
+  SendSample(sample_pub);
+  std::this_thread::sleep_for(std::chrono::milliseconds(REGISTRATION_REFRESH_CYCLE));
+
+  // the view callback has been called once with the sent content
+  ASSERT_EQ(1, received_callbacks);
+  EXPECT_EQ(0, error_callbacks);
+  EXPECT_EQ(42, received_id);
+  EXPECT_EQ("view", received_name);
+  EXPECT_EQ(10, received_values_sum);
+}
+
+TEST_F(CapnprotoViewSubscriberTest, MalformedMessage)
+{
+  eCAL::capnproto::CViewSubscriber<ViewSample> sample_rec("CapnprotoViewSubscriberTest");
+  sample_rec.AddErrorCallback(std::bind(&CapnprotoViewSubscriberTest::OnError, this, std::placeholders::_1));
+  sample_rec.AddReceiveCallback(std::bind(&CapnprotoViewSubscriberTest::OnSample, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5));
+
+  eCAL::CPublisher sample_pub("CapnprotoViewSubscriberTest", TopicInformation());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(2 * REGISTRATION_REFRESH_CYCLE));
+
+  // the segment table announces more segments than the message contains
+  const std::vector<uint32_t> garbage{ 0x7FFFFFFF, 0xFFFFFFFF, 0, 0 };
+  sample_pub.Send(garbage.data(), garbage.size() * sizeof(uint32_t));
+  std::this_thread::sleep_for(std::chrono::milliseconds(REGISTRATION_REFRESH_CYCLE));
+
+  // the message is reported, the view callback is not called
+  EXPECT_EQ(0, received_callbacks);
+  EXPECT_EQ(1, error_callbacks);
+}
@@ -0,0 +1,138 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+// std headers
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+// used libraries
+#include <gtest/gtest.h>
+#include <flatbuffers/flatbuffers.h>
+// own project
+#include <ecal/ecal.h>
+#include <ecal/msg/flatbuffers/view_subscriber.h>
+
+#include <view_sample/view_sample_generated.h>
+
+#define REGISTRATION_REFRESH_CYCLE 1000
+
+class FlatbuffersViewSubscriberTest : public ::testing::Test {
+public:
+  FlatbuffersViewSubscriberTest()
+  : received_callbacks(0)
+  , error_callbacks(0)
+  , received_id(0)
+  , received_values_sum(0)
+  {
+    // Initialize eCAL
+    eCAL::Initialize();
+    // publish / subscribe match in the same process
+    eCAL::Util::EnableLoopback(true);
+  }
+
+  virtual ~FlatbuffersViewSubscriberTest() {
+    // Finalize eCAL
+    eCAL::Finalize();
+  }
+
+  static STopicInformation TopicInformation()
+  {
+    STopicInformation topic_info;
+    topic_info.encoding = "flatb";
+    return topic_info;
+  }
+
+  void SendSample(eCAL::CPublisher& pub)
+  {
+    ::flatbuffers::FlatBufferBuilder builder;
+    const std::vector<int32_t> values{ 1, 2, 3, 4 };
+    auto name   = builder.CreateString("view");
+    auto vector = builder.CreateVector(values);
+    builder.Finish(ViewTest::CreateViewSample(builder, 42, name, vector));
+    pub.Send(builder.GetBufferPointer(), builder.GetSize());
+  }
+
+  void OnSample(const char*, const ViewTest::ViewSample* msg_, long long, long long, long long)
+  {
+    received_id   = msg_->id();
+    received_name = msg_->name()->str();
+    int sum = 0;
+    for (auto value : *msg_->values()) sum += value;
+    received_values_sum = sum;
+    received_callbacks++;
+  }
+
+  void OnError(const std::string&)
+  {
+    error_callbacks++;
+  }
+
+  std::atomic<int> received_callbacks;
+  std::atomic<int> error_callbacks;
+  std::atomic<int> received_id;
+  std::string      received_name;
+  std::atomic<int> received_values_sum;
+};
+
+TEST_F(FlatbuffersViewSubscriberTest, SendReceive)
+{
+  eCAL::flatbuffers::CViewSubscriber<ViewTest::ViewSample> sample_rec("FlatbuffersViewSubscriberTest");
+  sample_rec.EnableVerification(true);
+  sample_rec.AddErrorCallback(std::bind(&FlatbuffersViewSubscriberTest::OnError, this, std::placeholders::_1));
+  sample_rec.AddReceiveCallback(std::bind(&FlatbuffersViewSubscriberTest::OnSample, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5));
+  ASSERT_TRUE(sample_rec.IsCreated());
+
+  eCAL::CPublisher sample_pub("FlatbuffersViewSubscriberTest", TopicInformation());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(2 * REGISTRATION_REFRESH_CYCLE));
+
+  SendSample(sample_pub);
+  std::this_thread::sleep_for(std::chrono::milliseconds(REGISTRATION_REFRESH_CYCLE));
+
+  // the view callback has been called once with the sent content
+  ASSERT_EQ(1, received_callbacks);
+  EXPECT_EQ(0, error_callbacks);
+  EXPECT_EQ(42, received_id);
+  EXPECT_EQ("view", received_name);
+  EXPECT_EQ(10, received_values_sum);
+}
+
+TEST_F(FlatbuffersViewSubscriberTest, VerificationFailure)
+{
+  eCAL::flatbuffers::CViewSubscriber<ViewTest::ViewSample> sample_rec("FlatbuffersViewSubscriberTest");
+  sample_rec.EnableVerification(true);
+  sample_rec.AddErrorCallback(std::bind(&FlatbuffersViewSubscriberTest::OnError, this, std::placeholders::_1));
+  sample_rec.AddReceiveCallback(std::bind(&FlatbuffersViewSubscriberTest::OnSample, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5));
+
+  eCAL::CPublisher sample_pub("FlatbuffersViewSubscriberTest", TopicInformation());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(2 * REGISTRATION_REFRESH_CYCLE));
+
+  // root offset points far behind the end of the buffer
+  const std::vector<uint32_t> garbage{ 0xFFFFFF00, 0 };
+  sample_pub.Send(garbage.data(), garbage.size() * sizeof(uint32_t));
+  std::this_thread::sleep_for(std::chrono::milliseconds(REGISTRATION_REFRESH_CYCLE));
+
+  // the buffer is reported, the view callback is not called
+  EXPECT_EQ(0, received_callbacks);
+  EXPECT_EQ(1, error_callbacks);
+}
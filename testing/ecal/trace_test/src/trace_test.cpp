@@ -0,0 +1,111 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+#include "ecal_trace.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+// the trace export only needs the process information
+namespace eCAL
+{
+  namespace Process
+  {
+    int         GetProcessID() { return 42; }
+    std::string GetHostName()  { return "trace_host"; }
+    std::string GetUnitName()  { return "trace_unit"; }
+  }
+  namespace Config
+  {
+    namespace Experimental
+    {
+      std::string GetTraceFile() { return ""; }
+    }
+  }
+  namespace Logging
+  {
+    void SetLogLevel(eCAL_Logging_eLogLevel /*level_*/) {}
+    void Log(const std::string& /*msg_*/) {}
+  }
+}
+
+namespace
+{
+  // reads the value of a numeric key of an exported event line
+  long long GetNumber(const std::string& line_, const std::string& key_)
+  {
+    const std::string pattern = "\"" + key_ + "\": ";
+    const size_t pos = line_.find(pattern);
+    if (pos == std::string::npos) return -1;
+    return std::stoll(line_.substr(pos + pattern.size()));
+  }
+}
+
+TEST(Trace, ExportWhileRecording)
+{
+  const std::string file_name = "trace_test.json";
+
+  // every event has a duration of 1 us and its clock is its begin in us,
+  // so torn events can be detected in the export
+  std::atomic<bool> stop(false);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&stop]()
+    {
+      long long begin_us(1);
+      while (!stop)
+      {
+        eCAL::Trace::Record(eCAL::Trace::stage_write, begin_us * 1000, begin_us * 1000 + 1000, static_cast<size_t>(begin_us), begin_us);
+        begin_us++;
+      }
+    });
+  }
+
+  for (int i = 0; i < 10; ++i)
+  {
+    ASSERT_TRUE(eCAL::Trace::Export(file_name));
+
+    std::ifstream file(file_name);
+    ASSERT_TRUE(file.is_open());
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+      if (line.find("\"ph\": \"X\"") == std::string::npos) continue;
+
+      const long long clock = GetNumber(line, "clock");
+      EXPECT_NE(std::string::npos, line.find("\"name\": \"CDataWriter::Write\""));
+      EXPECT_NE(std::string::npos, line.find("\"ts\": " + std::to_string(clock) + ".000, \"dur\": 1.000"));
+      EXPECT_NE(std::string::npos, line.find("\"hash\": \"" + std::to_string(clock) + "\""));
+    }
+  }
+
+  stop = true;
+  for (auto& thread : threads) thread.join();
+
+  std::remove(file_name.c_str());
+}
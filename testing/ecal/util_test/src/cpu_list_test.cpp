@@ -0,0 +1,86 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "ecal_cpu_list.h"
+
+#include <gtest/gtest.h>
+
+TEST(Util, CpuListSingleCpus)
+{
+  std::vector<int> cpus;
+  EXPECT_TRUE(eCAL::Util::ParseCpuList("2,3", cpus));
+  EXPECT_EQ(std::vector<int>({ 2, 3 }), cpus);
+
+  EXPECT_TRUE(eCAL::Util::ParseCpuList("0", cpus));
+  EXPECT_EQ(std::vector<int>({ 0 }), cpus);
+}
+
+TEST(Util, CpuListRanges)
+{
+  std::vector<int> cpus;
+  EXPECT_TRUE(eCAL::Util::ParseCpuList("4-7", cpus));
+  EXPECT_EQ(std::vector<int>({ 4, 5, 6, 7 }), cpus);
+
+  EXPECT_TRUE(eCAL::Util::ParseCpuList("0,2-3, 8 - 9 ,5-5", cpus));
+  EXPECT_EQ(std::vector<int>({ 0, 2, 3, 8, 9, 5 }), cpus);
+}
+
+TEST(Util, CpuListEmpty)
+{
+  std::vector<int> cpus = { 1 };
+  EXPECT_TRUE(eCAL::Util::ParseCpuList("", cpus));
+  EXPECT_TRUE(cpus.empty());
+
+  EXPECT_TRUE(eCAL::Util::ParseCpuList("  ", cpus));
+  EXPECT_TRUE(cpus.empty());
+}
+
+TEST(Util, CpuListInvalid)
+{
+  std::vector<int> cpus;
+
+  // invalid items are skipped, the valid ones are kept
+  EXPECT_FALSE(eCAL::Util::ParseCpuList("1,abc,3", cpus));
+  EXPECT_EQ(std::vector<int>({ 1, 3 }), cpus);
+
+  EXPECT_FALSE(eCAL::Util::ParseCpuList("2x", cpus));
+  EXPECT_TRUE(cpus.empty());
+
+  EXPECT_FALSE(eCAL::Util::ParseCpuList("-1", cpus));
+  EXPECT_TRUE(cpus.empty());
+
+  EXPECT_FALSE(eCAL::Util::ParseCpuList("7-4", cpus));
+  EXPECT_TRUE(cpus.empty());
+
+  EXPECT_FALSE(eCAL::Util::ParseCpuList("1-", cpus));
+  EXPECT_TRUE(cpus.empty());
+
+  EXPECT_FALSE(eCAL::Util::ParseCpuList("1-2-3", cpus));
+  EXPECT_TRUE(cpus.empty());
+
+  EXPECT_FALSE(eCAL::Util::ParseCpuList("1,,2,", cpus));
+  EXPECT_EQ(std::vector<int>({ 1, 2 }), cpus);
+
+  // huge ranges are rejected instead of allocating millions of entries
+  EXPECT_FALSE(eCAL::Util::ParseCpuList("0-2000000000", cpus));
+  EXPECT_TRUE(cpus.empty());
+
+  EXPECT_TRUE(eCAL::Util::ParseCpuList("1023", cpus));
+  EXPECT_FALSE(eCAL::Util::ParseCpuList("1024", cpus));
+}